@@ -0,0 +1,64 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file DebugOverlay.h
+ * @brief Defines the DebugOverlay class.
+ * @author TetriCycle contributors
+ */
+
+#pragma once
+#ifndef __DEBUGOVERLAY_H__
+#define __DEBUGOVERLAY_H__
+
+#include "libwiigui/gui.h" // for GuiText, MEM_TAG_COUNT
+#include "PhaseProfiler.h" // for PHASE_PROFILER
+
+/// How often the overlay text is refreshed, in frames.
+#define DEBUG_OVERLAY_REFRESH 60
+
+/// Diagnostics drawn over the game in debug builds.
+/** Shows the heap use of every subsystem (see memtrack.h): live bytes, how 
+ *  much of it is in MEM2, the peak, and the allocations made in the last 
+ *  frame; while frames are being recorded (see framedump.h), also how many 
+ *  were dropped because the writer fell behind. With the PhaseProfiler 
+ *  enabled, it also graphs how the recent frames split into update, draw, 
+ *  GPU and vsync time against the frame budget. The last line shows how full the music decode ring is and how 
+ *  often it ran dry (see oggplayer.h), and how many sound effects the 
+ *  mixer is playing and had to cut off or drop (see mixer.h). The text 
+ *  only changes once every DEBUG_OVERLAY_REFRESH frames, 
+ *  so the overlay itself hardly shows up in the numbers it reports. */
+class DebugOverlay
+{
+public:
+  DebugOverlay();
+  void Draw(); ///< Draw the overlay; call once per frame.
+
+private:
+  void _Refresh(); ///< Rebuild the text from the current counters.
+  void _DrawFrameGraph(); ///< Draw the phase times of the recent frames.
+
+  GuiText memLines[MEM_TAG_COUNT]; ///< one line per subsystem
+  GuiText heapLine;                ///< the state of the heap and both arenas
+  GuiText frameLine;               ///< the phase times of the last frame
+  GuiText audioLine;               ///< the state of the music ring and the mixer
+  int framesUntilRefresh;          ///< frames left until the text is rebuilt
+};
+
+#endif // __DEBUGOVERLAY_H__
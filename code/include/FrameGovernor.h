@@ -0,0 +1,105 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file FrameGovernor.h
+ * @brief Defines the FrameGovernor class.
+ * @author TetriCycle contributors
+ */
+
+#pragma once
+#ifndef __FRAMEGOVERNOR_H__
+#define __FRAMEGOVERNOR_H__
+
+#include <gctypes.h> // for u32, u64
+
+/// Frames over this fraction (percent) of the budget count as slow.
+#define GOVERNOR_SLOW_PERCENT 90
+/// Frames under this fraction (percent) of the budget count as fast.
+#define GOVERNOR_FAST_PERCENT 60
+/// Consecutive slow frames before dropping a level of detail.
+#define GOVERNOR_SLOW_FRAMES 3
+/// Consecutive fast frames before restoring a level of detail.
+#define GOVERNOR_FAST_FRAMES 120
+/// Frames over this multiple of the budget are ignored (e.g., the pause menu).
+#define GOVERNOR_STALL_FACTOR 4
+/// Playfields drawn at or below this relative scale may use flat blocks.
+#define GOVERNOR_FLAT_BLOCK_SCALE 0.75
+
+/// The level of detail; each level includes the reductions of the ones before it.
+enum LodLevel
+{
+  LOD_FULL,        ///< everything is drawn
+  LOD_NO_SHADOW,   ///< the translucent shadow piece is skipped
+  LOD_SIMPLE_BASE, ///< only the top and front faces of the base are drawn
+  LOD_FLAT_BLOCKS, ///< small playfields draw only the front face of each block
+  LOD_MAX
+};
+
+/// Measures the frame time and trades detail for speed when over budget.
+/** The CPU time is measured from the start of the frame until the display 
+ *  copy is issued; the GPU time is the wait in GX_DrawDone that follows. 
+ *  The budget is one video field, so the level of detail steps down quickly 
+ *  when frames run long and steps back up slowly when there is headroom. */
+class FrameGovernor
+{
+public:
+  static FrameGovernor& GetInstance()
+  {
+    static FrameGovernor governor;
+    return governor;
+  }
+
+  void Reset();      ///< Restore full detail; call when a game starts.
+  void BeginFrame(); ///< Call at the start of each frame.
+  void EndCpu();     ///< Call after the draw commands have been issued.
+  void EndFrame();   ///< Call after GX_DrawDone; updates the level of detail.
+
+  LodLevel GetLevel() { return level; } ///< Get the current level of detail.
+  u32 GetCpuTime() { return cpuTime; }  ///< Get the last frame's CPU time (us).
+  u32 GetGpuTime() { return gpuTime; }  ///< Get the last frame's GPU time (us).
+  u32 GetBudget() { return budget; }    ///< Get the frame budget (us).
+
+  bool IsShadowEnabled() { return level < LOD_NO_SHADOW; } ///< Should the shadow piece be drawn?
+  bool IsBaseSimplified() { return level >= LOD_SIMPLE_BASE; } ///< Should the base be simplified?
+  /// Should blocks be drawn flat at this relative playfield scale?
+  bool IsFlatBlocks(float scale) { return level >= LOD_FLAT_BLOCKS && scale <= GOVERNOR_FLAT_BLOCK_SCALE; }
+
+private:
+  FrameGovernor() : level(LOD_FULL), 
+                    budget(0), 
+                    cpuTime(0), 
+                    gpuTime(0), 
+                    frameStart(0), 
+                    cpuEnd(0), 
+                    slowFrames(0), 
+                    fastFrames(0)
+  {}
+
+  LodLevel level;
+  u32 budget;
+  u32 cpuTime;
+  u32 gpuTime;
+  u64 frameStart;
+  u64 cpuEnd;
+  int slowFrames;
+  int fastFrames;
+};
+
+#endif // __FRAMEGOVERNOR_H__
@@ -0,0 +1,61 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file HudText.h
+ * @brief Defines the HudText class.
+ * @author TetriCycle contributors
+ */
+
+#pragma once
+#ifndef __HUDTEXT_H__
+#define __HUDTEXT_H__
+
+#include "libwiigui/gui.h" // for GuiText
+#include "defines.h"       // for MAX_PLAYERS
+
+/// The in-game text: lines, score and level for every player.
+/** The labels are set up once, and each number only gets new text when it 
+ *  changes, so drawing an unchanged HUD doesn't touch the heap. Glyphs are 
+ *  cached by FreeTypeGX, so a changed number only rasterizes digits that 
+ *  have never been drawn at this font size before. */
+class HudText
+{
+public:
+  HudText();
+  void Draw(); ///< Draw the text for every player.
+
+private:
+  /// The stats shown for each player.
+  enum HudStat
+  {
+    HUD_STAT_LINES,
+    HUD_STAT_SCORE,
+    HUD_STAT_LEVEL,
+    HUD_STAT_MAX
+  };
+
+  void _SetValue(int player, HudStat stat, int value); ///< Update the text for a number if it changed.
+
+  GuiText labels[HUD_STAT_MAX];              ///< "lines:", "score:", "level:"
+  GuiText values[MAX_PLAYERS][HUD_STAT_MAX]; ///< the numbers for each player
+  int cachedValues[MAX_PLAYERS][HUD_STAT_MAX]; ///< the numbers the text was last set to
+};
+
+#endif // __HUDTEXT_H__
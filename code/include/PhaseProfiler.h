@@ -0,0 +1,144 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file PhaseProfiler.h
+ * @brief Defines the PhaseProfiler class.
+ * @author TetriCycle contributors
+ */
+
+#pragma once
+#ifndef __PHASEPROFILER_H__
+#define __PHASEPROFILER_H__
+
+#include <gctypes.h> // for u8, u32, u64
+#include "defines.h" // for DEBUG
+
+/// Set to 1 to time the phases of every game frame.
+#ifndef PHASE_PROFILER
+#define PHASE_PROFILER DEBUG
+#endif
+
+/// Number of timed phases kept; older ones are overwritten (power of 2).
+#define PROF_EVENTS 16384
+/// Number of frames kept for the frame graph.
+#define PROF_GRAPH_FRAMES 120
+/// Value of the player field for phases that aren't tied to a player.
+#define PROF_NO_PLAYER 0xFF
+
+/// The timed phases of a game frame.
+enum ProfPhase
+{
+  PROF_UPDATE,         ///< TCYC_Update
+  PROF_INPUT,          ///<   scanning the pads and handling input
+  PROF_MOVEMENT,       ///<     moving a player's piece
+  PROF_POWERUPS,       ///<     handling a player's powerup input
+  PROF_PLAYER_UPDATE,  ///<   updating a player's powerup effects
+  PROF_DRAW,           ///< TCYC_Draw
+  PROF_BOUNDARY,       ///<   the playfield boundary
+  PROF_TEXT,           ///<   the HUD text
+  PROF_CYLINDER,       ///<   a player's TetriCycle
+  PROF_DRAW_POWERUPS,  ///<   the powerup queues and cursors
+  PROF_RENDER,         ///< TCYC_Render
+  PROF_COPYDISP,       ///<   GX_CopyDisp
+  PROF_DRAWDONE,       ///<   waiting for the GPU in GX_DrawDone
+  PROF_VSYNC,          ///<   waiting for the vertical retrace
+  PROF_PHASE_MAX
+};
+
+/// A single timed phase.
+struct ProfEvent
+{
+  u64 start;  ///< timebase ticks when the phase started
+  u32 ticks;  ///< duration in timebase ticks
+  u8 phase;   ///< the ProfPhase
+  u8 player;  ///< the player index, or PROF_NO_PLAYER
+  u8 depth;   ///< nesting depth of the phase
+};
+
+/// Times the phases of the game loop.
+/** Phases are timed with the timebase (gettime) and appended to a ring 
+ *  buffer of PROF_EVENTS entries. There is a single writer, the game 
+ *  thread; the write index only advances after an entry is complete, so 
+ *  readers never see a half-written entry and no lock is needed. At the 
+ *  end of every frame the time spent in each phase is added to a short 
+ *  history that the debug overlay draws as a frame graph. The ring buffer 
+ *  can be written out in the Chrome trace event format (load it in 
+ *  chrome://tracing or Perfetto). */
+class PhaseProfiler
+{
+public:
+  static PhaseProfiler& GetInstance()
+  {
+    static PhaseProfiler profiler;
+    return profiler;
+  }
+
+  void Record(u8 phase, u8 player, u64 start, u64 end); ///< Append a timed phase.
+  void EndFrame(); ///< Call once the frame has been shown.
+  void Reset();    ///< Forget every phase timed so far; call when a game starts.
+  bool DumpTrace(const char *path); ///< Write the ring buffer as Chrome trace JSON.
+
+  /// Get a phase's time (us) in a recent frame; age 0 is the last frame.
+  u32 GetFrameTime(int age, u8 phase);
+  /// Get the longest frame (us) since the profiler started.
+  u32 GetWorstFrame() { return worstFrame; }
+
+  static const char *GetPhaseName(u8 phase); ///< Get the name of a phase.
+
+private:
+  friend class ProfScope;
+
+  PhaseProfiler() : head(0), graphHead(0), worstFrame(0), depth(0) {}
+
+  ProfEvent events[PROF_EVENTS]; ///< the ring buffer
+  volatile u32 head;             ///< total number of entries written
+  u32 frameTicks[PROF_PHASE_MAX]; ///< time per phase in the frame in progress
+  u32 graph[PROF_GRAPH_FRAMES][PROF_PHASE_MAX]; ///< time (us) per phase of recent frames
+  int graphHead;  ///< the graph entry of the last frame
+  u32 worstFrame; ///< the longest frame (us)
+  u8 depth;       ///< nesting depth of the phases currently being timed
+};
+
+/// Times the enclosing block as a phase.
+class ProfScope
+{
+public:
+  ProfScope(u8 phase, u8 player = PROF_NO_PLAYER);
+  ~ProfScope();
+
+private:
+  u64 start;
+  u8 phase;
+  u8 player;
+};
+
+#if PHASE_PROFILER
+#define PROF_SCOPE(phase) ProfScope _profScope(phase)
+#define PROF_SCOPE_PLAYER(phase, player) ProfScope _profScope(phase, player)
+#define PROF_END_FRAME() PhaseProfiler::GetInstance().EndFrame()
+#define PROF_RESET() PhaseProfiler::GetInstance().Reset()
+#else
+#define PROF_SCOPE(phase)
+#define PROF_SCOPE_PLAYER(phase, player)
+#define PROF_END_FRAME()
+#define PROF_RESET()
+#endif
+
+#endif // __PHASEPROFILER_H__
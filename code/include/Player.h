@@ -303,6 +303,12 @@ public:
   void DrawBlockAsCube(float x, float y, ColorId colorIdx, u8 alpha = 255, GuiImageData *imgData = NULL, bool isGuideDot = false);
 
 private:
+  void _SetViewport(); ///< Offsets the viewport to this player's section of the screen.
+  void _GetBlockMatrix(float x, float y, bool isGuideDot, Mtx modelview); ///< Calculates the modelview matrix for a block.
+  void _GetColumnMatrices(Mtx columnMtx[], guVector &rowStep); ///< Calculates the modelview matrix of every column.
+  void _GetRowMatrix(Mtx columnMtx, guVector &rowStep, float rowOffset, Mtx modelview); ///< Offsets a column matrix to a row.
+  float _GetRowOffset(int y); ///< Returns the y offset from the center of the playfield for a row.
+  float _GetBlockScale(); ///< Returns the edge length of a block.
   float _GetScale() { return !gameData.powerupData.playfieldScale ? (float)playfieldScale : gameData.powerupData.playfieldScale; } ///< Get the scale factor used for drawing this player's TetriCycle.
   void _SetBaseColor(GXColor &c) { g_cubeGradients[COLOR_ID_BASE].SetColor(c); }
   void _GetWinner();
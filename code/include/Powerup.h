@@ -94,6 +94,10 @@
  *   in the header file and source file.
  * - The only functions you need to implement are StartEffect and StopEffect 
  *   (located in the source file).
+ * - The image and sound are declared as PowerupImage and PowerupSound, so 
+ *   they are only decoded when first used (or when the startup screen 
+ *   prefetches them); don't create GuiImageData or GuiSound objects in 
+ *   static initializers.
  * - Your powerup is automagically added to the game menu.
  *
  * @section powerupoverridessection Optional Overrides
@@ -131,6 +135,30 @@ class GuiSound;
 using std::string;
 using std::vector;
 
+/// A powerup image, decoded the first time it's used.
+/**
+ * Initialize it with the embedded image and NULL; being plain data, it is 
+ * set up before any static initializer runs and costs nothing until Get.
+ */
+struct PowerupImage
+{
+  const u8 *png;           ///< the embedded image
+  GuiImageData *imageData; ///< NULL until first use
+
+  GuiImageData* Get(); ///< Returns the image data, decoding it if necessary.
+};
+
+/// A powerup sound, created the first time it's used.
+/** Initialize it with the embedded sound, the address of its size and NULL. */
+struct PowerupSound
+{
+  const u8 *pcm;   ///< the embedded sound
+  const u32 *size; ///< the size of the embedded sound
+  GuiSound *sound; ///< NULL until first use
+
+  GuiSound* Get(); ///< Returns the sound, creating it if necessary.
+};
+
 /// The base class for powerups.
 class Powerup
 {
@@ -156,7 +184,7 @@ public:
   virtual string* GetHelpText() = 0;        ///< A description of this powerup used in the menu.
 
   // OVERRIDE IF NECESSARY:
-  virtual GuiSound* GetSound() { return defaultSound; } ///< The sound associated with this powerup.
+  virtual GuiSound* GetSound() { return defaultSound.Get(); } ///< The sound associated with this powerup.
 
 protected:
   Powerup() : elapsedTime(0) { }
@@ -182,7 +210,7 @@ protected:
 private:
   u64 startTime;
   u32 elapsedTime;
-  static GuiSound *defaultSound;
+  static PowerupSound defaultSound;
 
   void Terminate(); ///< Called automatically when a powerup's duration expires.
   void ResetStartTime() { startTime = gettime(); }
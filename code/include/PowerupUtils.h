@@ -28,6 +28,7 @@
 #define __POWERUPUTILS_H__
 
 #include <string>
+#include "Powerup.h" // for PowerupSound
 #include "defines_Powerup.h"
 
 class Powerup;
@@ -50,14 +51,15 @@ public:
   static int GetTotalPowerups();                       ///< Returns the total number of unique powerups.
   static void ResetPowerupStartTimes();                ///< Called when the game is unpaused.
   static void DeleteAllPowerups();                     ///< Called when the game is reset/quit.
+  static void LoadAllAssets();                         ///< Decodes every powerup image and sound ahead of use.
 
   /// Sound effect for invalid use of Powerup.
-  static GuiSound* GetInvalidTargetSound() { return invalidTargetSound; }
+  static GuiSound* GetInvalidTargetSound() { return invalidTargetSound.Get(); }
 
 private:
   PowerupUtils() { }
 
-  static GuiSound *invalidTargetSound;
+  static PowerupSound invalidTargetSound;
 };
 
 #endif // __POWERUPUTILS_H__
\ No newline at end of file
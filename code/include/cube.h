@@ -0,0 +1,54 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file cube.h
+ * @brief Prototypes for the cube drawing functions defined in cube.cpp.
+ * @author TetriCycle contributors
+ */
+
+#pragma once
+#ifndef __CUBE_H__
+#define __CUBE_H__
+
+#include <gctypes.h> // for u8
+#include <ogc/gu.h>  // for Mtx
+class GuiImageData;
+struct ColorGradient;
+
+/// The faces of a cube, in the order GX_CubeBatch draws them.
+enum CubeFace
+{
+  CUBE_FACE_TOP,
+  CUBE_FACE_BOTTOM,
+  CUBE_FACE_FRONT,
+  CUBE_FACE_BACK,
+  CUBE_FACE_LEFT,
+  CUBE_FACE_RIGHT,
+  CUBE_FACE_MAX
+};
+
+#define CUBE_FACE_BIT(face) (1 << (face))
+#define CUBE_FACES_ALL ((1 << CUBE_FACE_MAX) - 1)
+
+void GX_Cube(int colorIdx, u8 alpha = 255, GuiImageData *imgData = NULL, bool isFrontDrawn = true);
+void GX_CubeFront(u8 alpha = 255);
+void GX_CubeBatch(Mtx modelview[], const ColorGradient gradient[], int count, u8 alpha = 255, u8 faceMask = CUBE_FACES_ALL);
+
+#endif // __CUBE_H__
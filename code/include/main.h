@@ -27,9 +27,6 @@
 #ifndef __MAIN_H__
 #define __MAIN_H__
 
-#include <gctypes.h> // for u8
-class GuiImageData;
-
 // used by tetris_menu.cpp
 void TCYC_SetUp2D();
 void TCYC_DrawText();
@@ -40,7 +37,4 @@ void TCYC_EditPlayfield();
 int TCYC_GetTargetPlayer(int x);
 int TCYC_GetTargetPowerupSlot(int player, int x, int y);
 
-// used by Player.cpp
-void GX_Cube(int colorIdx, u8 alpha = 255, GuiImageData *imgData = NULL);
-
 #endif // __MAIN_H__
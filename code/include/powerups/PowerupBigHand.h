@@ -38,7 +38,7 @@ class PowerupBigHand : public Powerup
 {
 public:
   virtual PowerupId GetPowerupId() { return powerupId; }
-  virtual GuiImageData* GetImageData() { return imageData; }
+  virtual GuiImageData* GetImageData() { return image.Get(); }
   virtual string* GetHelpText() { return helpText; }
 
 protected:
@@ -62,7 +62,7 @@ protected:
 private:
   static PowerupId powerupId;
   static Powerup *instance;
-  static GuiImageData *imageData;
+  static PowerupImage image;
   static string helpText[2];
 };
 
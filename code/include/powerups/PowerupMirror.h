@@ -38,9 +38,9 @@ class PowerupMirror : public Powerup
 {
 public:
   virtual PowerupId GetPowerupId() { return powerupId; }
-  virtual GuiImageData* GetImageData() { return imageData; }
+  virtual GuiImageData* GetImageData() { return image.Get(); }
   virtual string* GetHelpText() { return helpText; }
-  // OPTIONAL: virtual GuiSound* GetSound() { return sound; }
+  // OPTIONAL: virtual GuiSound* GetSound() { return sound.Get(); }
 
 protected:
   PowerupMirror()
@@ -66,9 +66,9 @@ protected:
 private:
   static PowerupId powerupId;
   static Powerup *instance;
-  static GuiImageData *imageData;
+  static PowerupImage image;
   static string helpText[2];
-  // OPTIONAL: static GuiSound *sound;
+  // OPTIONAL: static PowerupSound sound;
 };
 
 #endif // __POWERUPMIRROR_H__
\ No newline at end of file
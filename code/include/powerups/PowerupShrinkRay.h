@@ -38,9 +38,9 @@ class PowerupShrinkRay : public Powerup
 {
 public:
   virtual PowerupId GetPowerupId() { return powerupId; }
-  virtual GuiImageData* GetImageData() { return imageData; }
+  virtual GuiImageData* GetImageData() { return image.Get(); }
   virtual string* GetHelpText() { return helpText; }
-  virtual GuiSound* GetSound() { return sound; }
+  virtual GuiSound* GetSound() { return sound.Get(); }
 
 protected:
   PowerupShrinkRay()
@@ -63,8 +63,8 @@ protected:
 private:
   static PowerupId powerupId;
   static Powerup *instance;
-  static GuiImageData *imageData;
-  static GuiSound *sound;
+  static PowerupImage image;
+  static PowerupSound sound;
   static string helpText[2];
 };
 
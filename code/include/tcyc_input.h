@@ -245,6 +245,11 @@ bool PausePressedAnyPlayer();     ///< Returns true if any player pressed pause.
   || WPAD_ButtonsDown(i) & WPAD_BUTTON_MINUS \
 )
 
+#define CAPTURE_PRESSED(i) \
+( \
+  PAD_ButtonsDown(i) & PAD_TRIGGER_L \
+)
+
 #define LOADER_PRESSED(i) \
 ( \
   PAD_ButtonsDown(i) & PAD_TRIGGER_R \
@@ -0,0 +1,181 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file DebugOverlay.cpp
+ * @author TetriCycle contributors
+ */
+
+#include "DebugOverlay.h"
+
+#include <cstdio>          // for sprintf
+#include "FrameGovernor.h" // for FrameGovernor
+#include "framedump.h"     // for FrameDump_IsRecording, FrameDump_GetStalls
+
+#define OVERLAY_FONT_SIZE 14
+#define OVERLAY_X 10 // distance from the left edge of the screen
+#define OVERLAY_DY 16 // distance between lines
+#define GRAPH_RIGHT 630 // right edge of the frame graph
+#define GRAPH_BOTTOM 130 // baseline of the frame graph
+#define GRAPH_BAR_WIDTH 2 // width of a frame in the graph
+#define GRAPH_US_PER_PIXEL 200 // the budget of a 60 Hz frame is 83 pixels high
+
+DebugOverlay::DebugOverlay() : framesUntilRefresh(0)
+{
+  GXColor color = (GXColor){255, 255, 0, 255};
+  int y = screenheight - (MEM_TAG_COUNT + 3) * OVERLAY_DY;
+
+  for (int i = 0; i < MEM_TAG_COUNT; ++i, y += OVERLAY_DY)
+  {
+    memLines[i].SetFontSize(OVERLAY_FONT_SIZE);
+    memLines[i].SetColor(color);
+    memLines[i].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    memLines[i].SetPosition(OVERLAY_X, y);
+  }
+
+  heapLine.SetFontSize(OVERLAY_FONT_SIZE);
+  heapLine.SetColor(color);
+  heapLine.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+  heapLine.SetPosition(OVERLAY_X, y);
+
+  audioLine.SetFontSize(OVERLAY_FONT_SIZE);
+  audioLine.SetColor(color);
+  audioLine.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+  audioLine.SetPosition(OVERLAY_X, y + OVERLAY_DY);
+
+  frameLine.SetFontSize(OVERLAY_FONT_SIZE);
+  frameLine.SetColor(color);
+  frameLine.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+  frameLine.SetPosition(OVERLAY_X, GRAPH_BOTTOM + 4);
+}
+
+void DebugOverlay::Draw()
+{
+  if (--framesUntilRefresh <= 0)
+  {
+    _Refresh();
+    framesUntilRefresh = DEBUG_OVERLAY_REFRESH;
+  }
+
+#if PHASE_PROFILER
+  _DrawFrameGraph();
+  frameLine.Draw();
+#endif
+
+  for (int i = 0; i < MEM_TAG_COUNT; ++i)
+    memLines[i].Draw();
+  heapLine.Draw();
+  audioLine.Draw();
+}
+
+void DebugOverlay::_Refresh()
+{
+  char buf[128];
+
+  for (int i = 0; i < MEM_TAG_COUNT; ++i)
+  {
+    const MemTagStats *stats = MemTrack_GetStats(i);
+    sprintf(buf, "%-8s %6uK (mem2 %6uK) peak %6uK  %5u live  %3u/frame", 
+      MemTrack_GetTagName(i), stats->liveBytes >> 10, stats->mem2Bytes >> 10, 
+      stats->peakBytes >> 10, stats->liveAllocs, stats->frameAllocs);
+    memLines[i].SetText(buf);
+  }
+
+  u32 mem1Free, mem2Free;
+  MemTrack_GetArenaFree(&mem1Free, &mem2Free);
+  int len = sprintf(buf, "heap %uK  mem1 free %uK  mem2 free %uK", 
+    MemTrack_HeapUsed() >> 10, mem1Free >> 10, mem2Free >> 10);
+  if (FrameDump_IsRecording())
+    sprintf(buf + len, "  recording, %u stalls", FrameDump_GetStalls());
+  heapLine.SetText(buf);
+
+#ifndef NO_SOUND
+  OggStats ogg;
+  MixerStats mixer;
+  GetStatsOgg(&ogg);
+  Mixer_GetStats(&mixer);
+  sprintf(buf, "music %d/%d min %d starved %u underruns %u  sfx %d/%d stolen %u dropped %u", 
+    ogg.fill, ogg.slots, ogg.min_fill, ogg.starved, ogg.underruns, 
+    mixer.active, MIXER_VOICES, mixer.stolen, mixer.dropped);
+  audioLine.SetText(buf);
+#endif
+
+#if PHASE_PROFILER
+  PhaseProfiler &profiler = PhaseProfiler::GetInstance();
+  sprintf(buf, "update %uus  draw %uus  render %uus  vsync %uus  worst %uus", 
+    profiler.GetFrameTime(0, PROF_UPDATE), profiler.GetFrameTime(0, PROF_DRAW), 
+    profiler.GetFrameTime(0, PROF_RENDER) - profiler.GetFrameTime(0, PROF_VSYNC), 
+    profiler.GetFrameTime(0, PROF_VSYNC), profiler.GetWorstFrame());
+  frameLine.SetText(buf);
+#endif
+}
+
+/// Draws one stacked bar per frame, newest on the right: update (green), 
+/// draw (blue), the rest of render (orange) and the vsync wait (grey). The 
+/// red line is the frame budget.
+void DebugOverlay::_DrawFrameGraph()
+{
+  static const GXColor colors[4] = {
+    {0, 200, 0, 255}, {0, 120, 255, 255}, {255, 160, 0, 255}, {96, 96, 96, 255}};
+
+  PhaseProfiler &profiler = PhaseProfiler::GetInstance();
+  int budgetY = GRAPH_BOTTOM - FrameGovernor::GetInstance().GetBudget() / GRAPH_US_PER_PIXEL;
+
+  Render_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+  Render_SetVtxDesc(GX_VA_TEX0, GX_NONE);
+  Render_Begin(GX_QUADS, GX_VTXFMT0, (PROF_GRAPH_FRAMES * 4 + 1) * 4);
+
+  for (int age = 0; age < PROF_GRAPH_FRAMES; ++age)
+  {
+    u32 render = profiler.GetFrameTime(age, PROF_RENDER);
+    u32 vsync = profiler.GetFrameTime(age, PROF_VSYNC);
+    u32 times[4] = {profiler.GetFrameTime(age, PROF_UPDATE), 
+      profiler.GetFrameTime(age, PROF_DRAW), 
+      render > vsync ? render - vsync : 0, vsync};
+
+    int x = GRAPH_RIGHT - (age + 1) * GRAPH_BAR_WIDTH;
+    int y = GRAPH_BOTTOM;
+
+    for (int i = 0; i < 4; ++i)
+    {
+      int top = y - times[i] / GRAPH_US_PER_PIXEL;
+      const GXColor &c = colors[i];
+      GX_Position3f32(x, top, 0);
+      GX_Color4u8(c.r, c.g, c.b, c.a);
+      GX_Position3f32(x + GRAPH_BAR_WIDTH, top, 0);
+      GX_Color4u8(c.r, c.g, c.b, c.a);
+      GX_Position3f32(x + GRAPH_BAR_WIDTH, y, 0);
+      GX_Color4u8(c.r, c.g, c.b, c.a);
+      GX_Position3f32(x, y, 0);
+      GX_Color4u8(c.r, c.g, c.b, c.a);
+      y = top;
+    }
+  }
+
+  int left = GRAPH_RIGHT - PROF_GRAPH_FRAMES * GRAPH_BAR_WIDTH;
+  GX_Position3f32(left, budgetY, 0);
+  GX_Color4u8(255, 0, 0, 255);
+  GX_Position3f32(GRAPH_RIGHT, budgetY, 0);
+  GX_Color4u8(255, 0, 0, 255);
+  GX_Position3f32(GRAPH_RIGHT, budgetY + 1, 0);
+  GX_Color4u8(255, 0, 0, 255);
+  GX_Position3f32(left, budgetY + 1, 0);
+  GX_Color4u8(255, 0, 0, 255);
+  Render_End();
+}
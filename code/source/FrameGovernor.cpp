@@ -0,0 +1,88 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file FrameGovernor.cpp
+ * @author TetriCycle contributors
+ */
+
+#include "FrameGovernor.h"
+
+#include <gccore.h>           // for GXRModeObj, VI_PAL
+#include <ogc/lwp_watchdog.h> // for gettime, ticks_to_microsecs
+
+extern GXRModeObj *g_vmode; ///< the video mode
+
+void FrameGovernor::Reset()
+{
+  bool isPal = (g_vmode->viTVMode >> 2) == VI_PAL;
+  budget = 1000000 / (isPal ? 50 : 60);
+  level = LOD_FULL;
+  cpuTime = gpuTime = 0;
+  slowFrames = fastFrames = 0;
+  frameStart = cpuEnd = gettime();
+}
+
+void FrameGovernor::BeginFrame()
+{
+  frameStart = gettime();
+}
+
+void FrameGovernor::EndCpu()
+{
+  cpuEnd = gettime();
+}
+
+void FrameGovernor::EndFrame()
+{
+  u64 frameEnd = gettime();
+  cpuTime = ticks_to_microsecs(cpuEnd - frameStart);
+  gpuTime = ticks_to_microsecs(frameEnd - cpuEnd);
+
+  // The CPU and GPU overlap until GX_DrawDone, so the frame cost is the 
+  // time from the start of the frame until the GPU is finished.
+  u32 frameTime = cpuTime + gpuTime;
+
+  // Ignore stalls that have nothing to do with drawing (e.g., pausing).
+  if (!budget || frameTime > budget * GOVERNOR_STALL_FACTOR)
+    return;
+
+  if (frameTime * 100 > budget * GOVERNOR_SLOW_PERCENT)
+  {
+    fastFrames = 0;
+    if (++slowFrames >= GOVERNOR_SLOW_FRAMES && level < LOD_MAX - 1)
+    {
+      level = (LodLevel)(level + 1);
+      slowFrames = 0;
+    }
+  }
+  else if (frameTime * 100 < budget * GOVERNOR_FAST_PERCENT)
+  {
+    slowFrames = 0;
+    if (++fastFrames >= GOVERNOR_FAST_FRAMES && level > LOD_FULL)
+    {
+      level = (LodLevel)(level - 1);
+      fastFrames = 0;
+    }
+  }
+  else
+  {
+    slowFrames = fastFrames = 0;
+  }
+}
@@ -0,0 +1,102 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file HudText.cpp
+ * @author TetriCycle contributors
+ */
+
+#include "HudText.h"
+
+#include <cstdio>    // for sprintf
+#include "Options.h" // for Options
+#include "Player.h"  // for Player
+
+extern Options *g_options; ///< the global options
+extern Player *g_players;  ///< the player instances
+
+#define HUD_FONT_SIZE 28
+#define HUD_X_OFFSET 10 // distance from a player's left border
+#define HUD_VALUE_DX 100 // distance from a label to its number
+#define HUD_DY 32 // distance between lines
+
+HudText::HudText()
+{
+  static const char *labelText[HUD_STAT_MAX] = {"lines:", "score:", "level:"};
+
+  for (int s = 0; s < HUD_STAT_MAX; ++s)
+  {
+    labels[s].SetText(labelText[s]);
+    labels[s].SetFontSize(HUD_FONT_SIZE);
+    labels[s].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+
+    for (int i = 0; i < MAX_PLAYERS; ++i)
+    {
+      values[i][s].SetFontSize(HUD_FONT_SIZE);
+      values[i][s].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+      cachedValues[i][s] = -1; // force the first update
+    }
+  }
+}
+
+void HudText::Draw()
+{
+  static const u8 a = 64; // alpha: 0 = transparent, 255 = opaque
+  GXColor txtColor = !g_options->isPaused ? 
+    (GXColor){255, 255, 255, a} : (GXColor){255, 255, 255, 255};
+  GXColor deadColor = (GXColor){200, 0, 0, 255};
+
+  int player_x = HUD_X_OFFSET;
+  int player_dx = screenwidth / g_options->players; // assume: g_options->netplay == 0
+
+  for (int i = 0; i < g_options->players; ++i, player_x += player_dx)
+  {
+    Player &player = g_players[i];
+    GXColor color = !player.gameData.isDead ? txtColor : deadColor;
+
+    _SetValue(i, HUD_STAT_LINES, player.gameData.lines);
+    _SetValue(i, HUD_STAT_SCORE, player.gameData.score);
+    _SetValue(i, HUD_STAT_LEVEL, player.gameData.level);
+
+    int y = 0;
+    for (int s = 0; s < HUD_STAT_MAX; ++s)
+    {
+      y += HUD_DY;
+
+      labels[s].SetColor(color);
+      labels[s].SetPosition(player_x, y);
+      labels[s].Draw();
+
+      values[i][s].SetColor(color);
+      values[i][s].SetPosition(player_x + HUD_VALUE_DX, y);
+      values[i][s].Draw();
+    }
+  }
+}
+
+void HudText::_SetValue(int player, HudStat stat, int value)
+{
+  if (cachedValues[player][stat] == value)
+    return;
+
+  char buf[12]; // allows for any int
+  sprintf(buf, "%d", value);
+  values[player][stat].SetText(buf);
+  cachedValues[player][stat] = value;
+}
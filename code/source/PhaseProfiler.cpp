@@ -0,0 +1,134 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file PhaseProfiler.cpp
+ * @author TetriCycle contributors
+ */
+
+#include "PhaseProfiler.h"
+
+#include <cstdio>             // for FILE, fopen, fprintf
+#include <cstring>            // for memset
+#include <ogc/lwp_watchdog.h> // for gettime, ticks_to_microsecs, ticks_to_nanosecs
+
+void PhaseProfiler::Record(u8 phase, u8 player, u64 start, u64 end)
+{
+  ProfEvent &event = events[head & (PROF_EVENTS - 1)];
+  event.start = start;
+  event.ticks = end - start;
+  event.phase = phase;
+  event.player = player;
+  event.depth = depth;
+  frameTicks[phase] += event.ticks;
+
+  // Publish the entry only once it's complete.
+  head = head + 1;
+}
+
+void PhaseProfiler::EndFrame()
+{
+  graphHead = (graphHead + 1) % PROF_GRAPH_FRAMES;
+  u32 *frame = graph[graphHead];
+
+  for (int i = 0; i < PROF_PHASE_MAX; ++i)
+    frame[i] = ticks_to_microsecs(frameTicks[i]);
+  memset(frameTicks, 0, sizeof(frameTicks));
+
+  u32 frameTime = frame[PROF_UPDATE] + frame[PROF_DRAW] + frame[PROF_RENDER];
+  if (frameTime > worstFrame)
+    worstFrame = frameTime;
+}
+
+void PhaseProfiler::Reset()
+{
+  head = 0;
+  graphHead = 0;
+  worstFrame = 0;
+  memset(frameTicks, 0, sizeof(frameTicks));
+  memset(graph, 0, sizeof(graph));
+}
+
+u32 PhaseProfiler::GetFrameTime(int age, u8 phase)
+{
+  int i = (graphHead - age + PROF_GRAPH_FRAMES) % PROF_GRAPH_FRAMES;
+  return graph[i][phase];
+}
+
+/// Writes every phase still in the ring buffer as a complete ("X") event.
+/** Timestamps are in microseconds relative to the earliest start written; 
+ *  each player's phases get their own track. Phases are recorded when they 
+ *  end, so an enclosing phase comes after the phases nested in it. */
+bool PhaseProfiler::DumpTrace(const char *path)
+{
+  FILE *file = fopen(path, "w");
+  if (!file)
+    return false;
+
+  u32 end = head;
+  u32 begin = end > PROF_EVENTS ? end - PROF_EVENTS : 0;
+  u64 base = begin < end ? events[begin & (PROF_EVENTS - 1)].start : 0;
+  for (u32 i = begin; i < end; ++i)
+  {
+    if (events[i & (PROF_EVENTS - 1)].start < base)
+      base = events[i & (PROF_EVENTS - 1)].start;
+  }
+
+  fprintf(file, "{\"traceEvents\":[\n");
+  for (u32 i = begin; i < end; ++i)
+  {
+    const ProfEvent &event = events[i & (PROF_EVENTS - 1)];
+    u64 ts = ticks_to_nanosecs(event.start - base);
+    u64 dur = ticks_to_nanosecs((u64)event.ticks);
+    int tid = event.player != PROF_NO_PLAYER ? event.player + 1 : 0;
+
+    fprintf(file, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,"
+      "\"ts\":%llu.%03llu,\"dur\":%llu.%03llu}%s\n", 
+      GetPhaseName(event.phase), tid, ts / 1000, ts % 1000, 
+      dur / 1000, dur % 1000, i + 1 < end ? "," : "");
+  }
+  fprintf(file, "]}\n");
+
+  fclose(file);
+  return true;
+}
+
+const char *PhaseProfiler::GetPhaseName(u8 phase)
+{
+  static const char *names[PROF_PHASE_MAX] = {
+    "update", "input", "movement", "powerups", "player update", 
+    "draw", "boundary", "text", "cylinder", "draw powerups", 
+    "render", "copy disp", "draw done", "vsync"};
+
+  return phase < PROF_PHASE_MAX ? names[phase] : "?";
+}
+
+ProfScope::ProfScope(u8 phase, u8 player) : phase(phase), player(player)
+{
+  ++PhaseProfiler::GetInstance().depth;
+  start = gettime();
+}
+
+ProfScope::~ProfScope()
+{
+  u64 end = gettime();
+  PhaseProfiler &profiler = PhaseProfiler::GetInstance();
+  --profiler.depth;
+  profiler.Record(phase, player, start, end);
+}
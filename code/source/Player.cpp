@@ -28,7 +28,8 @@
 #include "libwiigui/gui.h" // for GuiSound
 #include "Options.h"       // for Options
 #include "tcyc_menu.h"     // for TCYC_MenuPause
-#include "main.h"          // for GX_Cube
+#include "cube.h"          // for GX_Cube, GX_CubeBatch
+#include "FrameGovernor.h" // for FrameGovernor
 
 extern MODPlay g_modPlay; ///< used for playing the game music
 extern GuiSound *g_tetrisCheerSound; ///< the tetris sound effect
@@ -69,11 +70,30 @@ void Player::Reset()
 // Draw the playfield (all the static tetris pieces).
 void Player::DrawPlayfield()
 {
+  // Plain blocks are transformed and drawn as one batch. Blocks with a 
+  // powerup face are batched separately without their front faces, which 
+  // are then drawn grouped by powerup so each texture is loaded only once.
+  // When the frame governor asks for flat blocks, small playfields only 
+  // draw the front faces, since the sides are barely visible anyway.
+  static Mtx blockMtx[MAX_PLAYFIELD_WIDTH * MAX_PLAYFIELD_HEIGHT];
+  static ColorGradient blockGradient[MAX_PLAYFIELD_WIDTH * MAX_PLAYFIELD_HEIGHT];
+  static Mtx powerupBlockMtx[MAX_PLAYFIELD_WIDTH * MAX_PLAYFIELD_HEIGHT];
+  static ColorGradient powerupBlockGradient[MAX_PLAYFIELD_WIDTH * MAX_PLAYFIELD_HEIGHT];
+  static GuiImageData *powerupBlockImg[MAX_PLAYFIELD_WIDTH * MAX_PLAYFIELD_HEIGHT];
+  int blocks = 0;
+  int powerupBlocks = 0;
+
   TetrisPieceConnectivityInfo *connectivityInfo = NULL;
   GuiImageData *imgData = NULL;
 
+  Mtx columnMtx[MAX_PLAYFIELD_WIDTH];
+  guVector rowStep;
+  _GetColumnMatrices(columnMtx, rowStep);
+
   for (int y = 0; y < playfieldHeight; ++y)
   {
+    float rowOffset = _GetRowOffset(y);
+
     for (int x = 0; x < playfieldWidth; ++x)
     {
       TetrisPieceId pieceId = gameData.playfield[x][y].pieceId;
@@ -93,9 +113,62 @@ void Player::DrawPlayfield()
           NULL : PowerupUtils::GetImageData(connectivityInfo->powerupId);
       }
 
-      DrawBlockAsCube(x, y, gfx, 255, imgData);
+      if (!imgData)
+      {
+        _GetRowMatrix(columnMtx[x], rowStep, rowOffset, blockMtx[blocks]);
+        blockGradient[blocks++] = g_cubeGradients[gfx];
+      }
+      else
+      {
+        _GetRowMatrix(columnMtx[x], rowStep, rowOffset, powerupBlockMtx[powerupBlocks]);
+        powerupBlockGradient[powerupBlocks] = g_cubeGradients[gfx];
+        powerupBlockImg[powerupBlocks++] = imgData;
+      }
+    }
+  }
+
+  bool isFlat = FrameGovernor::GetInstance().IsFlatBlocks(_GetScale() / (float)DEFAULT_PLAYFIELD_SCALE);
+
+  _SetViewport();
+
+  GX_CubeBatch(blockMtx, blockGradient, blocks, 255, 
+    isFlat ? CUBE_FACE_BIT(CUBE_FACE_FRONT) : CUBE_FACES_ALL);
+
+  if (powerupBlocks)
+  {
+    if (!isFlat)
+    {
+      GX_CubeBatch(powerupBlockMtx, powerupBlockGradient, powerupBlocks, 255, 
+        CUBE_FACES_ALL & ~CUBE_FACE_BIT(CUBE_FACE_FRONT));
+    }
+
+    Render_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
+    Render_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
+
+    for (int i = 0; i < powerupBlocks; ++i)
+    {
+      imgData = powerupBlockImg[i];
+      if (!imgData)
+        continue; // already drawn with an earlier group
+
+      Menu_LoadTexObj(imgData->GetTexObj());
+
+      for (int j = i; j < powerupBlocks; ++j)
+      {
+        if (powerupBlockImg[j] == imgData)
+        {
+          Render_LoadPosMtxImm(powerupBlockMtx[j], GX_PNMTX0);
+          GX_CubeFront();
+          powerupBlockImg[j] = NULL;
+        }
+      }
     }
+
+    Render_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+    Render_SetVtxDesc(GX_VA_TEX0, GX_NONE);
   }
+
+  Render_SetViewport(0, 0, g_vmode->fbWidth, g_vmode->efbHeight, 0, 1);
 }
 
 /** If no piece is specified, then the player's current piece is drawn. */
@@ -143,7 +216,9 @@ void Player::DrawPiece(TetrisPiece* cp, u8 alpha)
 // Draw where the current piece will end up if dropped.
 void Player::DrawPieceShadow()
 {
-  if (guide == GUIDE_OFF)
+  // The shadow is a translucent pass, so it's the first thing to go when 
+  // the frame governor is over budget.
+  if (guide == GUIDE_OFF || !FrameGovernor::GetInstance().IsShadowEnabled())
     return;
 
   int y = 0;
@@ -195,6 +270,13 @@ void Player::DrawPieceShadow()
 void Player::DrawBase()
 {
   GXColor color;
+  Mtx columnMtx[MAX_PLAYFIELD_WIDTH];
+  Mtx blockMtx[MAX_PLAYFIELD_WIDTH];
+  ColorGradient blockGradient[MAX_PLAYFIELD_WIDTH];
+  guVector rowStep;
+
+  _GetColumnMatrices(columnMtx, rowStep);
+  float rowOffset = _GetRowOffset(playfieldHeight);
 
   for (int x = 0; x < playfieldWidth; ++x)
   {
@@ -202,8 +284,18 @@ void Player::DrawBase()
     u8 c = idx * 8; // black to white
     color = (GXColor){c, c, c, 255};
     _SetBaseColor(color);
-    DrawBlockAsCube(x, playfieldHeight, COLOR_ID_BASE);
+    blockGradient[x] = g_cubeGradients[COLOR_ID_BASE];
+    _GetRowMatrix(columnMtx[x], rowStep, rowOffset, blockMtx[x]);
   }
+
+  // The base is seen from the front and above, so the simplified base only 
+  // draws those faces.
+  u8 faceMask = !FrameGovernor::GetInstance().IsBaseSimplified() ? CUBE_FACES_ALL : 
+    CUBE_FACE_BIT(CUBE_FACE_TOP) | CUBE_FACE_BIT(CUBE_FACE_FRONT);
+
+  _SetViewport();
+  GX_CubeBatch(blockMtx, blockGradient, playfieldWidth, 255, faceMask);
+  Render_SetViewport(0, 0, g_vmode->fbWidth, g_vmode->efbHeight, 0, 1);
 }
 
 // Move the playfield.
@@ -409,10 +501,23 @@ void Player::DoMovement()
 // Draw each tetris piece block as a cube.
 void Player::DrawBlockAsCube(float x, float y, ColorId colorIdx, u8 alpha, GuiImageData *imgData, bool isGuideDot)
 {
-  float scale = _GetScale() / (float)DEFAULT_PLAYFIELD_SCALE;
-  if (g_isClassicMode)
-    scale -= 0.1;
+  Mtx modelview;
+
+  _SetViewport();
+  _GetBlockMatrix(x, y, isGuideDot, modelview);
+
+  // load the modelview matrix into matrix memory
+  Render_LoadPosMtxImm(modelview, GX_PNMTX0);
+  GX_Cube(colorIdx, alpha, imgData);
+  Render_SetViewport(0, 0, g_vmode->fbWidth, g_vmode->efbHeight, 0, 1);
+}
 
+//--- PRIVATE ---
+
+// Offsets the viewport so that this player's TetriCycle is drawn in its 
+// section of the screen.
+void Player::_SetViewport()
+{
   float vx = 0;
 
   if (g_options->players == 1 && !g_options->isNetplay)
@@ -445,7 +550,23 @@ void Player::DrawBlockAsCube(float x, float y, ColorId colorIdx, u8 alpha, GuiIm
       vx = 240;
   }
 
-  GX_SetViewport(vx + playfieldDX, playfieldDY, g_vmode->fbWidth, g_vmode->efbHeight, 0, 1);
+  Render_SetViewport(vx + playfieldDX, playfieldDY, g_vmode->fbWidth, g_vmode->efbHeight, 0, 1);
+}
+
+// Returns the edge length of a block; classic mode leaves gaps between blocks.
+float Player::_GetBlockScale()
+{
+  float scale = _GetScale() / (float)DEFAULT_PLAYFIELD_SCALE;
+  if (g_isClassicMode)
+    scale -= 0.1;
+
+  return scale;
+}
+
+// Calculates the modelview matrix for the block at playfield position (x,y).
+void Player::_GetBlockMatrix(float x, float y, bool isGuideDot, Mtx modelview)
+{
+  float scale = _GetBlockScale();
 
   // x should be a value in {0,...,playfield_width - 1}
   // y should be a value in {0,...,playfield_height - 1}
@@ -502,7 +623,6 @@ void Player::DrawBlockAsCube(float x, float y, ColorId colorIdx, u8 alpha, GuiIm
   guMtxConcat(mrot, mtrans, mrottrans);
 
   static Mtx model;
-  static Mtx modelview;
 
   guMtxIdentity(model);
 
@@ -528,14 +648,89 @@ void Player::DrawBlockAsCube(float x, float y, ColorId colorIdx, u8 alpha, GuiIm
   
   guMtxConcat(trans, model, model);
   guMtxConcat(g_view, model, modelview);
+}
 
-  // load the modelview matrix into matrix memory
-  GX_LoadPosMtxImm(modelview, GX_PNMTX0);
-  GX_Cube(colorIdx, alpha, imgData);
-  GX_SetViewport(0, 0, g_vmode->fbWidth, g_vmode->efbHeight, 0, 1);
+// Calculates the modelview matrix of a block in every column at row offset 
+// 0 (see _GetRowOffset). This builds the same transforms as _GetBlockMatrix, 
+// but walks outwards from the center so that each column costs two matrix 
+// concatenations instead of one per column between it and the center.
+void Player::_GetColumnMatrices(Mtx columnMtx[], guVector &rowStep)
+{
+  float scale = _GetBlockScale();
+
+  float cubeRotation = !g_isClassicMode ? cubeAngle : 0;
+  float hz = scale / 2;
+
+  static guVector cubeAxis = {0, 1, 0}; // y-axis
+
+  Mtx mscale;
+  guMtxScale(mscale, scale, scale, scale);
+
+  // Translate the cube to the correct z position; rows only differ in y.
+  Mtx trans;
+  Mtx viewtrans;
+  guMtxTrans(trans, 0, 0, -32);
+  guMtxConcat(g_view, trans, viewtrans);
+
+  int centerRight = playfieldWidth >> 1; // playfield_width / 2
+  int centerLeft  = centerRight - 1;
+
+  // The right half grows from centerRight, the left half is mirrored and 
+  // grows from centerLeft.
+  for (int side = 0; side < 2; ++side)
+  {
+    float sideScale = !side ? scale : -scale;
+    float sideRotation = !side ? cubeRotation : -cubeRotation;
+    int x  = !side ? centerRight : centerLeft;
+    int dx = !side ? 1 : -1;
+
+    Mtx mtrans;
+    Mtx mrot;
+    Mtx mrottrans;
+    Mtx halfcubetrans;
+    Mtx tail;
+    Mtx chain;
+    Mtx model;
+
+    guMtxTrans(mtrans, sideScale, 0, 0);
+    guMtxRotAxisDeg(mrot, &cubeAxis, sideRotation);
+    guMtxConcat(mrot, mtrans, mrottrans);
+    guMtxTrans(halfcubetrans, sideScale / 2, 0, -hz);
+
+    // tail = mrot * halfcubetrans * mscale
+    guMtxConcat(mrot, halfcubetrans, tail);
+    guMtxConcat(tail, mscale, tail);
+
+    guMtxIdentity(chain);
+
+    for (; x >= 0 && x < playfieldWidth; x += dx)
+    {
+      guMtxConcat(chain, tail, model);
+      guMtxConcat(viewtrans, model, columnMtx[x]);
+      guMtxConcat(chain, mrottrans, chain);
+    }
+  }
+
+  // Moving up one unit in y moves the cube along the view's y-axis.
+  rowStep.x = g_view[0][1];
+  rowStep.y = g_view[1][1];
+  rowStep.z = g_view[2][1];
 }
 
-//--- PRIVATE ---
+// Offsets a column matrix (see _GetColumnMatrices) to the given row offset.
+void Player::_GetRowMatrix(Mtx columnMtx, guVector &rowStep, float rowOffset, Mtx modelview)
+{
+  guMtxCopy(columnMtx, modelview);
+  modelview[0][3] += rowStep.x * rowOffset;
+  modelview[1][3] += rowStep.y * rowOffset;
+  modelview[2][3] += rowStep.z * rowOffset;
+}
+
+// Returns the y offset from the center of the playfield for row y.
+float Player::_GetRowOffset(int y)
+{
+  return ((playfieldHeight >> 1) - 1 - y) * _GetBlockScale(); // (playfield_height / 2) - 1
+}
 
 void Player::_GetWinner()
 {
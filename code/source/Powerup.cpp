@@ -26,13 +26,38 @@
 
 #include "Options.h"       // for Options
 #include "Player.h"        // for Player
-#include "libwiigui/gui.h" // for GuiSound
+#include "libwiigui/gui.h" // for GuiImageData, GuiSound
+#include "startup.h"       // for Startup_Load
 
 extern Options *g_options; ///< the global options
 extern Player *g_players;  ///< the player instances
 
-GuiSound *Powerup::defaultSound = 
-  new GuiSound(powerup_default_pcm, powerup_default_pcm_size, SOUND_PCM);
+PowerupSound Powerup::defaultSound = 
+  {powerup_default_pcm, &powerup_default_pcm_size, NULL};
+
+GuiImageData* PowerupImage::Get()
+{
+  if (!imageData)
+  {
+    MemTagScope tag(MEM_TAG_TEXTURE);
+    u32 start = Startup_Now();
+    imageData = new GuiImageData(png);
+    Startup_Load("powerup image", start);
+  }
+  return imageData;
+}
+
+GuiSound* PowerupSound::Get()
+{
+  if (!sound)
+  {
+    MemTagScope tag(MEM_TAG_SOUND);
+    u32 start = Startup_Now();
+    sound = new GuiSound(pcm, *size, SOUND_PCM);
+    Startup_Load("powerup sound", start);
+  }
+  return sound;
+}
 
 /**
  * Do not override this function. 
@@ -32,8 +32,8 @@
 extern Options *g_options;
 extern Player *g_players;
 
-GuiSound *PowerupUtils::invalidTargetSound = 
-  new GuiSound(powerup_invalid_target_pcm, powerup_invalid_target_pcm_size, SOUND_PCM);
+PowerupSound PowerupUtils::invalidTargetSound = 
+  {powerup_invalid_target_pcm, &powerup_invalid_target_pcm_size, NULL};
 
 Powerup* PowerupUtils::GetStaticInstance(PowerupId pid)
 {
@@ -126,4 +126,21 @@ void PowerupUtils::DeleteAllPowerups()
         powerup->Terminate();
     }
   }
+}
+
+/**
+ * Powerup assets are otherwise decoded on first use, which could stall the 
+ * first frame a powerup shows up in; call this while the startup screen is 
+ * displaying.
+ */
+void PowerupUtils::LoadAllAssets()
+{
+  vector<Powerup *> &powerupVector = Powerup::GetVector();
+  for (size_t i = 0; i < powerupVector.size(); ++i)
+  {
+    powerupVector[i]->GetImageData();
+    powerupVector[i]->GetSound();
+  }
+
+  invalidTargetSound.Get();
 }
\ No newline at end of file
@@ -0,0 +1,245 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file cube.cpp
+ * @brief Draws the unit cubes that tetris blocks are made of.
+ * @author TetriCycle contributors
+ *
+ * Split out of main.cpp so tools/cubebench can build it on the host.
+ */
+
+#include "cube.h"
+
+#include "Color.h"         // for ColorGradient, ColorId
+#include "libwiigui/gui.h" // for GuiImageData, Menu_LoadTexObj, Render_Begin
+
+extern ColorGradient g_cubeGradients[COLOR_ID_MAX]; ///< gradients for coloring the face of a tetris piece block
+
+/// Draws the textured front face of a unit cube centered at the origin.
+/** The texture must already be loaded into GX_TEXMAP0, and the TEV and 
+ *  vertex descriptor must already be set up for texturing. */
+void GX_CubeFront(u8 alpha)
+{
+  static const float unit = 0.5;
+
+  Render_Begin(GX_QUADS, GX_VTXFMT0, 4);
+  GX_Position3f32(-unit, unit, unit);   // top left
+  GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
+  GX_TexCoord2f32(0, 0);
+  GX_Position3f32(unit, unit, unit);    // top right
+  GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
+  GX_TexCoord2f32(1, 0);
+  GX_Position3f32(unit, -unit, unit);   // bottom right
+  GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
+  GX_TexCoord2f32(1, 1);
+  GX_Position3f32(-unit, -unit, unit);  // bottom left
+  GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
+  GX_TexCoord2f32(0, 1);
+  Render_End();
+}
+
+/// Draws a batch of unit cubes, each with its own modelview matrix.
+/** The cube corners are transformed on the CPU, so the whole batch goes out 
+ *  as a single primitive under an identity position matrix, instead of a 
+ *  matrix load and three primitives per cube. Only the translation and the 
+ *  three half-axes of each matrix are needed: every corner is a sum of them. 
+ *  The gu vector routines compile to paired-single code on the Wii. 
+ *  Only the faces in the faces mask are drawn (see CubeFace); e.g., the 
+ *  front faces can be left out and drawn textured with GX_CubeFront. 
+ *  Leaves an identity matrix in GX_PNMTX0. */
+void GX_CubeBatch(Mtx modelview[], const ColorGradient gradient[], int count, u8 alpha, u8 faceMask)
+{
+  // Corner index: (x > 0) | (y > 0) << 1 | (z > 0) << 2.
+  // Shade: 0 = light, 1 = medium, 2 = dark. Same faces as GX_Cube.
+  static const u8 faces[CUBE_FACE_MAX][4][2] =
+  {
+    {{2, 0}, {3, 1}, {7, 2}, {6, 1}}, // TOP
+    {{4, 0}, {5, 1}, {1, 2}, {0, 1}}, // BOTTOM
+    {{6, 0}, {7, 1}, {5, 2}, {4, 1}}, // FRONT
+    {{1, 1}, {0, 2}, {2, 1}, {3, 0}}, // BACK
+    {{6, 1}, {2, 0}, {0, 1}, {4, 2}}, // LEFT
+    {{3, 1}, {7, 0}, {5, 1}, {1, 2}}  // RIGHT
+  };
+
+  int facesPerCube = 0;
+  for (int f = 0; f < CUBE_FACE_MAX; ++f)
+  {
+    if (faceMask & CUBE_FACE_BIT(f))
+      ++facesPerCube;
+  }
+
+  if (count <= 0 || !facesPerCube)
+    return;
+
+  Mtx identity;
+  guMtxIdentity(identity);
+  Render_LoadPosMtxImm(identity, GX_PNMTX0);
+
+  Render_Begin(GX_QUADS, GX_VTXFMT0, count * facesPerCube * 4);
+
+  for (int i = 0; i < count; ++i)
+  {
+    Mtx &m = modelview[i];
+    guVector t  = {m[0][3], m[1][3], m[2][3]};
+    guVector hx = {m[0][0], m[1][0], m[2][0]};
+    guVector hy = {m[0][1], m[1][1], m[2][1]};
+    guVector hz = {m[0][2], m[1][2], m[2][2]};
+    guVecScale(&hx, &hx, 0.5f);
+    guVecScale(&hy, &hy, 0.5f);
+    guVecScale(&hz, &hz, 0.5f);
+
+    guVector back, front, xPlusY, xMinusY;
+    guVecSub(&t, &hz, &back);
+    guVecAdd(&t, &hz, &front);
+    guVecAdd(&hx, &hy, &xPlusY);
+    guVecSub(&hx, &hy, &xMinusY);
+
+    guVector corner[8];
+    guVecSub(&back, &xPlusY, &corner[0]);   // (-,-,-)
+    guVecAdd(&back, &xMinusY, &corner[1]);  // (+,-,-)
+    guVecSub(&back, &xMinusY, &corner[2]);  // (-,+,-)
+    guVecAdd(&back, &xPlusY, &corner[3]);   // (+,+,-)
+    guVecSub(&front, &xPlusY, &corner[4]);  // (-,-,+)
+    guVecAdd(&front, &xMinusY, &corner[5]); // (+,-,+)
+    guVecSub(&front, &xMinusY, &corner[6]); // (-,+,+)
+    guVecAdd(&front, &xPlusY, &corner[7]);  // (+,+,+)
+
+    const GXColor shade[3] = {gradient[i].light, gradient[i].medium, gradient[i].dark};
+
+    for (int f = 0; f < CUBE_FACE_MAX; ++f)
+    {
+      if (!(faceMask & CUBE_FACE_BIT(f)))
+        continue;
+
+      for (int v = 0; v < 4; ++v)
+      {
+        const guVector &p = corner[faces[f][v][0]];
+        const GXColor &c = shade[faces[f][v][1]];
+        GX_Position3f32(p.x, p.y, p.z);
+        GX_Color4u8(c.r, c.g, c.b, alpha);
+      }
+    }
+  }
+
+  Render_End();
+}
+
+/// Draws a unit cube centered at the origin.
+/** If imgData is given and isFrontDrawn is false, the textured front face is 
+ *  skipped so the caller can batch it later with GX_CubeFront. */
+void GX_Cube(int colorIdx, u8 alpha, GuiImageData *imgData, bool isFrontDrawn)
+{
+  ColorGradient &gradient = g_cubeGradients[colorIdx];
+
+  u8 lightR = gradient.light.r;
+  u8 lightG = gradient.light.g;
+  u8 lightB = gradient.light.b;
+
+  u8 mediumR = gradient.medium.r;
+  u8 mediumG = gradient.medium.g;
+  u8 mediumB = gradient.medium.b;
+
+  u8 darkR = gradient.dark.r;
+  u8 darkG = gradient.dark.g;
+  u8 darkB = gradient.dark.b;
+  
+  static const float unit = 0.5;
+
+  Render_Begin(GX_QUADS, GX_VTXFMT0, 8);
+    //--- TOP quad ---
+    GX_Position3f32(-unit, unit, -unit);  // top left
+    GX_Color4u8(lightR, lightG, lightB, alpha);
+    GX_Position3f32(unit, unit, -unit);   // top right
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(unit, unit, unit);    // bottom right
+    GX_Color4u8(darkR, darkG, darkB, alpha);
+    GX_Position3f32(-unit, unit, unit);   // bottom left
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+
+    //--- BOTTOM quad ---
+    GX_Position3f32(-unit, -unit, unit);  // top left
+    GX_Color4u8(lightR, lightG, lightB, alpha);
+    GX_Position3f32(unit, -unit, unit);   // top right
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(unit, -unit, -unit);  // bottom right
+    GX_Color4u8(darkR, darkG, darkB, alpha);
+    GX_Position3f32(-unit, -unit, -unit); // bottom left
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+  Render_End();
+
+  //--- FRONT quad ---
+  if (!imgData)
+  {
+    Render_Begin(GX_QUADS, GX_VTXFMT0, 4);
+    GX_Position3f32(-unit, unit, unit);   // top left
+    GX_Color4u8(lightR, lightG, lightB, alpha);
+    GX_Position3f32(unit, unit, unit);    // top right
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(unit, -unit, unit);   // bottom right
+    GX_Color4u8(darkR, darkG, darkB, alpha);
+    GX_Position3f32(-unit, -unit, unit);  // bottom left
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    Render_End();
+  }
+  else if (isFrontDrawn)
+  {
+    Menu_LoadTexObj(imgData->GetTexObj());
+
+    Render_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
+    Render_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
+
+    GX_CubeFront(alpha);
+
+    Render_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+    Render_SetVtxDesc(GX_VA_TEX0, GX_NONE);
+  }
+
+  Render_Begin(GX_QUADS, GX_VTXFMT0, 12);
+    //--- BACK quad ---
+    GX_Position3f32(unit, -unit, -unit);  // bottom left
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(-unit, -unit, -unit); // bottom right
+    GX_Color4u8(darkR, darkG, darkB, alpha);
+    GX_Position3f32(-unit, unit, -unit);  // top right
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(unit, unit, -unit);   // top left
+    GX_Color4u8(lightR, lightG, lightB, alpha);
+
+    //--- LEFT quad ---
+    GX_Position3f32(-unit, unit, unit);   // top right
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(-unit, unit, -unit);  // top left
+    GX_Color4u8(lightR, lightG, lightB, alpha);
+    GX_Position3f32(-unit, -unit, -unit); // bottom left
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(-unit, -unit, unit);  // bottom right
+    GX_Color4u8(darkR, darkG, darkB, alpha);
+
+    //--- RIGHT quad ---
+    GX_Position3f32(unit, unit, -unit);  // top right
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(unit, unit, unit);   // top left
+    GX_Color4u8(lightR, lightG, lightB, alpha);
+    GX_Position3f32(unit, -unit, unit);  // bottom left
+    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
+    GX_Position3f32(unit, -unit, -unit); // bottom right
+    GX_Color4u8(darkR, darkG, darkB, alpha);
+  Render_End();
+}
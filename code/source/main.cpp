@@ -63,13 +63,20 @@
 #include "menu.h"       // for InitVideo
 #include "Options.h"    // for Options
 #include "Player.h"     // for Player
+#include "framedump.h"  // for FrameDump_Frame
+#include "framearena.h" // for FrameArena_Reset
+#include "memtrack.h"   // for MemTrack_EndFrame, MemTagScope
+#include "startup.h"    // for Startup_Mark
+#include "assets.h"     // for Assets_Init, Assets_Acquire
+#include "FrameGovernor.h" // for FrameGovernor
+#include "HudText.h"    // for HudText
+#include "DebugOverlay.h" // for DebugOverlay
+#include "PhaseProfiler.h" // for PROF_SCOPE
 
-// include generated headers
-#include "tetris_mod.h"
 #include "pieces_bin.h"
+#include "fonts_baked_bin.h"
 
 extern TetrisPieceDesc g_pieceDesc[TETRISPIECE_ID_MAX][4]; ///< static description of every tetris piece for all 4 rotations
-extern ColorGradient g_cubeGradients[COLOR_ID_MAX]; ///< gradients for coloring the face of a tetris piece block
 extern Player *g_players;   ///< the player instances
 extern u32 *g_xfb[2];       ///< the external frame buffer
 extern GXRModeObj *g_vmode; ///< the video mode
@@ -118,15 +125,27 @@ static void TCYC_GameOnExit();
 
 int main()
 {
+  Startup_Mark("main");
+
   // VIDEO and GX initialization is handled by video#InitVideo.
   // PAD and WPAD initialization is handled by input#SetupPads
   // AUDIO and ASND init is handled by audio#InitAudio
   InitVideo(); // Initialize video
+  Startup_Mark("video");
   SetupPads(); // Initialize input
+  Startup_Mark("pads");
   InitAudio(); // Initialize audio
+  Startup_Mark("audio");
   fatInitDefault(); // Initialize file system
+  Startup_Mark("fat");
   InitFreeType((u8*)font_ttf, font_ttf_size); // Initialize font system
+  Startup_Mark("freetype");
+  InitBakedFonts((u8*)fonts_baked_bin, fonts_baked_bin_size); // Use pre-rendered font sizes
+  Startup_Mark("baked fonts");
   InitGUIThreads(); // Initialize GUI
+  Startup_Mark("gui threads");
+  Assets_Init(assets_pak, assets_pak_size); // Initialize packed assets
+  Startup_Mark("assets");
 
   // Initialize the view matrix.
   // Setup the camera at the origin, looking down the -z axis with y up.
@@ -148,19 +167,30 @@ int main()
   pointer[1] = new GuiImageData(player2_point_png);
   pointer[2] = new GuiImageData(player3_point_png);
   pointer[3] = new GuiImageData(player4_point_png);
+  Startup_Mark("pointers");
 
   // Initialize TetriCycle settings.
   // Vertex data initialization is handled by video#ResetVideo_Menu.
   TCYC_InitPieceDescriptions();
+  Startup_Mark("piece descriptions");
   MODPlay_Init(&g_modPlay);
-  MODPlay_SetMOD(&g_modPlay, tetris_mod);
+  const u8 *mod = Assets_Acquire("tetris.mod", MEM_TAG_MUSIC, NULL);
+  u32 heapUsed = MemTrack_HeapUsed(); // MODPlay allocates the samples itself
+  MODPlay_SetMOD(&g_modPlay, mod);
+  MemTrack_AddExternal(MEM_TAG_MUSIC, MemTrack_HeapUsed() - heapUsed);
+  Assets_Release("tetris.mod"); // MODPlay keeps its own copy
+  Startup_Mark("mod");
   g_totalPowerups = PowerupUtils::GetTotalPowerups();
 
   // Options and Players must be initialized after setting g_totalPowerups!
   g_options = &Options::GetInstance(); // the global options
-  g_players = new Player[MAX_PLAYERS];
+  {
+    MemTagScope tag(MEM_TAG_GAME);
+    g_players = new Player[MAX_PLAYERS];
+  }
   for (int i = 0; i < MAX_PLAYERS; ++i)
     g_players[i].id = i;
+  Startup_Mark("options and players");
 
   // Enter the game state loop.
   TCYC_MenuLoop();
@@ -173,6 +203,7 @@ void TCYC_Game()
 
   while (true)
   {
+    FrameGovernor::GetInstance().BeginFrame();
     TCYC_Update();
 
     // Do this here so the screen doesn't flicker when the game is quit.
@@ -181,6 +212,7 @@ void TCYC_Game()
 
     TCYC_Draw();
     TCYC_Render();
+    PROF_END_FRAME();
   }
 
   TCYC_GameOnExit();
@@ -189,11 +221,20 @@ void TCYC_Game()
 /// Updates the game.
 void TCYC_Update()
 {
-  ALL_ScanPads();
-  TCYC_ProcessInput();
+  PROF_SCOPE(PROF_UPDATE);
+  MemTagScope tag(MEM_TAG_GAME); // pieces and powerups
+
+  {
+    PROF_SCOPE(PROF_INPUT);
+    ALL_ScanPads();
+    TCYC_ProcessInput();
+  }
 
   for (int i = 0; i < g_options->players; ++i)
+  {
+    PROF_SCOPE_PLAYER(PROF_PLAYER_UPDATE, i);
     g_players[i].Update();
+  }
 
   if (!g_tetrisCheerSound->IsPlaying())
     MODPlay_Pause(&g_modPlay, 0); // unpause music
@@ -202,26 +243,42 @@ void TCYC_Update()
 /// Draws the game.
 void TCYC_Draw()
 {
+  PROF_SCOPE(PROF_DRAW);
   TCYC_SetUp2D();
-  TCYC_DrawPlayfieldBoundary();
-  TCYC_DrawText();
+
+  {
+    PROF_SCOPE(PROF_BOUNDARY);
+    TCYC_DrawPlayfieldBoundary();
+  }
+
+  {
+    PROF_SCOPE(PROF_TEXT);
+    TCYC_DrawText();
+  }
 
   TCYC_DrawTetriCycle();
 
   if (g_options->players > 1)
   {
+    PROF_SCOPE(PROF_DRAW_POWERUPS);
     TCYC_SetUp2D();
     TCYC_DrawPowerups();
   }
+
+#if DEBUG
+  static DebugOverlay overlay;
+  TCYC_SetUp2D();
+  overlay.Draw();
+#endif
 }
 
 /// Prepares for drawing 2D.
 void TCYC_SetUp2D()
 {
   // Prepare for drawing 2D.
-  GX_SetZMode(GX_FALSE, GX_LEQUAL, GX_TRUE);
-  GX_LoadPosMtxImm(GXmodelView2D, GX_PNMTX0);
-  GX_LoadProjectionMtx(orthographic, GX_ORTHOGRAPHIC);
+  Render_SetZMode(GX_FALSE, GX_LEQUAL, GX_TRUE);
+  Render_LoadPosMtxImm(GXmodelView2D, GX_PNMTX0);
+  Render_LoadProjectionMtx(orthographic, GX_ORTHOGRAPHIC);
 }
 
 /// Draws the playfield boundary for every player.
@@ -230,7 +287,7 @@ void TCYC_DrawPlayfieldBoundary()
   switch (g_options->players)
   {
     case 1:
-      GX_Begin(GX_QUADS, GX_VTXFMT0, 4);
+      Render_Begin(GX_QUADS, GX_VTXFMT0, 4);
         //--- 1P quad ---
         GX_Position3f32(0, 0, 0);     // top left
         GX_Color4u8(0, 0, 20, 255);
@@ -240,11 +297,11 @@ void TCYC_DrawPlayfieldBoundary()
         GX_Color4u8(195, 195, 215, 255);
         GX_Position3f32(0, 480, 0);   // bottom left
         GX_Color4u8(88, 88, 108, 255);
-      GX_End();
+      Render_End();
     break;
 
     case 2:
-      GX_Begin(GX_QUADS, GX_VTXFMT0, 8);
+      Render_Begin(GX_QUADS, GX_VTXFMT0, 8);
         //--- 1P quad ---
         GX_Position3f32(0, 0, 0);             // top left
         GX_Color4u8(0, 0, 20, 255);
@@ -264,11 +321,11 @@ void TCYC_DrawPlayfieldBoundary()
         GX_Color4u8(195, 195, 215, 255);
         GX_Position3f32(P2_X_BORDER, 480, 0); // bottom left
         GX_Color4u8(88, 88, 108, 255);
-      GX_End();
+      Render_End();
     break;
 
     case 3:
-      GX_Begin(GX_QUADS, GX_VTXFMT0, 12);
+      Render_Begin(GX_QUADS, GX_VTXFMT0, 12);
         //--- 1P quad ---
         GX_Position3f32(0, 0, 0);               // top left
         GX_Color4u8(0, 0, 20, 255);
@@ -298,11 +355,11 @@ void TCYC_DrawPlayfieldBoundary()
         GX_Color4u8(195, 195, 215, 255);
         GX_Position3f32(P3_X_BORDER_2, 480, 0); // bottom left
         GX_Color4u8(88, 88, 108, 255);
-      GX_End();
+      Render_End();
     break;
 
     case 4:
-      GX_Begin(GX_QUADS, GX_VTXFMT0, 16);
+      Render_Begin(GX_QUADS, GX_VTXFMT0, 16);
         //--- 1P quad ---
         GX_Position3f32(0, 0, 0);               // top left
         GX_Color4u8(0, 0, 20, 255);
@@ -342,57 +399,18 @@ void TCYC_DrawPlayfieldBoundary()
         GX_Color4u8(195, 195, 215, 255);
         GX_Position3f32(P4_X_BORDER_3, 480, 0); // bottom left
         GX_Color4u8(88, 88, 108, 255);
-      GX_End();
+      Render_End();
     break;
   }
 }
 
 /// Draws in-game text such as lines, score, level.
+/** The text is retained between frames (see HudText), so steady-state 
+ *  drawing doesn't allocate. */
 void TCYC_DrawText()
 {
-  // Draw text. Add 2D effects such as lines, score, level.
-  static const u8 a = 64; // alpha: 0 = transparent, 255 = opaque
-  GXColor txtColor = !g_options->isPaused ? 
-    (GXColor){255, 255, 255, a} : (GXColor){255, 255, 255, 255};
-  GXColor deadColor = (GXColor){200, 0, 0, 255};
-  
-  GuiText txt(NULL, 28, txtColor); 
-  txt.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-
-  char buf[5]; // allows for max value of 9999
-  int player_x = 10, txt_dx = 100, y = 0, dy = 32;
-  int player_dx = screenwidth / g_options->players; // assume: g_options->netplay == 0
-
-  for (int i = 0; i < g_options->players; ++i, player_x += player_dx)
-  {
-    y = 0;
-    txt.SetColor(!g_players[i].gameData.isDead ? txtColor : deadColor);
-
-    // Draw lines, score, level.
-    txt.SetText("lines:");
-    txt.SetPosition(player_x, y += dy);
-    txt.Draw();
-    sprintf(buf, "%d", g_players[i].gameData.lines);
-    txt.SetText(buf);
-    txt.SetPosition(player_x + txt_dx, y);
-    txt.Draw();
-
-    txt.SetText("score:");
-    txt.SetPosition(player_x, y += dy);
-    txt.Draw();
-    sprintf(buf, "%d", g_players[i].gameData.score);
-    txt.SetText(buf);
-    txt.SetPosition(player_x + txt_dx, y);
-    txt.Draw();
-
-    txt.SetText("level:");
-    txt.SetPosition(player_x, y += dy);
-    txt.Draw();
-    sprintf(buf, "%d", g_players[i].gameData.level);
-    txt.SetText(buf);
-    txt.SetPosition(player_x + txt_dx, y);
-    txt.Draw();
-  }
+  static HudText hud;
+  hud.Draw();
 }
 
 /// Returns the player associated with the passed in x-coordinate.
@@ -483,16 +501,16 @@ void TCYC_DrawPowerupBorders()
     y = 0;
 
     // powerup queue
-    GX_Begin(GX_LINESTRIP, GX_VTXFMT0, 2);
+    Render_Begin(GX_LINESTRIP, GX_VTXFMT0, 2);
     GX_Position3f32(borders[i+1] - POWERUP_X_OFFSET - POWERUP_WIDTH, POWERUP_Y_OFFSET, 0); // top left
     GX_Color4u8(0, 0, 0, 255);
     GX_Position3f32(borders[i+1] - POWERUP_X_OFFSET, POWERUP_Y_OFFSET, 0); // top right
     GX_Color4u8(0, 0, 0, 255);
-    GX_End();
+    Render_End();
   
     for (int j = 0; j < MAX_ACQUIRED_POWERUPS; ++j, y += POWERUP_WIDTH)
     {
-      GX_Begin(GX_LINESTRIP, GX_VTXFMT0, 4);
+      Render_Begin(GX_LINESTRIP, GX_VTXFMT0, 4);
       GX_Position3f32(borders[i+1] - POWERUP_X_OFFSET - POWERUP_WIDTH, y + POWERUP_Y_OFFSET, 0); // top left
       GX_Color4u8(0, 0, 0, 255);
       GX_Position3f32(borders[i+1] - POWERUP_X_OFFSET - POWERUP_WIDTH, y + POWERUP_Y_OFFSET + POWERUP_WIDTH, 0); // bottom left
@@ -501,20 +519,20 @@ void TCYC_DrawPowerupBorders()
       GX_Color4u8(0, 0, 0, 255);
       GX_Position3f32(borders[i+1] - POWERUP_X_OFFSET, y + POWERUP_Y_OFFSET, 0); // top right
       GX_Color4u8(0, 0, 0, 255);
-      GX_End();
+      Render_End();
     }
 
     // effects queue
-    GX_Begin(GX_LINESTRIP, GX_VTXFMT0, 2);
+    Render_Begin(GX_LINESTRIP, GX_VTXFMT0, 2);
     GX_Position3f32(borders[i] + POWERUP_X_OFFSET, 480 - POWERUP_Y_OFFSET - POWERUP_WIDTH, 0); // top left
     GX_Color4u8(0, 0, 0, 255);
     GX_Position3f32(borders[i] + POWERUP_X_OFFSET, 480 - POWERUP_Y_OFFSET, 0); // bottom left
     GX_Color4u8(0, 0, 0, 255);
-    GX_End();
+    Render_End();
 
     for (int j = 0; j < MAX_POWERUP_EFFECTS; ++j, x += POWERUP_WIDTH)
     {
-      GX_Begin(GX_LINESTRIP, GX_VTXFMT0, 4);
+      Render_Begin(GX_LINESTRIP, GX_VTXFMT0, 4);
       GX_Position3f32(borders[i] + POWERUP_X_OFFSET + x, 480 - POWERUP_Y_OFFSET - POWERUP_WIDTH, 0); // top left
       GX_Color4u8(0, 0, 0, 255);
       GX_Position3f32(borders[i] + POWERUP_X_OFFSET + POWERUP_WIDTH + x, 480 - POWERUP_Y_OFFSET - POWERUP_WIDTH, 0); // top right
@@ -523,24 +541,16 @@ void TCYC_DrawPowerupBorders()
       GX_Color4u8(0, 0, 0, 255);
       GX_Position3f32(borders[i] + POWERUP_X_OFFSET + x, 480 - POWERUP_Y_OFFSET, 0); // bottom left
       GX_Color4u8(0, 0, 0, 255);
-      GX_End();
+      Render_End();
     }
   }
 }
 
-/// Draws a powerup texture.
-/** (x,y) corresponds to the upper left corner. */
-void TCYC_DrawPowerupTexture(int x, int y, GuiImageData *imgData, u8 alpha)
+/// Emits the vertices of a textured powerup quad.
+/** (x,y) corresponds to the upper left corner. Must be called between 
+ *  Render_Begin and Render_End. */
+static inline void TCYC_PowerupQuad(int x, int y, u8 alpha)
 {
-  GX_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
-  GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
-
-  GXTexObj texObj;
-  GX_InitTexObj(&texObj, imgData->GetImage(), imgData->GetWidth(), imgData->GetHeight(), GX_TF_RGBA8, GX_CLAMP, GX_CLAMP, GX_FALSE);
-  GX_LoadTexObj(&texObj, GX_TEXMAP0);
-  GX_InvalidateTexAll();
-
-  GX_Begin(GX_QUADS, GX_VTXFMT0, 4);
   GX_Position3f32(x, y, 0); // top left
   GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
   GX_TexCoord2f32(0, 0);
@@ -553,25 +563,49 @@ void TCYC_DrawPowerupTexture(int x, int y, GuiImageData *imgData, u8 alpha)
   GX_Position3f32(x, y + POWERUP_WIDTH, 0); // bottom left
   GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
   GX_TexCoord2f32(0, 1);
-  GX_End();
+}
+
+/// Draws a powerup texture.
+/** (x,y) corresponds to the upper left corner. */
+void TCYC_DrawPowerupTexture(int x, int y, GuiImageData *imgData, u8 alpha)
+{
+  Render_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
+  Render_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
+
+  Menu_LoadTexObj(imgData->GetTexObj());
 
-  GX_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
-  GX_SetVtxDesc(GX_VA_TEX0, GX_NONE);
+  Render_Begin(GX_QUADS, GX_VTXFMT0, 4);
+  TCYC_PowerupQuad(x, y, alpha);
+  Render_End();
+
+  Render_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+  Render_SetVtxDesc(GX_VA_TEX0, GX_NONE);
 }
 
 /// Draws the textures for all the on-screen powerups.
+/** The quads are grouped by texture, so every powerup image is loaded once 
+ *  and drawn in a single batch. */
 void TCYC_DrawPowerupTextures()
 {
   static const int yoffset = POWERUP_Y_OFFSET;
   static const int xoffset = POWERUP_X_OFFSET;
   static const int width = POWERUP_WIDTH;
 
+  /// An on-screen powerup; (x,y) corresponds to the upper left corner.
+  struct PowerupQuad
+  {
+    GuiImageData *imgData;
+    int x;
+    int y;
+    u8 alpha;
+  };
+
+  static PowerupQuad quads[MAX_PLAYERS * (MAX_ACQUIRED_POWERUPS + MAX_POWERUP_EFFECTS)];
+  int totalQuads = 0;
+
   int x;
   int y;
-  u8 alpha;
   Powerup *powerup;
-  GuiImageData *imgData;
-  GXTexObj texObj;
 
   int borders[MAX_PLAYERS+1];
   borders[0] = 0;
@@ -593,14 +627,10 @@ void TCYC_DrawPowerupTextures()
       break;
   }
 
-  GX_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
-  GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
-
   for (int i = 0; i < g_options->players; ++i)
   {
     x = 0;
     y = 0;
-    alpha = 128;
 
     // powerup queue
     for (int j = 0; j < MAX_ACQUIRED_POWERUPS; ++j, y += width)
@@ -608,61 +638,58 @@ void TCYC_DrawPowerupTextures()
       powerup = g_players[i].gameData.powerupQueue[j];
       if (powerup)
       {
-        imgData = powerup->GetImageData();
-        GX_InitTexObj(&texObj, imgData->GetImage(), imgData->GetWidth(), imgData->GetHeight(), GX_TF_RGBA8, GX_CLAMP, GX_CLAMP, GX_FALSE);
-        GX_LoadTexObj(&texObj, GX_TEXMAP0);
-        GX_InvalidateTexAll();
-
-        GX_Begin(GX_QUADS, GX_VTXFMT0, 4);
-        GX_Position3f32(borders[i+1] - xoffset - width, y + yoffset, 0); // top left
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(0, 0);
-        GX_Position3f32(borders[i+1] - xoffset, y + yoffset, 0); // top right
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(1, 0);
-        GX_Position3f32(borders[i+1] - xoffset, y + yoffset + width, 0); // bottom right
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(1, 1);
-        GX_Position3f32(borders[i+1] - xoffset - width, y + yoffset + width, 0); // bottom left
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(0, 1);
-        GX_End();
+        quads[totalQuads++] = (PowerupQuad){powerup->GetImageData(), 
+          borders[i+1] - xoffset - width, y + yoffset, 128};
       }
     }
 
-    alpha = 64;
-
     // effects queue
     for (int j = 0; j < MAX_POWERUP_EFFECTS; ++j, x += width)
     {
       powerup = g_players[i].gameData.powerupEffects[j];
       if (powerup)
       {
-        imgData = powerup->GetImageData();
-        GX_InitTexObj(&texObj, imgData->GetImage(), imgData->GetWidth(), imgData->GetHeight(), GX_TF_RGBA8, GX_CLAMP, GX_CLAMP, GX_FALSE);
-        GX_LoadTexObj(&texObj, GX_TEXMAP0);
-        GX_InvalidateTexAll();
-
-        GX_Begin(GX_QUADS, GX_VTXFMT0, 4);
-        GX_Position3f32(borders[i] + xoffset + x, 480 - yoffset - width, 0); // top left
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(0, 0);
-        GX_Position3f32(borders[i] + xoffset + width + x, 480 - yoffset - width, 0); // top right
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(1, 0);
-        GX_Position3f32(borders[i] + xoffset + width + x, 480 - yoffset, 0); // bottom right
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(1, 1);
-        GX_Position3f32(borders[i] + xoffset + x, 480 - yoffset, 0); // bottom left
-        GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-        GX_TexCoord2f32(0, 1);
-        GX_End();
+        quads[totalQuads++] = (PowerupQuad){powerup->GetImageData(), 
+          borders[i] + xoffset + x, 480 - yoffset - width, 64};
+      }
+    }
+  }
+
+  if (!totalQuads)
+    return;
+
+  Render_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
+  Render_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
+
+  for (int i = 0; i < totalQuads; ++i)
+  {
+    GuiImageData *imgData = quads[i].imgData;
+    if (!imgData)
+      continue; // already drawn with an earlier group
+
+    int groupSize = 0;
+    for (int j = i; j < totalQuads; ++j)
+    {
+      if (quads[j].imgData == imgData)
+        ++groupSize;
+    }
+
+    Menu_LoadTexObj(imgData->GetTexObj());
+
+    Render_Begin(GX_QUADS, GX_VTXFMT0, groupSize * 4);
+    for (int j = i; j < totalQuads; ++j)
+    {
+      if (quads[j].imgData == imgData)
+      {
+        TCYC_PowerupQuad(quads[j].x, quads[j].y, quads[j].alpha);
+        quads[j].imgData = NULL;
       }
     }
+    Render_End();
   }
 
-  GX_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
-  GX_SetVtxDesc(GX_VA_TEX0, GX_NONE);
+  Render_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+  Render_SetVtxDesc(GX_VA_TEX0, GX_NONE);
 }
 
 /// Draws the on-screen powerups.
@@ -717,7 +744,7 @@ void TCYC_DrawPowerups()
           imgData = GRAB_HELD(i) ? debug_grabber4 : pointer[i];
           break;
       }
-      Menu_DrawImg(x - 48, y - 48, 96, 96, imgData->GetImage(), userInput[i].wpad->ir.angle, scale, scale, alpha);
+      Menu_DrawTexObj(x - 48, y - 48, 96, 96, imgData->GetTexObj(), userInput[i].wpad->ir.angle, scale, scale, alpha);
     }
 
     DoRumble(i);
@@ -728,11 +755,12 @@ void TCYC_DrawPowerups()
 void TCYC_DrawTetriCycle()
 {
   // Prepare for drawing TetriCycle
-  GX_SetZMode(GX_TRUE, GX_LEQUAL, GX_TRUE);
-  GX_LoadProjectionMtx(projection, GX_PERSPECTIVE);
+  Render_SetZMode(GX_TRUE, GX_LEQUAL, GX_TRUE);
+  Render_LoadProjectionMtx(projection, GX_PERSPECTIVE);
 
   for (int i = 0; i < g_options->players; ++i)
   {
+    PROF_SCOPE_PLAYER(PROF_CYLINDER, i);
     Player &player = g_players[i];
     player.DrawPlayfield();
     player.DrawNextPiece();
@@ -745,138 +773,42 @@ void TCYC_DrawTetriCycle()
 /// Renders the game.
 void TCYC_Render()
 {
+  PROF_SCOPE(PROF_RENDER);
   static int currFrame = 0;
   currFrame ^= 1; // flip framebuffer
 
-  GX_CopyDisp(g_xfb[currFrame], GX_TRUE);
-  GX_DrawDone();
+  FrameGovernor &governor = FrameGovernor::GetInstance();
+  governor.EndCpu();
 
-  VIDEO_SetNextFramebuffer(g_xfb[currFrame]);
-  VIDEO_Flush();   
-  VIDEO_WaitVSync();
-
-  for (int i = 0; i < g_options->players; ++i)
-    g_players[i].gameData.frame++;
-}
+  {
+    PROF_SCOPE(PROF_COPYDISP);
+    GX_CopyDisp(g_xfb[currFrame], GX_TRUE);
+  }
 
-/// Draws a unit cube centered at the origin.
-void GX_Cube(int colorIdx, u8 alpha, GuiImageData *imgData)
-{
-  ColorGradient &gradient = g_cubeGradients[colorIdx];
+  {
+    PROF_SCOPE(PROF_DRAWDONE);
+    GX_DrawDone();
+  }
 
-  u8 lightR = gradient.light.r;
-  u8 lightG = gradient.light.g;
-  u8 lightB = gradient.light.b;
+  governor.EndFrame();
+  Render_EndFrame();
+#if DEBUG
+  Render_DumpCapture("sd:/tetricycle_frame.txt");
+#endif
+  FrameDump_Frame(g_xfb[currFrame]);
+  FrameArena_Reset(); // transient buffers of this frame are done
+  MemTrack_EndFrame();
 
-  u8 mediumR = gradient.medium.r;
-  u8 mediumG = gradient.medium.g;
-  u8 mediumB = gradient.medium.b;
+  VIDEO_SetNextFramebuffer(g_xfb[currFrame]);
+  VIDEO_Flush();   
 
-  u8 darkR = gradient.dark.r;
-  u8 darkG = gradient.dark.g;
-  u8 darkB = gradient.dark.b;
-  
-  static const float unit = 0.5;
-
-  GX_Begin(GX_QUADS, GX_VTXFMT0, 8);
-    //--- TOP quad ---
-    GX_Position3f32(-unit, unit, -unit);  // top left
-    GX_Color4u8(lightR, lightG, lightB, alpha);
-    GX_Position3f32(unit, unit, -unit);   // top right
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(unit, unit, unit);    // bottom right
-    GX_Color4u8(darkR, darkG, darkB, alpha);
-    GX_Position3f32(-unit, unit, unit);   // bottom left
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-
-    //--- BOTTOM quad ---
-    GX_Position3f32(-unit, -unit, unit);  // top left
-    GX_Color4u8(lightR, lightG, lightB, alpha);
-    GX_Position3f32(unit, -unit, unit);   // top right
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(unit, -unit, -unit);  // bottom right
-    GX_Color4u8(darkR, darkG, darkB, alpha);
-    GX_Position3f32(-unit, -unit, -unit); // bottom left
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-  GX_End();
-
-  //--- FRONT quad ---
-  if (!imgData)
   {
-    GX_Begin(GX_QUADS, GX_VTXFMT0, 4);
-    GX_Position3f32(-unit, unit, unit);   // top left
-    GX_Color4u8(lightR, lightG, lightB, alpha);
-    GX_Position3f32(unit, unit, unit);    // top right
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(unit, -unit, unit);   // bottom right
-    GX_Color4u8(darkR, darkG, darkB, alpha);
-    GX_Position3f32(-unit, -unit, unit);  // bottom left
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_End();
-  }
-  else
-  {
-    GXTexObj texObj;
-
-    int width  = imgData->GetWidth();
-    int height = imgData->GetHeight();
-    GX_InitTexObj(&texObj, imgData->GetImage(), width, height, GX_TF_RGBA8, GX_CLAMP, GX_CLAMP, GX_FALSE);
-    GX_LoadTexObj(&texObj, GX_TEXMAP0);
-    GX_InvalidateTexAll();
-
-    GX_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
-    GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
-
-    GX_Begin(GX_QUADS, GX_VTXFMT0, 4);
-    GX_Position3f32(-unit, unit, unit);   // top left
-    GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-    GX_TexCoord2f32(0, 0);
-    GX_Position3f32(unit, unit, unit);    // top right
-    GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-    GX_TexCoord2f32(1, 0);
-    GX_Position3f32(unit, -unit, unit);   // bottom right
-    GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-    GX_TexCoord2f32(1, 1);
-    GX_Position3f32(-unit, -unit, unit);  // bottom left
-    GX_Color4u8(0xFF, 0xFF, 0xFF, alpha);
-    GX_TexCoord2f32(0, 1);
-    GX_End();
-
-    GX_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
-    GX_SetVtxDesc(GX_VA_TEX0, GX_NONE);
+    PROF_SCOPE(PROF_VSYNC);
+    VIDEO_WaitVSync();
   }
 
-  GX_Begin(GX_QUADS, GX_VTXFMT0, 12);
-    //--- BACK quad ---
-    GX_Position3f32(unit, -unit, -unit);  // bottom left
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(-unit, -unit, -unit); // bottom right
-    GX_Color4u8(darkR, darkG, darkB, alpha);
-    GX_Position3f32(-unit, unit, -unit);  // top right
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(unit, unit, -unit);   // top left
-    GX_Color4u8(lightR, lightG, lightB, alpha);
-
-    //--- LEFT quad ---
-    GX_Position3f32(-unit, unit, unit);   // top right
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(-unit, unit, -unit);  // top left
-    GX_Color4u8(lightR, lightG, lightB, alpha);
-    GX_Position3f32(-unit, -unit, -unit); // bottom left
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(-unit, -unit, unit);  // bottom right
-    GX_Color4u8(darkR, darkG, darkB, alpha);
-
-    //--- RIGHT quad ---
-    GX_Position3f32(unit, unit, -unit);  // top right
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(unit, unit, unit);   // top left
-    GX_Color4u8(lightR, lightG, lightB, alpha);
-    GX_Position3f32(unit, -unit, unit);  // bottom left
-    GX_Color4u8(mediumR, mediumG, mediumB, alpha);
-    GX_Position3f32(unit, -unit, -unit); // bottom right
-    GX_Color4u8(darkR, darkG, darkB, alpha);
-  GX_End();
+  for (int i = 0; i < g_options->players; ++i)
+    g_players[i].gameData.frame++;
 }
 
 /// Runs the "edit playfield" loop.
@@ -1301,8 +1233,8 @@ void TCYC_DrawEditMode()
 void TCYC_DrawTetriCycleEditMode()
 {
   // Prepare for drawing TetriCycle
-  GX_SetZMode(GX_TRUE, GX_LEQUAL, GX_TRUE);
-  GX_LoadProjectionMtx(projection, GX_PERSPECTIVE);
+  Render_SetZMode(GX_TRUE, GX_LEQUAL, GX_TRUE);
+  Render_LoadProjectionMtx(projection, GX_PERSPECTIVE);
 
   int width;
   int height;
@@ -1344,9 +1276,9 @@ void TCYC_DrawEditPlayfieldMenu()
   {
     if (userInput[i].wpad->ir.valid)
     {
-	    Menu_DrawImg(userInput[i].wpad->ir.x - 48, userInput[i].wpad->ir.y - 48,
-		               96, 96, pointer[i]->GetImage(), userInput[i].wpad->ir.angle, 
-                   1, 1, 255);
+	    Menu_DrawTexObj(userInput[i].wpad->ir.x - 48, userInput[i].wpad->ir.y - 48,
+		                  96, 96, pointer[i]->GetTexObj(), userInput[i].wpad->ir.angle, 
+                      1, 1, 255);
     }
 
     DoRumble(i);
@@ -1359,9 +1291,16 @@ void TCYC_DrawEditPlayfieldMenu()
 /// Initializes the game state.
 void TCYC_GameInit()
 {
+  u32 cheerSize;
+  const u8 *cheer = Assets_Acquire("tetris_cheer.pcm", MEM_TAG_SOUND, &cheerSize);
+  g_tetrisCheerSound = new GuiSound(cheer, cheerSize, SOUND_PCM);
+  g_tetrisCheerSound->SetPriority(MIXER_PRIORITY_HIGH);
+
   MODPlay_Start(&g_modPlay);
   sgenrand(time(NULL));
   g_tcycMenu = TCYC_MENU_NONE;
+  FrameGovernor::GetInstance().Reset();
+  PROF_RESET(); // the trace dumped on exit covers just this match
   
   for (int i = 0; i < g_options->players; ++i)
     g_players[i].Reset();
@@ -1372,9 +1311,23 @@ void TCYC_GameOnExit()
 {
   MODPlay_Stop(&g_modPlay);
 
+  // The cheer is only needed during a match; ASND must be done with it first.
+  g_tetrisCheerSound->Stop();
+  delete g_tetrisCheerSound;
+  g_tetrisCheerSound = NULL;
+  Assets_Release("tetris_cheer.pcm");
+
   // We have to delete any powerups from a previous game before 
   // memset'ing the PlayerGameData.
   PowerupUtils::DeleteAllPowerups();
+
+#if DEBUG
+  // Keep the heap use and frame timings of every match for offline review.
+  MemTrack_Dump("sd:/tetricycle_mem.txt");
+#if PHASE_PROFILER
+  PhaseProfiler::GetInstance().DumpTrace("sd:/tetricycle_trace.json");
+#endif
+#endif
 }
 
 /// Initialize the static description for every tetris piece.
@@ -32,8 +32,8 @@ extern Player *g_players; ///< the player instances
 PowerupId PowerupBigHand::powerupId;
 Powerup *PowerupBigHand::instance = new PowerupBigHand();
 
-GuiImageData *PowerupBigHand::imageData = 
-  new GuiImageData(powerup_bighand_png);
+PowerupImage PowerupBigHand::image = 
+  {powerup_bighand_png, NULL};
 
 string PowerupBigHand::helpText[2] = 
   {"Big Hand", "Hey! Your hand's in the way!"};
@@ -32,15 +32,15 @@ extern Player *g_players; ///< the player instances
 PowerupId PowerupJunkPiece::powerupId;
 Powerup *PowerupJunkPiece::instance = new PowerupJunkPiece();
 
-GuiImageData *PowerupJunkPiece::imageData = 
-  new GuiImageData(powerup_junkpiece_png);
+PowerupImage PowerupJunkPiece::image = 
+  {powerup_junkpiece_png, NULL};
 
 string PowerupJunkPiece::helpText[2] = 
   {"Junk Piece", "The target player's next piece will be a junk piece."};
 
 // OPTIONAL:
-//GuiSound *PowerupJunkPiece::sound = 
-//  new GuiSound(powerup_junkpiece_pcm, powerup_junkpiece_pcm_size, SOUND_PCM);
+//PowerupSound PowerupJunkPiece::sound = 
+//  {powerup_junkpiece_pcm, &powerup_junkpiece_pcm_size, NULL};
 
 void PowerupJunkPiece::StartEffect(u8 player)
 {
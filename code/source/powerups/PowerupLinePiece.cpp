@@ -32,8 +32,8 @@ extern Player *g_players; ///< the player instances
 PowerupId PowerupLinePiece::powerupId;
 Powerup *PowerupLinePiece::instance = new PowerupLinePiece();
 
-GuiImageData *PowerupLinePiece::imageData = 
-  new GuiImageData(powerup_linepiece_png);
+PowerupImage PowerupLinePiece::image = 
+  {powerup_linepiece_png, NULL};
 
 string PowerupLinePiece::helpText[2] = 
   {"Line Piece", "The target player's next piece will be a line piece."};
@@ -32,15 +32,15 @@ extern Player *g_players; ///< the player instances
 PowerupId PowerupMirror::powerupId;
 Powerup *PowerupMirror::instance = new PowerupMirror();
 
-GuiImageData *PowerupMirror::imageData = 
-  new GuiImageData(powerup_mirror_png);
+PowerupImage PowerupMirror::image = 
+  {powerup_mirror_png, NULL};
 
 string PowerupMirror::helpText[2] = 
   {"Mirror", "A defensive powerup that reflects powerup attacks."};
 
 // OPTIONAL:
-//GuiSound *PowerupMirror::sound = 
-//  new GuiSound(powerup_mirror_pcm, powerup_mirror_pcm_size, SOUND_PCM);
+//PowerupSound PowerupMirror::sound = 
+//  {powerup_mirror_pcm, &powerup_mirror_pcm_size, NULL};
 
 void PowerupMirror::StartEffect(u8 player)
 {
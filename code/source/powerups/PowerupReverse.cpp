@@ -32,8 +32,8 @@ extern Player *g_players; ///< the player instances
 PowerupId PowerupReverse::powerupId;
 Powerup *PowerupReverse::instance = new PowerupReverse();
 
-GuiImageData *PowerupReverse::imageData = 
-  new GuiImageData(powerup_reverse_png);
+PowerupImage PowerupReverse::image = 
+  {powerup_reverse_png, NULL};
 
 string PowerupReverse::helpText[2] = 
   {"Reverse", "Reverses the direction in which the "
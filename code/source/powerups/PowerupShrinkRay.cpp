@@ -34,11 +34,11 @@ extern Player *g_players; ///< the player instances
 PowerupId PowerupShrinkRay::powerupId;
 Powerup *PowerupShrinkRay::instance = new PowerupShrinkRay();
 
-GuiImageData *PowerupShrinkRay::imageData = 
-  new GuiImageData(powerup_shrinkray_png);
+PowerupImage PowerupShrinkRay::image = 
+  {powerup_shrinkray_png, NULL};
 
-GuiSound *PowerupShrinkRay::sound = 
-  new GuiSound(powerup_shrinkray_pcm, powerup_shrinkray_pcm_size, SOUND_PCM);
+PowerupSound PowerupShrinkRay::sound = 
+  {powerup_shrinkray_pcm, &powerup_shrinkray_pcm_size, NULL};
 
 string PowerupShrinkRay::helpText[2] = 
   {"Shrink Ray", "Shrinks the target player's playfield. "
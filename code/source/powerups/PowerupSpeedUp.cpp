@@ -32,15 +32,15 @@ extern Player *g_players; ///< the player instances
 PowerupId PowerupSpeedUp::powerupId;
 Powerup *PowerupSpeedUp::instance = new PowerupSpeedUp();
 
-GuiImageData *PowerupSpeedUp::imageData = 
-  new GuiImageData(powerup_speedup_png);
+PowerupImage PowerupSpeedUp::image = 
+  {powerup_speedup_png, NULL};
 
 string PowerupSpeedUp::helpText[2] = 
   {"Speed Up", "A powerup that temporarily increases the level (speed) of the target player."};
 
 // OPTIONAL:
-//GuiSound *PowerupSpeedUp::sound = 
-//  new GuiSound(powerup_speedup_pcm, powerup_speedup_pcm_size, SOUND_PCM);
+//PowerupSound PowerupSpeedUp::sound = 
+//  {powerup_speedup_pcm, &powerup_speedup_pcm_size, NULL};
 
 #define SPEED_INCREMENT 2
 
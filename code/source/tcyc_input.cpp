@@ -28,14 +28,17 @@
 #include "tcyc_menu.h"     // for TCYC_MenuPause
 #include "Player.h"        // for Player
 #include "Options.h"       // for Options
-#include "libwiigui/gui.h" // for GuiTrigger
+#include "libwiigui/gui.h" // for GuiTrigger, Render_CaptureFrame
 #include "PowerupUtils.h"  // for PowerupUtils
+#include "framedump.h"     // for FrameDump_Start, FrameDump_Stop, FrameDump_Screenshot
+#include "PhaseProfiler.h" // for PROF_SCOPE_PLAYER
 
 extern Player *g_players;       ///< the player instances
 extern int g_tcycMenu;          ///< the current menu state
 extern Options *g_options;      ///< the global options
 extern GuiTrigger userInput[4]; ///< user input
 extern bool g_isClassicMode;    ///< classic mode
+extern GXRModeObj *g_vmode;     ///< the video mode
 
 // helper routines
 static void _HandlePowerups(int plyrIdx);
@@ -56,6 +59,29 @@ void TCYC_ProcessInput()
     PowerupUtils::ResetPowerupStartTimes();
   }
 
+#if DEBUG
+  // Toggle recording of the rendered frames, for offline review of matches.
+  // The first frame is also saved as a lossless still to compare against a 
+  // golden image with tools/ppmdiff when the look of the game changes.
+  for (int i = 0; i < g_options->players; ++i)
+  {
+    if (CAPTURE_PRESSED(i))
+    {
+      if (FrameDump_IsRecording())
+      {
+        FrameDump_Stop();
+      }
+      else
+      {
+        FrameDump_Screenshot("sd:/tetricycle.ppm", g_vmode);
+        FrameDump_Start("sd:/tetricycle.y4m", g_vmode);
+        Render_CaptureFrame(); // for tools/renderreplay
+      }
+      break;
+    }
+  }
+#endif
+
   for (int i = 0; i < g_options->players; ++i)
   {
     Player &player = g_players[i];
@@ -65,7 +91,12 @@ void TCYC_ProcessInput()
       continue;
 
     // POWERUPS:
-    _HandlePowerups(i);
+    {
+      PROF_SCOPE_PLAYER(PROF_POWERUPS, i);
+      _HandlePowerups(i);
+    }
+
+    PROF_SCOPE_PLAYER(PROF_MOVEMENT, i);
 
     // ROTATE PIECE:
     int rot = piece.GetRotation();
@@ -24,13 +24,15 @@
 
 #include "tcyc_menu.h"
 
-#include <unistd.h>        // for usleep
 #include <gcmodplay.h>     // for MODPlay
+#include <sys/stat.h>      // for stat
 #include "Player.h"        // for Player
 #include "Options.h"       // for Options
 #include "PowerupUtils.h"  // for PowerupUtils
 #include "libwiigui/gui.h" // for GuiSound
 #include "menu.h"          // for ResumeGui
+#include "startup.h"       // for Startup_Mark, Startup_Load
+#include "assets.h"        // for Assets_Acquire
 #include "main.h"          // for TCYC_SetUp2D, TCYC_DrawText, TetriCycle_main
 #include "tcyc_input.h"    // for PausePressedAnyPlayer
 
@@ -50,7 +52,6 @@ GuiTrigger *trigA;
 GuiTrigger *trigHome;
 
 GuiSound *btnSoundOver;
-GuiSound *g_heartbeatSound;
 GuiSound *g_tetrisCheerSound;
 
 GuiImageData *btnOutline;
@@ -77,9 +78,60 @@ static GuiImageData *upArrowOverImgData;
 static GuiImageData *downArrowImgData;
 static GuiImageData *downArrowOverImgData;
 
+/// A menu image, decoded when the menu resources are loaded.
+struct MenuImage
+{
+  GuiImageData **imageData; ///< where the decoded image goes
+  const u8 *png;            ///< the embedded image
+  const char *name;         ///< the image file, for the startup timeline
+};
+
+/// Every menu image, in the order they're first needed.
+static MenuImage menuImages[] = 
+{
+  {&tetrisLove,             tetris_love_png,              "tetris_love.png"},
+  {&logoImgData,            logo_alien_png,               "logo_alien.png"},
+  {&btnOutline,             button_png,                   "button.png"},
+  {&btnOutlineOver,         button_over_png,              "button_over.png"},
+  {&btnData40x40Square,     keyboard_key_png,             "keyboard_key.png"},
+  {&btnData40x40SquareOver, keyboard_key_over_png,        "keyboard_key_over.png"},
+  {&btnLargeOutline,        button_large_png,             "button_large.png"},
+  {&btnLargeOutlineOver,    button_large_over_png,        "button_large_over.png"},
+  {&btnData80x40,           keyboard_mediumkey_png,       "keyboard_mediumkey.png"},
+  {&btnData80x40Over,       keyboard_mediumkey_over_png,  "keyboard_mediumkey_over.png"},
+  {&btnDataMinus,           scrollbar_arrowdown_png,      "scrollbar_arrowdown.png"},
+  {&btnDataMinusOver,       scrollbar_arrowdown_over_png, "scrollbar_arrowdown_over.png"},
+  {&btnDataPlus,            scrollbar_arrowup_png,        "scrollbar_arrowup.png"},
+  {&btnDataPlusOver,        scrollbar_arrowup_over_png,   "scrollbar_arrowup_over.png"},
+  {&upArrowImgData,         up_arrow_png,                 "up_arrow.png"},
+  {&upArrowOverImgData,     up_arrow_over_png,            "up_arrow_over.png"},
+  {&downArrowImgData,       down_arrow_png,               "down_arrow.png"},
+  {&downArrowOverImgData,   down_arrow_over_png,          "down_arrow_over.png"},
+  {&grabber[0],             player1_grab_png,             "player1_grab.png"},
+  {&grabber[1],             player2_grab_png,             "player2_grab.png"},
+  {&grabber[2],             player3_grab_png,             "player3_grab.png"},
+  {&grabber[3],             player4_grab_png,             "player4_grab.png"},
+  {&debug_grabber1,         player1_grab_png,             "player1_grab.png"},
+  {&debug_grabber2,         player2_grab_png,             "player2_grab.png"},
+  {&debug_grabber3,         player3_grab_png,             "player3_grab.png"},
+  {&debug_grabber4,         player4_grab_png,             "player4_grab.png"}
+};
+
+/// Soundtracks that replace the built-in music, in the order they're looked 
+/// for; they're streamed from the device, so they can be any length.
+static const char *customMusic[] = 
+{
+  "sd:/apps/tetricycle/music.ogg",
+  "usb:/apps/tetricycle/music.ogg"
+};
+
 // function prototypes
 static void TCYC_MenuStartup();
+#if DEBUG
+static void TCYC_MenuStartupReport();
+#endif
 static void TCYC_MenuLoadResources();
+static const char* TCYC_MenuFindMusic();
 static int TCYC_MenuMainScreen();
 static int TCYC_MenuGame();
 static void TCYC_MenuPlayerProfilesPopup();
@@ -88,6 +140,10 @@ static void TCYC_MenuPowerupsPopup(GuiWindow *parentWindow,
                                    vector<bool> &isPowerupEnabled,
                                    PowerupId powerupStartQueue[MAX_ACQUIRED_POWERUPS]);
 
+static void _LayoutPowerupRows(int top,
+                               vector<GuiButton> &iconBtns,
+                               vector<GuiButton> &onBtns,
+                               vector<GuiButton> &helpBtns);
 static void _DoEasterEgg();
 
 /// Pause the game.
@@ -96,45 +152,58 @@ void TCYC_MenuPause(const char *pauseTxt, GXColor *txtColor)
   g_options->isPaused = true;
   MODPlay_Pause(&g_modPlay, 1); // pause music
 
-  GuiText txt(pauseTxt, 38, txtColor ? *txtColor : (GXColor){255, 255, 255, 255});
-  txt.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
-  txt.SetPosition(0, 0);
+  static GuiText txt(NULL, 38, (GXColor){255, 255, 255, 255});
 
-  GuiWindow pauseWindow(screenwidth, screenheight);
-  if (pauseTxt)
-    pauseWindow.Append(&txt);
+  static GuiWindow pauseWindow(screenwidth, screenheight);
 
   // Quit Button
-  GuiButton quitBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText quitBtnTxt("Quit", 28, (GXColor){0, 0, 0, 255});
-  GuiImage quitBtnImg(btnOutline);
-  GuiImage quitBtnImgOver(btnOutlineOver);
-
-  quitBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
-  quitBtn.SetPosition(-50 - btnOutline->GetWidth(), -50);
-  quitBtn.SetLabel(&quitBtnTxt);
-  quitBtn.SetImage(&quitBtnImg);
-  quitBtn.SetImageOver(&quitBtnImgOver);
-  quitBtn.SetSoundOver(btnSoundOver);
-  quitBtn.SetTrigger(trigA);
-  quitBtn.SetEffectGrow();
-  pauseWindow.Append(&quitBtn);
+  static GuiButton quitBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText quitBtnTxt("Quit", 28, (GXColor){0, 0, 0, 255});
+  static GuiImage quitBtnImg(btnOutline);
+  static GuiImage quitBtnImgOver(btnOutlineOver);
 
   // Restart Button
-  GuiButton restartBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText restartBtnTxt("Restart", 28, (GXColor){0, 0, 0, 255});
-  GuiImage restartBtnImg(btnOutline);
-  GuiImage restartBtnImgOver(btnOutlineOver);
-
-  restartBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
-  restartBtn.SetPosition(-50, -50);
-  restartBtn.SetLabel(&restartBtnTxt);
-  restartBtn.SetImage(&restartBtnImg);
-  restartBtn.SetImageOver(&restartBtnImgOver);
-  restartBtn.SetSoundOver(btnSoundOver);
-  restartBtn.SetTrigger(trigA);
-  restartBtn.SetEffectGrow();
-  pauseWindow.Append(&restartBtn);
+  static GuiButton restartBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText restartBtnTxt("Restart", 28, (GXColor){0, 0, 0, 255});
+  static GuiImage restartBtnImg(btnOutline);
+  static GuiImage restartBtnImgOver(btnOutlineOver);
+
+  static bool isBuilt = false;
+  if (!isBuilt)
+  {
+    isBuilt = true;
+
+    txt.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
+    txt.SetPosition(0, 0);
+    pauseWindow.Append(&txt);
+
+    quitBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
+    quitBtn.SetPosition(-50 - btnOutline->GetWidth(), -50);
+    quitBtn.SetLabel(&quitBtnTxt);
+    quitBtn.SetImage(&quitBtnImg);
+    quitBtn.SetImageOver(&quitBtnImgOver);
+    quitBtn.SetSoundOver(btnSoundOver);
+    quitBtn.SetTrigger(trigA);
+    quitBtn.SetEffectGrow();
+    pauseWindow.Append(&quitBtn);
+
+    restartBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
+    restartBtn.SetPosition(-50, -50);
+    restartBtn.SetLabel(&restartBtnTxt);
+    restartBtn.SetImage(&restartBtnImg);
+    restartBtn.SetImageOver(&restartBtnImgOver);
+    restartBtn.SetSoundOver(btnSoundOver);
+    restartBtn.SetTrigger(trigA);
+    restartBtn.SetEffectGrow();
+    pauseWindow.Append(&restartBtn);
+  }
+
+  // The window is reused between pauses; bind it to this pause's text.
+  txt.SetText(pauseTxt);
+  txt.SetColor(txtColor ? *txtColor : (GXColor){255, 255, 255, 255});
+  txt.SetVisible(pauseTxt != NULL);
+  pauseWindow.ResetState();
+  pauseWindow.ResetEffects();
 
   // We can only pause from within the game, so the gui is already halted.
   mainWindow->Append(&pauseWindow);
@@ -151,9 +220,9 @@ void TCYC_MenuPause(const char *pauseTxt, GXColor *txtColor)
     {
       if (userInput[i].wpad->ir.valid)
       {
-        Menu_DrawImg(userInput[i].wpad->ir.x - 48, userInput[i].wpad->ir.y - 48,
-                     96, 96, pointer[i]->GetImage(), userInput[i].wpad->ir.angle, 
-                     1, 1, 255);
+        Menu_DrawTexObj(userInput[i].wpad->ir.x - 48, userInput[i].wpad->ir.y - 48,
+                        96, 96, pointer[i]->GetTexObj(), userInput[i].wpad->ir.angle, 
+                        1, 1, 255);
       }
 
       DoRumble(i);
@@ -200,6 +269,7 @@ void TCYC_MenuPause(const char *pauseTxt, GXColor *txtColor)
 void TCYC_MenuError(const char *errorTxt)
 {
   WindowPrompt("ERROR", errorTxt, "exit");
+  HaltGui(); // the screens' widgets are destroyed on exit
   exit(1);
 }
 
@@ -212,41 +282,44 @@ void TCYC_MenuLoadResources()
   trigHome->SetButtonOnlyTrigger(-1, WPAD_BUTTON_HOME | WPAD_CLASSIC_BUTTON_HOME, 0);
 
   btnSoundOver = new GuiSound(button_over_pcm, button_over_pcm_size, SOUND_PCM);
-  g_heartbeatSound = new GuiSound(heartbeat_pcm, heartbeat_pcm_size, SOUND_PCM);
-  g_tetrisCheerSound = new GuiSound(tetris_cheer_pcm, tetris_cheer_pcm_size, SOUND_PCM);
+  btnSoundOver->SetCategory(MIXER_UI);
+  btnSoundOver->SetPriority(MIXER_PRIORITY_LOW);
   
-  btnOutline             = new GuiImageData(button_png);
-  btnOutlineOver         = new GuiImageData(button_over_png);
-  btnLargeOutline        = new GuiImageData(button_large_png);
-  btnLargeOutlineOver    = new GuiImageData(button_large_over_png);
-  btnData40x40Square     = new GuiImageData(keyboard_key_png);
-  btnData40x40SquareOver = new GuiImageData(keyboard_key_over_png);
-  btnData80x40           = new GuiImageData(keyboard_mediumkey_png);
-  btnData80x40Over       = new GuiImageData(keyboard_mediumkey_over_png);
-  btnDataMinus           = new GuiImageData(scrollbar_arrowdown_png);
-  btnDataMinusOver       = new GuiImageData(scrollbar_arrowdown_over_png);
-  btnDataPlus            = new GuiImageData(scrollbar_arrowup_png);
-  btnDataPlusOver        = new GuiImageData(scrollbar_arrowup_over_png);
-  tetrisLove             = new GuiImageData(tetris_love_png);
-  grabber[0]             = new GuiImageData(player1_grab_png);
-  grabber[1]             = new GuiImageData(player2_grab_png);
-  grabber[2]             = new GuiImageData(player3_grab_png);
-  grabber[3]             = new GuiImageData(player4_grab_png);
-  debug_grabber1         = new GuiImageData(player1_grab_png);
-  debug_grabber2         = new GuiImageData(player2_grab_png);
-  debug_grabber3         = new GuiImageData(player3_grab_png);
-  debug_grabber4         = new GuiImageData(player4_grab_png);
-  logoImgData            = new GuiImageData(logo_alien_png);
-  upArrowImgData         = new GuiImageData(up_arrow_png);
-  upArrowOverImgData     = new GuiImageData(up_arrow_over_png);
-  downArrowImgData       = new GuiImageData(down_arrow_png);
-  downArrowOverImgData   = new GuiImageData(down_arrow_over_png);
+  // Decode the menu images, timing each for the startup timeline.
+  for (size_t i = 0; i < sizeof(menuImages) / sizeof(menuImages[0]); ++i)
+  {
+    u32 start = Startup_Now();
+    *menuImages[i].imageData = new GuiImageData(menuImages[i].png);
+    Startup_Load(menuImages[i].name, start);
+  }
+  Startup_Mark("menu images");
 
   // Init the main screen background image and music.
   bgImg   = new GuiImage(tetrisLove);
   bgMusic = new GuiSound(tetricycle_by_dj_dimz_ogg, tetricycle_by_dj_dimz_ogg_size, SOUND_OGG);
   bgMusic->SetVolume(50);
   bgMusic->SetLoop(true);
+  bgMusic->SetStream(TCYC_MenuFindMusic()); // falls back to the built-in track
+  Startup_Mark("menu resources");
+
+  // Powerups load on first use; get them out of the way now so a match 
+  // doesn't stall the first time each one shows up.
+  PowerupUtils::LoadAllAssets();
+  Startup_Mark("powerup assets");
+}
+
+/// Returns the first custom soundtrack found, or NULL if there is none.
+const char* TCYC_MenuFindMusic()
+{
+  struct stat st;
+
+  for (size_t i = 0; i < sizeof(customMusic) / sizeof(customMusic[0]); ++i)
+  {
+    if (stat(customMusic[i], &st) == 0)
+      return customMusic[i];
+  }
+
+  return NULL;
 }
 
 /// Displays the startup screen.
@@ -297,26 +370,102 @@ void TCYC_MenuStartup()
   HaltGui();
   mainWindow->Append(&w);
   ResumeGui();
+  Startup_Mark("startup screen");
 
   // Load resources while the startup screen is displaying.
   TCYC_MenuLoadResources();
+  Startup_End();
+
+#if DEBUG
+  Startup_Dump("sd:/tetricycle_startup.txt");
+#endif
+
+  // The gui thread owns the pads while it is running; a press made during
+  // loading is latched and counts.
+  while (!GuiButtonPressed())
+    WaitGuiFrame();
+
+  HaltGui();
+  mainWindow->Remove(&w);
+
+#if DEBUG
+  TCYC_MenuStartupReport();
+#endif
+}
 
-  bool loop = true;
-  while (loop)
+#if DEBUG
+/// Shows where the startup time went, until a button is pressed: every 
+/// phase on the left, the slowest asset loads on the right.
+void TCYC_MenuStartupReport()
+{
+  static const int ROWS = 20;
+  static const int TOP = 50;
+  static const int ROW_HEIGHT = 18;
+  static const int FONT_SIZE = 16;
+  GXColor color = (GXColor){255, 255, 0, 255};
+
+  StartupLine lines[STARTUP_MAX_EVENTS];
+  int count = Startup_GetBreakdown(lines, STARTUP_MAX_EVENTS);
+
+  // The loads come after the phases; put the slowest first.
+  int firstLoad = 0;
+  while (firstLoad < count && !lines[firstLoad].count)
+    ++firstLoad;
+  for (int i = firstLoad + 1; i < count; ++i)
   {
-    for (int i = 0; i < MAX_PLAYERS; ++i)
+    for (int j = i; j > firstLoad && lines[j].us > lines[j - 1].us; --j)
     {
-      if (WPAD_ButtonsDown(i))
-      {
-        loop = false;
-        break;
-      }
+      StartupLine tmp = lines[j];
+      lines[j] = lines[j - 1];
+      lines[j - 1] = tmp;
+    }
+  }
+
+  char buf[64];
+  GuiWindow w(screenwidth, screenheight);
+  vector<GuiText *> texts;
+
+  sprintf(buf, "first frame %u ms, startup %u ms", 
+    Startup_GetFirstFrame() / 1000, Startup_GetEndTime() / 1000);
+  texts.push_back(new GuiText(buf, 20, color));
+  texts.back()->SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+  texts.back()->SetPosition(0, TOP - 30);
+
+  for (int col = 0; col < 2; ++col)
+  {
+    int first = col ? firstLoad : 0;
+    int end = col ? count : firstLoad;
+
+    for (int i = first; i < end && i - first < ROWS; ++i)
+    {
+      if (lines[i].count > 1)
+        sprintf(buf, "%-.32s x%d  %u ms", lines[i].name, lines[i].count, lines[i].us / 1000);
+      else
+        sprintf(buf, "%-.32s  %u ms", lines[i].name, lines[i].us / 1000);
+
+      texts.push_back(new GuiText(buf, FONT_SIZE, color));
+      texts.back()->SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+      texts.back()->SetPosition(col ? 340 : 40, TOP + (i - first) * ROW_HEIGHT);
     }
   }
 
+  for (size_t i = 0; i < texts.size(); ++i)
+    w.Append(texts[i]);
+
+  mainWindow->Append(&w);
+  ResumeGui();
+
+  GuiButtonPressed(); // discard the press that closed the startup screen
+  while (!GuiButtonPressed())
+    WaitGuiFrame();
+
   HaltGui();
   mainWindow->Remove(&w);
+
+  for (size_t i = 0; i < texts.size(); ++i)
+    delete texts[i];
 }
+#endif
 
 /// The game state loop.
 void TCYC_MenuLoop()
@@ -358,315 +507,332 @@ int TCYC_MenuMainScreen()
   g_isClassicMode = false;
 
   // logo
-  GuiImage logoImg(logoImgData);
-  logoImg.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  logoImg.SetPosition(0, 40);
+  static GuiImage logoImg(logoImgData);
 
   //--- Classic Mode ---
-  GuiText classicTxt("Classical:", 24, (GXColor){255, 255, 255, 255});
-  classicTxt.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  classicTxt.SetPosition(LEFT_OFFSET, TOP_OFFSET);
+  static GuiText classicTxt("Classical:", 24, (GXColor){255, 255, 255, 255});
 
   // 1P button
-  GuiButton classicp1Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText classicp1BtnTxt("1P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage classicp1BtnImg(btnData40x40Square);
-  GuiImage classicp1BtnImgOver(btnData40x40SquareOver);
-
-  classicp1Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  classicp1Btn.SetPosition(LEFT_OFFSET, TOP_OFFSET + 30);
-  classicp1Btn.SetLabel(&classicp1BtnTxt);
-  classicp1Btn.SetImage(&classicp1BtnImg);
-  classicp1Btn.SetImageOver(&classicp1BtnImgOver);
-  classicp1Btn.SetSoundOver(btnSoundOver);
-  classicp1Btn.SetTrigger(trigA);
-  classicp1Btn.SetEffectGrow();
+  static GuiButton classicp1Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText classicp1BtnTxt("1P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage classicp1BtnImg(btnData40x40Square);
+  static GuiImage classicp1BtnImgOver(btnData40x40SquareOver);
 
   // 2P button
-  GuiButton classicp2Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText classicp2BtnTxt("2P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage classicp2BtnImg(btnData40x40Square);
-  GuiImage classicp2BtnImgOver(btnData40x40SquareOver);
-
-  classicp2Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  classicp2Btn.SetPosition(LEFT_OFFSET + btnData40x40Square->GetWidth(), TOP_OFFSET + 30);
-  classicp2Btn.SetLabel(&classicp2BtnTxt);
-  classicp2Btn.SetImage(&classicp2BtnImg);
-  classicp2Btn.SetImageOver(&classicp2BtnImgOver);
-  classicp2Btn.SetSoundOver(btnSoundOver);
-  classicp2Btn.SetTrigger(trigA);
-  classicp2Btn.SetEffectGrow();
+  static GuiButton classicp2Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText classicp2BtnTxt("2P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage classicp2BtnImg(btnData40x40Square);
+  static GuiImage classicp2BtnImgOver(btnData40x40SquareOver);
 
   // 3P button
-  GuiButton classicp3Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText classicp3BtnTxt("3P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage classicp3BtnImg(btnData40x40Square);
-  GuiImage classicp3BtnImgOver(btnData40x40SquareOver);
-
-  classicp3Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  classicp3Btn.SetPosition(LEFT_OFFSET + 2 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30);
-  classicp3Btn.SetLabel(&classicp3BtnTxt);
-  classicp3Btn.SetImage(&classicp3BtnImg);
-  classicp3Btn.SetImageOver(&classicp3BtnImgOver);
-  classicp3Btn.SetSoundOver(btnSoundOver);
-  classicp3Btn.SetTrigger(trigA);
-  classicp3Btn.SetEffectGrow();
+  static GuiButton classicp3Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText classicp3BtnTxt("3P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage classicp3BtnImg(btnData40x40Square);
+  static GuiImage classicp3BtnImgOver(btnData40x40SquareOver);
 
   // 4P button
-  GuiButton classicp4Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText classicp4BtnTxt("4P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage classicp4BtnImg(btnData40x40Square);
-  GuiImage classicp4BtnImgOver(btnData40x40SquareOver);
-
-  classicp4Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  classicp4Btn.SetPosition(LEFT_OFFSET + 3 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30);
-  classicp4Btn.SetLabel(&classicp4BtnTxt);
-  classicp4Btn.SetImage(&classicp4BtnImg);
-  classicp4Btn.SetImageOver(&classicp4BtnImgOver);
-  classicp4Btn.SetSoundOver(btnSoundOver);
-  classicp4Btn.SetTrigger(trigA);
-  classicp4Btn.SetEffectGrow();
-
-  static const int PLAYER_DY = 60;
+  static GuiButton classicp4Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText classicp4BtnTxt("4P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage classicp4BtnImg(btnData40x40Square);
+  static GuiImage classicp4BtnImgOver(btnData40x40SquareOver);
 
   //--- Cylindrical Mode ---
-  GuiText cylindricalTxt("Cylindrical:", 24, (GXColor){255, 255, 255, 255});
-  cylindricalTxt.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  cylindricalTxt.SetPosition(LEFT_OFFSET, TOP_OFFSET + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
+  static GuiText cylindricalTxt("Cylindrical:", 24, (GXColor){255, 255, 255, 255});
 
   // 1P button
-  GuiButton p1Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText p1BtnTxt("1P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage p1BtnImg(btnData40x40Square);
-  GuiImage p1BtnImgOver(btnData40x40SquareOver);
-
-  p1Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  p1Btn.SetPosition(LEFT_OFFSET, TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
-  p1Btn.SetLabel(&p1BtnTxt);
-  p1Btn.SetImage(&p1BtnImg);
-  p1Btn.SetImageOver(&p1BtnImgOver);
-  p1Btn.SetSoundOver(btnSoundOver);
-  p1Btn.SetTrigger(trigA);
-  p1Btn.SetEffectGrow();
+  static GuiButton p1Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText p1BtnTxt("1P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage p1BtnImg(btnData40x40Square);
+  static GuiImage p1BtnImgOver(btnData40x40SquareOver);
 
   // 2P button
-  GuiButton p2Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText p2BtnTxt("2P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage p2BtnImg(btnData40x40Square);
-  GuiImage p2BtnImgOver(btnData40x40SquareOver);
-
-  p2Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  p2Btn.SetPosition(LEFT_OFFSET + btnData40x40Square->GetWidth(), TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
-  p2Btn.SetLabel(&p2BtnTxt);
-  p2Btn.SetImage(&p2BtnImg);
-  p2Btn.SetImageOver(&p2BtnImgOver);
-  p2Btn.SetSoundOver(btnSoundOver);
-  p2Btn.SetTrigger(trigA);
-  p2Btn.SetEffectGrow();
+  static GuiButton p2Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText p2BtnTxt("2P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage p2BtnImg(btnData40x40Square);
+  static GuiImage p2BtnImgOver(btnData40x40SquareOver);
 
   // 3P button
-  GuiButton p3Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText p3BtnTxt("3P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage p3BtnImg(btnData40x40Square);
-  GuiImage p3BtnImgOver(btnData40x40SquareOver);
-
-  p3Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  p3Btn.SetPosition(LEFT_OFFSET + 2 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
-  p3Btn.SetLabel(&p3BtnTxt);
-  p3Btn.SetImage(&p3BtnImg);
-  p3Btn.SetImageOver(&p3BtnImgOver);
-  p3Btn.SetSoundOver(btnSoundOver);
-  p3Btn.SetTrigger(trigA);
-  p3Btn.SetEffectGrow();
+  static GuiButton p3Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText p3BtnTxt("3P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage p3BtnImg(btnData40x40Square);
+  static GuiImage p3BtnImgOver(btnData40x40SquareOver);
 
   // 4P button
-  GuiButton p4Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText p4BtnTxt("4P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage p4BtnImg(btnData40x40Square);
-  GuiImage p4BtnImgOver(btnData40x40SquareOver);
-
-  p4Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  p4Btn.SetPosition(LEFT_OFFSET + 3 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
-  p4Btn.SetLabel(&p4BtnTxt);
-  p4Btn.SetImage(&p4BtnImg);
-  p4Btn.SetImageOver(&p4BtnImgOver);
-  p4Btn.SetSoundOver(btnSoundOver);
-  p4Btn.SetTrigger(trigA);
-  p4Btn.SetEffectGrow();
+  static GuiButton p4Btn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText p4BtnTxt("4P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage p4BtnImg(btnData40x40Square);
+  static GuiImage p4BtnImgOver(btnData40x40SquareOver);
 
   // player profiles button
-  GuiButton profileBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText profileBtnTxt("Player Profiles", 22, (GXColor){0, 0, 0, 255});
-  GuiImage profileBtnImg(btnOutline);
-  GuiImage profileBtnImgOver(btnOutlineOver);
-
-  profileBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  profileBtn.SetPosition(RIGHT_OFFSET, TOP_OFFSET);
-  profileBtn.SetLabel(&profileBtnTxt);
-  profileBtn.SetImage(&profileBtnImg);
-  profileBtn.SetImageOver(&profileBtnImgOver);
-  profileBtn.SetSoundOver(btnSoundOver);
-  profileBtn.SetTrigger(trigA);
-  profileBtn.SetEffectGrow();
+  static GuiButton profileBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText profileBtnTxt("Player Profiles", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage profileBtnImg(btnOutline);
+  static GuiImage profileBtnImgOver(btnOutlineOver);
 
   // multiplayer options button
-  GuiButton mpOptionsBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText mpOptionsBtnTxt("MP Options", 22, (GXColor){0, 0, 0, 255});
-  GuiImage mpOptionsBtnImg(btnOutline);
-  GuiImage mpOptionsBtnImgOver(btnOutlineOver);
-
-  mpOptionsBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  mpOptionsBtn.SetPosition(RIGHT_OFFSET, TOP_OFFSET + btnOutline->GetHeight() * 1);
-  mpOptionsBtn.SetLabel(&mpOptionsBtnTxt);
-  mpOptionsBtn.SetImage(&mpOptionsBtnImg);
-  mpOptionsBtn.SetImageOver(&mpOptionsBtnImgOver);
-  mpOptionsBtn.SetSoundOver(btnSoundOver);
-  mpOptionsBtn.SetTrigger(trigA);
-  mpOptionsBtn.SetEffectGrow();
+  static GuiButton mpOptionsBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText mpOptionsBtnTxt("MP Options", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage mpOptionsBtnImg(btnOutline);
+  static GuiImage mpOptionsBtnImgOver(btnOutlineOver);
 
   // handicap options button
-  GuiButton mpHandicapsBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText mpHandicapsBtnTxt("MP Handicaps", 22, (GXColor){0, 0, 0, 255});
-  GuiImage mpHandicapsBtnImg(btnOutline);
-  GuiImage mpHandicapsBtnImgOver(btnOutlineOver);
-
-  mpHandicapsBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  mpHandicapsBtn.SetPosition(RIGHT_OFFSET, TOP_OFFSET + btnOutline->GetHeight() * 2);
-  mpHandicapsBtn.SetLabel(&mpHandicapsBtnTxt);
-  mpHandicapsBtn.SetImage(&mpHandicapsBtnImg);
-  mpHandicapsBtn.SetImageOver(&mpHandicapsBtnImgOver);
-  mpHandicapsBtn.SetSoundOver(btnSoundOver);
-  mpHandicapsBtn.SetTrigger(trigA);
-  mpHandicapsBtn.SetEffectGrow();
+  static GuiButton mpHandicapsBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText mpHandicapsBtnTxt("MP Handicaps", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage mpHandicapsBtnImg(btnOutline);
+  static GuiImage mpHandicapsBtnImgOver(btnOutlineOver);
 
   // return to loader button
-  GuiButton returnBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText returnBtnTxt("Return to loader", 20, (GXColor){0, 0, 0, 255});
-  GuiImage returnBtnImg(btnOutline);
-  GuiImage returnBtnImgOver(btnOutlineOver);
-
-  returnBtn.SetAlignment(ALIGN_CENTRE/*ALIGN_RIGHT*/, ALIGN_BOTTOM);
-  returnBtn.SetPosition(0/*RIGHT_OFFSET - btnOutline->GetWidth()*/, BOTTOM_OFFSET);
-  returnBtn.SetLabel(&returnBtnTxt);
-  returnBtn.SetImage(&returnBtnImg);
-  returnBtn.SetImageOver(&returnBtnImgOver);
-  returnBtn.SetSoundOver(btnSoundOver);
-  returnBtn.SetTrigger(trigA);
-  returnBtn.SetTrigger(trigHome);
-  returnBtn.SetEffectGrow();
+  static GuiButton returnBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText returnBtnTxt("Return to loader", 20, (GXColor){0, 0, 0, 255});
+  static GuiImage returnBtnImg(btnOutline);
+  static GuiImage returnBtnImgOver(btnOutlineOver);
 
   // exit to wii menu button
-  GuiButton exitBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText exitBtnTxt("Exit to Wii menu", 20, (GXColor){0, 0, 0, 255});
-  GuiImage exitBtnImg(btnOutline);
-  GuiImage exitBtnImgOver(btnOutlineOver);
-
-  exitBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
-  exitBtn.SetPosition(RIGHT_OFFSET, BOTTOM_OFFSET);
-  exitBtn.SetLabel(&exitBtnTxt);
-  exitBtn.SetImage(&exitBtnImg);
-  exitBtn.SetImageOver(&exitBtnImgOver);
-  exitBtn.SetSoundOver(btnSoundOver);
-  exitBtn.SetTrigger(trigA);
-  exitBtn.SetTrigger(trigHome);
-  exitBtn.SetEffectGrow();
+  static GuiButton exitBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText exitBtnTxt("Exit to Wii menu", 20, (GXColor){0, 0, 0, 255});
+  static GuiImage exitBtnImg(btnOutline);
+  static GuiImage exitBtnImgOver(btnOutlineOver);
 
   // easter egg button
-  GuiButton heartBtn(150, 150);
-  heartBtn.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
-  heartBtn.SetPosition(0, 25);
-  heartBtn.SetSoundOver(btnSoundOver);
-  heartBtn.SetTrigger(trigA);
-
-  static const int PLAYER_BOTTOM_OFFSET = -5;
+  static GuiButton heartBtn(150, 150);
 
   //--- Adjust Playfield ---
-  GuiText playfieldTxt("Edit Playfield:", 24, (GXColor){255, 255, 255, 255});
-  playfieldTxt.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  playfieldTxt.SetPosition(LEFT_OFFSET, BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET - btnData40x40Square->GetHeight() - 8);
-
-  GuiButton edit1PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText edit1PBtnTxt("1P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage edit1PBtnImg(btnData40x40Square);
-  GuiImage edit1PBtnImgOver(btnData40x40SquareOver);
-
-  edit1PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  edit1PBtn.SetPosition(LEFT_OFFSET, BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
-  edit1PBtn.SetLabel(&edit1PBtnTxt);
-  edit1PBtn.SetImage(&edit1PBtnImg);
-  edit1PBtn.SetImageOver(&edit1PBtnImgOver);
-  edit1PBtn.SetSoundOver(btnSoundOver);
-  edit1PBtn.SetTrigger(trigA);
-  edit1PBtn.SetEffectGrow();
-
-  GuiButton edit2PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText edit2PBtnTxt("2P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage edit2PBtnImg(btnData40x40Square);
-  GuiImage edit2PBtnImgOver(btnData40x40SquareOver);
-
-  edit2PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  edit2PBtn.SetPosition(LEFT_OFFSET + btnData40x40Square->GetWidth(), BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
-  edit2PBtn.SetLabel(&edit2PBtnTxt);
-  edit2PBtn.SetImage(&edit2PBtnImg);
-  edit2PBtn.SetImageOver(&edit2PBtnImgOver);
-  edit2PBtn.SetSoundOver(btnSoundOver);
-  edit2PBtn.SetTrigger(trigA);
-  edit2PBtn.SetEffectGrow();
-
-  GuiButton edit3PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText edit3PBtnTxt("3P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage edit3PBtnImg(btnData40x40Square);
-  GuiImage edit3PBtnImgOver(btnData40x40SquareOver);
-
-  edit3PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  edit3PBtn.SetPosition(LEFT_OFFSET + 2 * btnData40x40Square->GetWidth(), BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
-  edit3PBtn.SetLabel(&edit3PBtnTxt);
-  edit3PBtn.SetImage(&edit3PBtnImg);
-  edit3PBtn.SetImageOver(&edit3PBtnImgOver);
-  edit3PBtn.SetSoundOver(btnSoundOver);
-  edit3PBtn.SetTrigger(trigA);
-  edit3PBtn.SetEffectGrow();
-
-  GuiButton edit4PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText edit4PBtnTxt("4P", 22, (GXColor){0, 0, 0, 255});
-  GuiImage edit4PBtnImg(btnData40x40Square);
-  GuiImage edit4PBtnImgOver(btnData40x40SquareOver);
-
-  edit4PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  edit4PBtn.SetPosition(LEFT_OFFSET + 3 * btnData40x40Square->GetWidth(), BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
-  edit4PBtn.SetLabel(&edit4PBtnTxt);
-  edit4PBtn.SetImage(&edit4PBtnImg);
-  edit4PBtn.SetImageOver(&edit4PBtnImgOver);
-  edit4PBtn.SetSoundOver(btnSoundOver);
-  edit4PBtn.SetTrigger(trigA);
-  edit4PBtn.SetEffectGrow();
-
-  //--- Populate the window ---
-  GuiWindow w(screenwidth, screenheight);
-  w.Append(bgImg);
-  w.Append(&logoImg);
-  w.Append(&classicTxt);
-  w.Append(&classicp1Btn);
-  w.Append(&classicp2Btn);
-  w.Append(&classicp3Btn);
-  w.Append(&classicp4Btn);
-  w.Append(&cylindricalTxt);
-  w.Append(&p1Btn);
-  w.Append(&p2Btn);
-  w.Append(&p3Btn);
-  w.Append(&p4Btn);
-  w.Append(&playfieldTxt);
-  w.Append(&edit1PBtn);
-  w.Append(&edit2PBtn);
-  w.Append(&edit3PBtn);
-  w.Append(&edit4PBtn);
-  w.Append(&profileBtn);
-  w.Append(&mpOptionsBtn);
-  w.Append(&mpHandicapsBtn);
-  w.Append(&returnBtn);
-  w.Append(&exitBtn);
-  w.Append(&heartBtn);
-  //w.Append(&networkBtn);
+  static GuiText playfieldTxt("Edit Playfield:", 24, (GXColor){255, 255, 255, 255});
+
+  static GuiButton edit1PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText edit1PBtnTxt("1P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage edit1PBtnImg(btnData40x40Square);
+  static GuiImage edit1PBtnImgOver(btnData40x40SquareOver);
+
+  static GuiButton edit2PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText edit2PBtnTxt("2P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage edit2PBtnImg(btnData40x40Square);
+  static GuiImage edit2PBtnImgOver(btnData40x40SquareOver);
+
+  static GuiButton edit3PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText edit3PBtnTxt("3P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage edit3PBtnImg(btnData40x40Square);
+  static GuiImage edit3PBtnImgOver(btnData40x40SquareOver);
+
+  static GuiButton edit4PBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText edit4PBtnTxt("4P", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage edit4PBtnImg(btnData40x40Square);
+  static GuiImage edit4PBtnImgOver(btnData40x40SquareOver);
+
+  static GuiWindow w(screenwidth, screenheight);
+
+  static bool isBuilt = false;
+  if (!isBuilt)
+  {
+    isBuilt = true;
+
+    logoImg.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    logoImg.SetPosition(0, 40);
+
+    classicTxt.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    classicTxt.SetPosition(LEFT_OFFSET, TOP_OFFSET);
+
+    classicp1Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    classicp1Btn.SetPosition(LEFT_OFFSET, TOP_OFFSET + 30);
+    classicp1Btn.SetLabel(&classicp1BtnTxt);
+    classicp1Btn.SetImage(&classicp1BtnImg);
+    classicp1Btn.SetImageOver(&classicp1BtnImgOver);
+    classicp1Btn.SetSoundOver(btnSoundOver);
+    classicp1Btn.SetTrigger(trigA);
+    classicp1Btn.SetEffectGrow();
+
+    classicp2Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    classicp2Btn.SetPosition(LEFT_OFFSET + btnData40x40Square->GetWidth(), TOP_OFFSET + 30);
+    classicp2Btn.SetLabel(&classicp2BtnTxt);
+    classicp2Btn.SetImage(&classicp2BtnImg);
+    classicp2Btn.SetImageOver(&classicp2BtnImgOver);
+    classicp2Btn.SetSoundOver(btnSoundOver);
+    classicp2Btn.SetTrigger(trigA);
+    classicp2Btn.SetEffectGrow();
+
+    classicp3Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    classicp3Btn.SetPosition(LEFT_OFFSET + 2 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30);
+    classicp3Btn.SetLabel(&classicp3BtnTxt);
+    classicp3Btn.SetImage(&classicp3BtnImg);
+    classicp3Btn.SetImageOver(&classicp3BtnImgOver);
+    classicp3Btn.SetSoundOver(btnSoundOver);
+    classicp3Btn.SetTrigger(trigA);
+    classicp3Btn.SetEffectGrow();
+
+    classicp4Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    classicp4Btn.SetPosition(LEFT_OFFSET + 3 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30);
+    classicp4Btn.SetLabel(&classicp4BtnTxt);
+    classicp4Btn.SetImage(&classicp4BtnImg);
+    classicp4Btn.SetImageOver(&classicp4BtnImgOver);
+    classicp4Btn.SetSoundOver(btnSoundOver);
+    classicp4Btn.SetTrigger(trigA);
+    classicp4Btn.SetEffectGrow();
+
+    static const int PLAYER_DY = 60;
+
+    cylindricalTxt.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    cylindricalTxt.SetPosition(LEFT_OFFSET, TOP_OFFSET + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
+
+    p1Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    p1Btn.SetPosition(LEFT_OFFSET, TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
+    p1Btn.SetLabel(&p1BtnTxt);
+    p1Btn.SetImage(&p1BtnImg);
+    p1Btn.SetImageOver(&p1BtnImgOver);
+    p1Btn.SetSoundOver(btnSoundOver);
+    p1Btn.SetTrigger(trigA);
+    p1Btn.SetEffectGrow();
+
+    p2Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    p2Btn.SetPosition(LEFT_OFFSET + btnData40x40Square->GetWidth(), TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
+    p2Btn.SetLabel(&p2BtnTxt);
+    p2Btn.SetImage(&p2BtnImg);
+    p2Btn.SetImageOver(&p2BtnImgOver);
+    p2Btn.SetSoundOver(btnSoundOver);
+    p2Btn.SetTrigger(trigA);
+    p2Btn.SetEffectGrow();
+
+    p3Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    p3Btn.SetPosition(LEFT_OFFSET + 2 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
+    p3Btn.SetLabel(&p3BtnTxt);
+    p3Btn.SetImage(&p3BtnImg);
+    p3Btn.SetImageOver(&p3BtnImgOver);
+    p3Btn.SetSoundOver(btnSoundOver);
+    p3Btn.SetTrigger(trigA);
+    p3Btn.SetEffectGrow();
+
+    p4Btn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    p4Btn.SetPosition(LEFT_OFFSET + 3 * btnData40x40Square->GetWidth(), TOP_OFFSET + 30 + (PLAYER_DY + btnData40x40Square->GetHeight()) * 1);
+    p4Btn.SetLabel(&p4BtnTxt);
+    p4Btn.SetImage(&p4BtnImg);
+    p4Btn.SetImageOver(&p4BtnImgOver);
+    p4Btn.SetSoundOver(btnSoundOver);
+    p4Btn.SetTrigger(trigA);
+    p4Btn.SetEffectGrow();
+
+    profileBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    profileBtn.SetPosition(RIGHT_OFFSET, TOP_OFFSET);
+    profileBtn.SetLabel(&profileBtnTxt);
+    profileBtn.SetImage(&profileBtnImg);
+    profileBtn.SetImageOver(&profileBtnImgOver);
+    profileBtn.SetSoundOver(btnSoundOver);
+    profileBtn.SetTrigger(trigA);
+    profileBtn.SetEffectGrow();
+
+    mpOptionsBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    mpOptionsBtn.SetPosition(RIGHT_OFFSET, TOP_OFFSET + btnOutline->GetHeight() * 1);
+    mpOptionsBtn.SetLabel(&mpOptionsBtnTxt);
+    mpOptionsBtn.SetImage(&mpOptionsBtnImg);
+    mpOptionsBtn.SetImageOver(&mpOptionsBtnImgOver);
+    mpOptionsBtn.SetSoundOver(btnSoundOver);
+    mpOptionsBtn.SetTrigger(trigA);
+    mpOptionsBtn.SetEffectGrow();
+
+    mpHandicapsBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    mpHandicapsBtn.SetPosition(RIGHT_OFFSET, TOP_OFFSET + btnOutline->GetHeight() * 2);
+    mpHandicapsBtn.SetLabel(&mpHandicapsBtnTxt);
+    mpHandicapsBtn.SetImage(&mpHandicapsBtnImg);
+    mpHandicapsBtn.SetImageOver(&mpHandicapsBtnImgOver);
+    mpHandicapsBtn.SetSoundOver(btnSoundOver);
+    mpHandicapsBtn.SetTrigger(trigA);
+    mpHandicapsBtn.SetEffectGrow();
+
+    returnBtn.SetAlignment(ALIGN_CENTRE/*ALIGN_RIGHT*/, ALIGN_BOTTOM);
+    returnBtn.SetPosition(0/*RIGHT_OFFSET - btnOutline->GetWidth()*/, BOTTOM_OFFSET);
+    returnBtn.SetLabel(&returnBtnTxt);
+    returnBtn.SetImage(&returnBtnImg);
+    returnBtn.SetImageOver(&returnBtnImgOver);
+    returnBtn.SetSoundOver(btnSoundOver);
+    returnBtn.SetTrigger(trigA);
+    returnBtn.SetTrigger(trigHome);
+    returnBtn.SetEffectGrow();
+
+    exitBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
+    exitBtn.SetPosition(RIGHT_OFFSET, BOTTOM_OFFSET);
+    exitBtn.SetLabel(&exitBtnTxt);
+    exitBtn.SetImage(&exitBtnImg);
+    exitBtn.SetImageOver(&exitBtnImgOver);
+    exitBtn.SetSoundOver(btnSoundOver);
+    exitBtn.SetTrigger(trigA);
+    exitBtn.SetTrigger(trigHome);
+    exitBtn.SetEffectGrow();
+
+    heartBtn.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
+    heartBtn.SetPosition(0, 25);
+    heartBtn.SetSoundOver(btnSoundOver);
+    heartBtn.SetTrigger(trigA);
+
+    static const int PLAYER_BOTTOM_OFFSET = -5;
+
+    playfieldTxt.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    playfieldTxt.SetPosition(LEFT_OFFSET, BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET - btnData40x40Square->GetHeight() - 8);
+
+    edit1PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    edit1PBtn.SetPosition(LEFT_OFFSET, BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
+    edit1PBtn.SetLabel(&edit1PBtnTxt);
+    edit1PBtn.SetImage(&edit1PBtnImg);
+    edit1PBtn.SetImageOver(&edit1PBtnImgOver);
+    edit1PBtn.SetSoundOver(btnSoundOver);
+    edit1PBtn.SetTrigger(trigA);
+    edit1PBtn.SetEffectGrow();
+
+    edit2PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    edit2PBtn.SetPosition(LEFT_OFFSET + btnData40x40Square->GetWidth(), BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
+    edit2PBtn.SetLabel(&edit2PBtnTxt);
+    edit2PBtn.SetImage(&edit2PBtnImg);
+    edit2PBtn.SetImageOver(&edit2PBtnImgOver);
+    edit2PBtn.SetSoundOver(btnSoundOver);
+    edit2PBtn.SetTrigger(trigA);
+    edit2PBtn.SetEffectGrow();
+
+    edit3PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    edit3PBtn.SetPosition(LEFT_OFFSET + 2 * btnData40x40Square->GetWidth(), BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
+    edit3PBtn.SetLabel(&edit3PBtnTxt);
+    edit3PBtn.SetImage(&edit3PBtnImg);
+    edit3PBtn.SetImageOver(&edit3PBtnImgOver);
+    edit3PBtn.SetSoundOver(btnSoundOver);
+    edit3PBtn.SetTrigger(trigA);
+    edit3PBtn.SetEffectGrow();
+
+    edit4PBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    edit4PBtn.SetPosition(LEFT_OFFSET + 3 * btnData40x40Square->GetWidth(), BOTTOM_OFFSET + PLAYER_BOTTOM_OFFSET);
+    edit4PBtn.SetLabel(&edit4PBtnTxt);
+    edit4PBtn.SetImage(&edit4PBtnImg);
+    edit4PBtn.SetImageOver(&edit4PBtnImgOver);
+    edit4PBtn.SetSoundOver(btnSoundOver);
+    edit4PBtn.SetTrigger(trigA);
+    edit4PBtn.SetEffectGrow();
+
+    //--- Populate the window ---
+    w.Append(bgImg);
+    w.Append(&logoImg);
+    w.Append(&classicTxt);
+    w.Append(&classicp1Btn);
+    w.Append(&classicp2Btn);
+    w.Append(&classicp3Btn);
+    w.Append(&classicp4Btn);
+    w.Append(&cylindricalTxt);
+    w.Append(&p1Btn);
+    w.Append(&p2Btn);
+    w.Append(&p3Btn);
+    w.Append(&p4Btn);
+    w.Append(&playfieldTxt);
+    w.Append(&edit1PBtn);
+    w.Append(&edit2PBtn);
+    w.Append(&edit3PBtn);
+    w.Append(&edit4PBtn);
+    w.Append(&profileBtn);
+    w.Append(&mpOptionsBtn);
+    w.Append(&mpHandicapsBtn);
+    w.Append(&returnBtn);
+    w.Append(&exitBtn);
+    w.Append(&heartBtn);
+    //w.Append(&networkBtn);
+  }
+
+  // The screen is kept between visits, so clear whatever state the last
+  // visit left it in.
+  w.ResetState();
+  w.ResetEffects();
 
   HaltGui();
   mainWindow->Append(&w);
@@ -676,7 +842,7 @@ int TCYC_MenuMainScreen()
 
   while (menu == TCYC_MENU_NONE)
   {
-    usleep(THREAD_SLEEP);
+    WaitGuiFrame();
     if (p1Btn.GetState() == STATE_CLICKED)
     {
       g_options->players = 1;
@@ -714,6 +880,7 @@ int TCYC_MenuMainScreen()
     }
     else if (returnBtn.GetState() == STATE_CLICKED)
     {
+      HaltGui(); // the screen's widgets are destroyed on exit
       exit(0);
     }
     else if (exitBtn.GetState() == STATE_CLICKED)
@@ -825,340 +992,361 @@ void TCYC_MenuPlayerProfilesPopup()
   }
 
   // popup window
-  GuiWindow promptWindow(screenwidth - 100, screenheight - 100);
-  promptWindow.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
-  promptWindow.SetPosition(0, 0);
+  static GuiWindow promptWindow(screenwidth - 100, screenheight - 100);
 
   // background image
-  GuiImage profilesBgImg(screenwidth - 100, screenheight - 100, (GXColor){170, 170, 170, 255});
-
+  static GuiImage profilesBgImg(screenwidth - 100, screenheight - 100, (GXColor){170, 170, 170, 255});
   // title text
-  GuiText titleTxt("Player Profiles", 30, blackColor);
-  titleTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  titleTxt.SetPosition(0, 15);
+  static GuiText titleTxt("Player Profiles", 30, blackColor);
 
   // PLAYER LEFT ARROW BUTTON
-  GuiButton playerLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText playerLeftArrowBtnTxt("<", 22, blackColor);
-  GuiText playerLeftArrowBtnTxtOver("<", 22, helpTxtColor);
-  GuiImage playerLeftArrowBtnImg(btnData40x40Square);
-  GuiImage playerLeftArrowBtnImgOver(btnData40x40SquareOver);
-
-  playerLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  playerLeftArrowBtn.SetPosition(-80, 60);
-  playerLeftArrowBtn.SetLabel(&playerLeftArrowBtnTxt);
-  playerLeftArrowBtn.SetLabelOver(&playerLeftArrowBtnTxtOver);
-  playerLeftArrowBtn.SetImage(&playerLeftArrowBtnImg);
-  playerLeftArrowBtn.SetImageOver(&playerLeftArrowBtnImgOver);
-  playerLeftArrowBtn.SetSoundOver(btnSoundOver);
-  playerLeftArrowBtn.SetTrigger(trigA);
-  playerLeftArrowBtn.SetEffectGrow();
+  static GuiButton playerLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText playerLeftArrowBtnTxt("<", 22, blackColor);
+  static GuiText playerLeftArrowBtnTxtOver("<", 22, helpTxtColor);
+  static GuiImage playerLeftArrowBtnImg(btnData40x40Square);
+  static GuiImage playerLeftArrowBtnImgOver(btnData40x40SquareOver);
 
   // PLAYER RIGHT ARROW BUTTON
-  GuiButton playerRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText playerRightArrowBtnTxt(">", 22, blackColor);
-  GuiText playerRightArrowBtnTxtOver(">", 22, helpTxtColor);
-  GuiImage playerRightArrowBtnImg(btnData40x40Square);
-  GuiImage playerRightArrowBtnImgOver(btnData40x40SquareOver);
-
-  playerRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  playerRightArrowBtn.SetPosition(80, 60);
-  playerRightArrowBtn.SetLabel(&playerRightArrowBtnTxt);
-  playerRightArrowBtn.SetLabelOver(&playerRightArrowBtnTxtOver);
-  playerRightArrowBtn.SetImage(&playerRightArrowBtnImg);
-  playerRightArrowBtn.SetImageOver(&playerRightArrowBtnImgOver);
-  playerRightArrowBtn.SetSoundOver(btnSoundOver);
-  playerRightArrowBtn.SetTrigger(trigA);
-  playerRightArrowBtn.SetEffectGrow();
+  static GuiButton playerRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText playerRightArrowBtnTxt(">", 22, blackColor);
+  static GuiText playerRightArrowBtnTxtOver(">", 22, helpTxtColor);
+  static GuiImage playerRightArrowBtnImg(btnData40x40Square);
+  static GuiImage playerRightArrowBtnImgOver(btnData40x40SquareOver);
 
   // PLAYER TEXT
-  GuiText playerTxt(playerBuf, 22, blackColor);
-  playerTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  playerTxt.SetPosition(0, 60 + PADDING_TOP);
+  static GuiText playerTxt(NULL, 22, blackColor);
 
   // ROTATION TEXT BUTTON
-  GuiButton rotationTxtBtn((9 + 1) * 11, 22);
-  GuiText rotationTxtBtnTxt("rotation:", 22, blackColor);
-  GuiText rotationTxtBtnTxtOver("rotation:", 22, helpTxtColor);
-
-  rotationTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  rotationTxtBtn.SetPosition(20, 60 + PADDING_TOP + 1 * 40);
-  rotationTxtBtn.SetLabel(&rotationTxtBtnTxt);
-  rotationTxtBtn.SetLabelOver(&rotationTxtBtnTxtOver);
-  rotationTxtBtn.SetSoundOver(btnSoundOver);
-  rotationTxtBtn.SetTrigger(trigA);
+  static GuiButton rotationTxtBtn((9 + 1) * 11, 22);
+  static GuiText rotationTxtBtnTxt("rotation:", 22, blackColor);
+  static GuiText rotationTxtBtnTxtOver("rotation:", 22, helpTxtColor);
 
   // ROTATION LEFT ARROW BUTTON
-  GuiButton rotationLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText rotationLeftArrowBtnTxt("<", 22, blackColor);
-  GuiText rotationLeftArrowBtnTxtOver("<", 22, helpTxtColor);
-  GuiImage rotationLeftArrowBtnImg(btnData40x40Square);
-  GuiImage rotationLeftArrowBtnImgOver(btnData40x40SquareOver);
-
-  rotationLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  rotationLeftArrowBtn.SetPosition(-80, 60 + 1 * 40);
-  rotationLeftArrowBtn.SetLabel(&rotationLeftArrowBtnTxt);
-  rotationLeftArrowBtn.SetLabelOver(&rotationLeftArrowBtnTxtOver);
-  rotationLeftArrowBtn.SetImage(&rotationLeftArrowBtnImg);
-  rotationLeftArrowBtn.SetImageOver(&rotationLeftArrowBtnImgOver);
-  rotationLeftArrowBtn.SetSoundOver(btnSoundOver);
-  rotationLeftArrowBtn.SetTrigger(trigA);
-  rotationLeftArrowBtn.SetEffectGrow();
+  static GuiButton rotationLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText rotationLeftArrowBtnTxt("<", 22, blackColor);
+  static GuiText rotationLeftArrowBtnTxtOver("<", 22, helpTxtColor);
+  static GuiImage rotationLeftArrowBtnImg(btnData40x40Square);
+  static GuiImage rotationLeftArrowBtnImgOver(btnData40x40SquareOver);
 
   // ROTATION RIGHT ARROW BUTTON
-  GuiButton rotationRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText rotationRightArrowBtnTxt(">", 22, blackColor);
-  GuiText rotationRightArrowBtnTxtOver(">", 22, helpTxtColor);
-  GuiImage rotationRightArrowBtnImg(btnData40x40Square);
-  GuiImage rotationRightArrowBtnImgOver(btnData40x40SquareOver);
-
-  rotationRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  rotationRightArrowBtn.SetPosition(80, 60 + 1 * 40);
-  rotationRightArrowBtn.SetLabel(&rotationRightArrowBtnTxt);
-  rotationRightArrowBtn.SetLabelOver(&rotationRightArrowBtnTxtOver);
-  rotationRightArrowBtn.SetImage(&rotationRightArrowBtnImg);
-  rotationRightArrowBtn.SetImageOver(&rotationRightArrowBtnImgOver);
-  rotationRightArrowBtn.SetSoundOver(btnSoundOver);
-  rotationRightArrowBtn.SetTrigger(trigA);
-  rotationRightArrowBtn.SetEffectGrow();
+  static GuiButton rotationRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText rotationRightArrowBtnTxt(">", 22, blackColor);
+  static GuiText rotationRightArrowBtnTxtOver(">", 22, helpTxtColor);
+  static GuiImage rotationRightArrowBtnImg(btnData40x40Square);
+  static GuiImage rotationRightArrowBtnImgOver(btnData40x40SquareOver);
 
   // ROTATION TEXT
-  GuiText rotationTxt(rotateStr[rotation[player]], 22, blackColor);
-  rotationTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  rotationTxt.SetPosition(0, 60 + PADDING_TOP + 1 * 40);
+  static GuiText rotationTxt(NULL, 22, blackColor);
 
   //---
   // SHADOW TEXT BUTTON
-  GuiButton shadowTxtBtn((6 + 1) * 11, 22);
-  GuiText shadowTxtBtnTxt("guide:", 22, blackColor);
-  GuiText shadowTxtBtnTxtOver("guide:", 22, helpTxtColor);
-
-  shadowTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  shadowTxtBtn.SetPosition(20, 60 + PADDING_TOP + 2 * 40);
-  shadowTxtBtn.SetLabel(&shadowTxtBtnTxt);
-  shadowTxtBtn.SetLabelOver(&shadowTxtBtnTxtOver);
-  shadowTxtBtn.SetSoundOver(btnSoundOver);
-  shadowTxtBtn.SetTrigger(trigA);
+  static GuiButton shadowTxtBtn((6 + 1) * 11, 22);
+  static GuiText shadowTxtBtnTxt("guide:", 22, blackColor);
+  static GuiText shadowTxtBtnTxtOver("guide:", 22, helpTxtColor);
 
   // SHADOW LEFT ARROW BUTTON
-  GuiButton shadowLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText shadowLeftArrowBtnTxt("<", 22, blackColor);
-  GuiText shadowLeftArrowBtnTxtOver("<", 22, helpTxtColor);
-  GuiImage shadowLeftArrowBtnImg(btnData40x40Square);
-  GuiImage shadowLeftArrowBtnImgOver(btnData40x40SquareOver);
-
-  shadowLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  shadowLeftArrowBtn.SetPosition(-80, 60 + 2 * 40);
-  shadowLeftArrowBtn.SetLabel(&shadowLeftArrowBtnTxt);
-  shadowLeftArrowBtn.SetLabelOver(&shadowLeftArrowBtnTxtOver);
-  shadowLeftArrowBtn.SetImage(&shadowLeftArrowBtnImg);
-  shadowLeftArrowBtn.SetImageOver(&shadowLeftArrowBtnImgOver);
-  shadowLeftArrowBtn.SetSoundOver(btnSoundOver);
-  shadowLeftArrowBtn.SetTrigger(trigA);
-  shadowLeftArrowBtn.SetEffectGrow();
+  static GuiButton shadowLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText shadowLeftArrowBtnTxt("<", 22, blackColor);
+  static GuiText shadowLeftArrowBtnTxtOver("<", 22, helpTxtColor);
+  static GuiImage shadowLeftArrowBtnImg(btnData40x40Square);
+  static GuiImage shadowLeftArrowBtnImgOver(btnData40x40SquareOver);
 
   // SHADOW RIGHT ARROW BUTTON
-  GuiButton shadowRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText shadowRightArrowBtnTxt(">", 22, blackColor);
-  GuiText shadowRightArrowBtnTxtOver(">", 22, helpTxtColor);
-  GuiImage shadowRightArrowBtnImg(btnData40x40Square);
-  GuiImage shadowRightArrowBtnImgOver(btnData40x40SquareOver);
-
-  shadowRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  shadowRightArrowBtn.SetPosition(80, 60 + 2 * 40);
-  shadowRightArrowBtn.SetLabel(&shadowRightArrowBtnTxt);
-  shadowRightArrowBtn.SetLabelOver(&shadowRightArrowBtnTxtOver);
-  shadowRightArrowBtn.SetImage(&shadowRightArrowBtnImg);
-  shadowRightArrowBtn.SetImageOver(&shadowRightArrowBtnImgOver);
-  shadowRightArrowBtn.SetSoundOver(btnSoundOver);
-  shadowRightArrowBtn.SetTrigger(trigA);
-  shadowRightArrowBtn.SetEffectGrow();
+  static GuiButton shadowRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText shadowRightArrowBtnTxt(">", 22, blackColor);
+  static GuiText shadowRightArrowBtnTxtOver(">", 22, helpTxtColor);
+  static GuiImage shadowRightArrowBtnImg(btnData40x40Square);
+  static GuiImage shadowRightArrowBtnImgOver(btnData40x40SquareOver);
 
   // SHADOW TEXT
-  GuiText shadowTxt(guideStr[guide[player]], 22, blackColor);
-  shadowTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  shadowTxt.SetPosition(0, 60 + PADDING_TOP + 2 * 40);
+  static GuiText shadowTxt(NULL, 22, blackColor);
 
   //---
   // PREVIEW TEXT BUTTON
-  GuiButton previewTxtBtn((9 + 1) * 11, 22);
-  GuiText previewTxtBtnTxt("preview:", 22, blackColor);
-  GuiText previewTxtBtnTxtOver("preview:", 22, helpTxtColor);
-
-  previewTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  previewTxtBtn.SetPosition(20, 60 + PADDING_TOP + 3 * 40);
-  previewTxtBtn.SetLabel(&previewTxtBtnTxt);
-  previewTxtBtn.SetLabelOver(&previewTxtBtnTxtOver);
-  previewTxtBtn.SetSoundOver(btnSoundOver);
-  previewTxtBtn.SetTrigger(trigA);
+  static GuiButton previewTxtBtn((9 + 1) * 11, 22);
+  static GuiText previewTxtBtnTxt("preview:", 22, blackColor);
+  static GuiText previewTxtBtnTxtOver("preview:", 22, helpTxtColor);
 
   // PREVIEW LEFT ARROW BUTTON
-  GuiButton previewLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText previewLeftArrowBtnTxt("<", 22, blackColor);
-  GuiText previewLeftArrowBtnTxtOver("<", 22, helpTxtColor);
-  GuiImage previewLeftArrowBtnImg(btnData40x40Square);
-  GuiImage previewLeftArrowBtnImgOver(btnData40x40SquareOver);
-
-  previewLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  previewLeftArrowBtn.SetPosition(-80, 60 + 3 * 40);
-  previewLeftArrowBtn.SetLabel(&previewLeftArrowBtnTxt);
-  previewLeftArrowBtn.SetLabelOver(&previewLeftArrowBtnTxtOver);
-  previewLeftArrowBtn.SetImage(&previewLeftArrowBtnImg);
-  previewLeftArrowBtn.SetImageOver(&previewLeftArrowBtnImgOver);
-  previewLeftArrowBtn.SetSoundOver(btnSoundOver);
-  previewLeftArrowBtn.SetTrigger(trigA);
-  previewLeftArrowBtn.SetEffectGrow();
+  static GuiButton previewLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText previewLeftArrowBtnTxt("<", 22, blackColor);
+  static GuiText previewLeftArrowBtnTxtOver("<", 22, helpTxtColor);
+  static GuiImage previewLeftArrowBtnImg(btnData40x40Square);
+  static GuiImage previewLeftArrowBtnImgOver(btnData40x40SquareOver);
 
   // PREVIEW RIGHT ARROW BUTTON
-  GuiButton previewRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText previewRightArrowBtnTxt(">", 22, blackColor);
-  GuiText previewRightArrowBtnTxtOver(">", 22, helpTxtColor);
-  GuiImage previewRightArrowBtnImg(btnData40x40Square);
-  GuiImage previewRightArrowBtnImgOver(btnData40x40SquareOver);
-
-  previewRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  previewRightArrowBtn.SetPosition(80, 60 + 3 * 40);
-  previewRightArrowBtn.SetLabel(&previewRightArrowBtnTxt);
-  previewRightArrowBtn.SetLabelOver(&previewRightArrowBtnTxtOver);
-  previewRightArrowBtn.SetImage(&previewRightArrowBtnImg);
-  previewRightArrowBtn.SetImageOver(&previewRightArrowBtnImgOver);
-  previewRightArrowBtn.SetSoundOver(btnSoundOver);
-  previewRightArrowBtn.SetTrigger(trigA);
-  previewRightArrowBtn.SetEffectGrow();
+  static GuiButton previewRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText previewRightArrowBtnTxt(">", 22, blackColor);
+  static GuiText previewRightArrowBtnTxtOver(">", 22, helpTxtColor);
+  static GuiImage previewRightArrowBtnImg(btnData40x40Square);
+  static GuiImage previewRightArrowBtnImgOver(btnData40x40SquareOver);
 
   // PREVIEW TEXT
-  GuiText previewTxt(isPreviewEnabled[player] ? "on" : "off", 22, blackColor);
-  previewTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  previewTxt.SetPosition(0, 60 + PADDING_TOP + 3 * 40);
+  static GuiText previewTxt(NULL, 22, blackColor);
 
   //---
   // SHAKE TEXT BUTTON
-  GuiButton shakeTxtBtn((7 + 1) * 11, 22);
-  GuiText shakeTxtBtnTxt("shake:", 22, blackColor);
-  GuiText shakeTxtBtnTxtOver("shake:", 22, helpTxtColor);
-
-  shakeTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  shakeTxtBtn.SetPosition(20, 60 + PADDING_TOP + 4 * 40);
-  shakeTxtBtn.SetLabel(&shakeTxtBtnTxt);
-  shakeTxtBtn.SetLabelOver(&shakeTxtBtnTxtOver);
-  shakeTxtBtn.SetSoundOver(btnSoundOver);
-  shakeTxtBtn.SetTrigger(trigA);
+  static GuiButton shakeTxtBtn((7 + 1) * 11, 22);
+  static GuiText shakeTxtBtnTxt("shake:", 22, blackColor);
+  static GuiText shakeTxtBtnTxtOver("shake:", 22, helpTxtColor);
 
   // SHAKE LEFT ARROW BUTTON
-  GuiButton shakeLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText shakeLeftArrowBtnTxt("<", 22, blackColor);
-  GuiText shakeLeftArrowBtnTxtOver("<", 22, helpTxtColor);
-  GuiImage shakeLeftArrowBtnImg(btnData40x40Square);
-  GuiImage shakeLeftArrowBtnImgOver(btnData40x40SquareOver);
-
-  shakeLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  shakeLeftArrowBtn.SetPosition(-80, 60 + 4 * 40);
-  shakeLeftArrowBtn.SetLabel(&shakeLeftArrowBtnTxt);
-  shakeLeftArrowBtn.SetLabelOver(&shakeLeftArrowBtnTxtOver);
-  shakeLeftArrowBtn.SetImage(&shakeLeftArrowBtnImg);
-  shakeLeftArrowBtn.SetImageOver(&shakeLeftArrowBtnImgOver);
-  shakeLeftArrowBtn.SetSoundOver(btnSoundOver);
-  shakeLeftArrowBtn.SetTrigger(trigA);
-  shakeLeftArrowBtn.SetEffectGrow();
+  static GuiButton shakeLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText shakeLeftArrowBtnTxt("<", 22, blackColor);
+  static GuiText shakeLeftArrowBtnTxtOver("<", 22, helpTxtColor);
+  static GuiImage shakeLeftArrowBtnImg(btnData40x40Square);
+  static GuiImage shakeLeftArrowBtnImgOver(btnData40x40SquareOver);
 
   // SHAKE RIGHT ARROW BUTTON
-  GuiButton shakeRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText shakeRightArrowBtnTxt(">", 22, blackColor);
-  GuiText shakeRightArrowBtnTxtOver(">", 22, helpTxtColor);
-  GuiImage shakeRightArrowBtnImg(btnData40x40Square);
-  GuiImage shakeRightArrowBtnImgOver(btnData40x40SquareOver);
-
-  shakeRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  shakeRightArrowBtn.SetPosition(80, 60 + 4 * 40);
-  shakeRightArrowBtn.SetLabel(&shakeRightArrowBtnTxt);
-  shakeRightArrowBtn.SetLabelOver(&shakeRightArrowBtnTxtOver);
-  shakeRightArrowBtn.SetImage(&shakeRightArrowBtnImg);
-  shakeRightArrowBtn.SetImageOver(&shakeRightArrowBtnImgOver);
-  shakeRightArrowBtn.SetSoundOver(btnSoundOver);
-  shakeRightArrowBtn.SetTrigger(trigA);
-  shakeRightArrowBtn.SetEffectGrow();
+  static GuiButton shakeRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText shakeRightArrowBtnTxt(">", 22, blackColor);
+  static GuiText shakeRightArrowBtnTxtOver(">", 22, helpTxtColor);
+  static GuiImage shakeRightArrowBtnImg(btnData40x40Square);
+  static GuiImage shakeRightArrowBtnImgOver(btnData40x40SquareOver);
 
   // SHAKE TEXT
-  GuiText shakeTxt(isShakeEnabled[player] ? "on" : "off", 22, blackColor);
-  shakeTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  shakeTxt.SetPosition(0, 60 + PADDING_TOP + 4 * 40);
+  static GuiText shakeTxt(NULL, 22, blackColor);
 
   //---
   // CONFIRM BUTTON
-  GuiButton confirmBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText confirmBtnTxt("OK", 22, (GXColor){0, 0, 255, 255});
-  GuiImage confirmBtnImg(btnData40x40Square);
-  GuiImage confirmBtnImgOver(btnData40x40SquareOver);
-
-  confirmBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
-  confirmBtn.SetPosition(-10, -10);
-  confirmBtn.SetLabel(&confirmBtnTxt);
-  confirmBtn.SetImage(&confirmBtnImg);
-  confirmBtn.SetImageOver(&confirmBtnImgOver);
-  confirmBtn.SetSoundOver(btnSoundOver);
-  confirmBtn.SetTrigger(trigA);
-  confirmBtn.SetEffectGrow();
+  static GuiButton confirmBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText confirmBtnTxt("OK", 22, (GXColor){0, 0, 255, 255});
+  static GuiImage confirmBtnImg(btnData40x40Square);
+  static GuiImage confirmBtnImgOver(btnData40x40SquareOver);
 
   // CANCEL BUTTON
-  GuiButton cancelBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText cancelBtnTxt("X", 22, (GXColor){255, 0, 0, 255});
-  GuiImage cancelBtnImg(btnData40x40Square);
-  GuiImage cancelBtnImgOver(btnData40x40SquareOver);
-
-  cancelBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  cancelBtn.SetPosition(-10, 10);
-  cancelBtn.SetLabel(&cancelBtnTxt);
-  cancelBtn.SetImage(&cancelBtnImg);
-  cancelBtn.SetImageOver(&cancelBtnImgOver);
-  cancelBtn.SetSoundOver(btnSoundOver);
-  cancelBtn.SetTrigger(trigA);
-  cancelBtn.SetEffectGrow();
+  static GuiButton cancelBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText cancelBtnTxt("X", 22, (GXColor){255, 0, 0, 255});
+  static GuiImage cancelBtnImg(btnData40x40Square);
+  static GuiImage cancelBtnImgOver(btnData40x40SquareOver);
 
   // HELP BUTTON
-  GuiButton helpBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText helpBtnTxt("?", 22, helpTxtColor);
-  GuiImage helpBtnImg(btnData40x40Square);
-  GuiImage helpBtnImgOver(btnData40x40SquareOver);
-
-  helpBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  helpBtn.SetPosition(10, -10);
-  helpBtn.SetLabel(&helpBtnTxt);
-  helpBtn.SetImage(&helpBtnImg);
-  helpBtn.SetImageOver(&helpBtnImgOver);
-  helpBtn.SetSoundOver(btnSoundOver);
-  helpBtn.SetTrigger(trigA);
-  helpBtn.SetEffectGrow();
-
-  // Populate the window.
-  promptWindow.Append(&profilesBgImg);
-  promptWindow.Append(&titleTxt);
-  promptWindow.Append(&playerLeftArrowBtn);
-  promptWindow.Append(&playerRightArrowBtn);
-  promptWindow.Append(&playerTxt);
-
-  promptWindow.Append(&rotationTxtBtn);
-  promptWindow.Append(&rotationLeftArrowBtn);
-  promptWindow.Append(&rotationRightArrowBtn);
-  promptWindow.Append(&rotationTxt);
-
-  promptWindow.Append(&shakeTxtBtn);
-  promptWindow.Append(&shakeLeftArrowBtn);
-  promptWindow.Append(&shakeRightArrowBtn);
-  promptWindow.Append(&shakeTxt);
-
-  promptWindow.Append(&shadowTxtBtn);
-  promptWindow.Append(&shadowLeftArrowBtn);
-  promptWindow.Append(&shadowRightArrowBtn);
-  promptWindow.Append(&shadowTxt);
-
-  promptWindow.Append(&previewTxtBtn);
-  promptWindow.Append(&previewLeftArrowBtn);
-  promptWindow.Append(&previewRightArrowBtn);
-  promptWindow.Append(&previewTxt);
-
-  promptWindow.Append(&confirmBtn);
-  promptWindow.Append(&cancelBtn);
-  promptWindow.Append(&helpBtn);
+  static GuiButton helpBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText helpBtnTxt("?", 22, helpTxtColor);
+  static GuiImage helpBtnImg(btnData40x40Square);
+  static GuiImage helpBtnImgOver(btnData40x40SquareOver);
+
+  static bool isBuilt = false;
+  if (!isBuilt)
+  {
+    isBuilt = true;
+
+    promptWindow.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
+    promptWindow.SetPosition(0, 0);
+
+    titleTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    titleTxt.SetPosition(0, 15);
+
+    playerLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    playerLeftArrowBtn.SetPosition(-80, 60);
+    playerLeftArrowBtn.SetLabel(&playerLeftArrowBtnTxt);
+    playerLeftArrowBtn.SetLabelOver(&playerLeftArrowBtnTxtOver);
+    playerLeftArrowBtn.SetImage(&playerLeftArrowBtnImg);
+    playerLeftArrowBtn.SetImageOver(&playerLeftArrowBtnImgOver);
+    playerLeftArrowBtn.SetSoundOver(btnSoundOver);
+    playerLeftArrowBtn.SetTrigger(trigA);
+    playerLeftArrowBtn.SetEffectGrow();
+
+    playerRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    playerRightArrowBtn.SetPosition(80, 60);
+    playerRightArrowBtn.SetLabel(&playerRightArrowBtnTxt);
+    playerRightArrowBtn.SetLabelOver(&playerRightArrowBtnTxtOver);
+    playerRightArrowBtn.SetImage(&playerRightArrowBtnImg);
+    playerRightArrowBtn.SetImageOver(&playerRightArrowBtnImgOver);
+    playerRightArrowBtn.SetSoundOver(btnSoundOver);
+    playerRightArrowBtn.SetTrigger(trigA);
+    playerRightArrowBtn.SetEffectGrow();
+
+    playerTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    playerTxt.SetPosition(0, 60 + PADDING_TOP);
+
+    rotationTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    rotationTxtBtn.SetPosition(20, 60 + PADDING_TOP + 1 * 40);
+    rotationTxtBtn.SetLabel(&rotationTxtBtnTxt);
+    rotationTxtBtn.SetLabelOver(&rotationTxtBtnTxtOver);
+    rotationTxtBtn.SetSoundOver(btnSoundOver);
+    rotationTxtBtn.SetTrigger(trigA);
+
+    rotationLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    rotationLeftArrowBtn.SetPosition(-80, 60 + 1 * 40);
+    rotationLeftArrowBtn.SetLabel(&rotationLeftArrowBtnTxt);
+    rotationLeftArrowBtn.SetLabelOver(&rotationLeftArrowBtnTxtOver);
+    rotationLeftArrowBtn.SetImage(&rotationLeftArrowBtnImg);
+    rotationLeftArrowBtn.SetImageOver(&rotationLeftArrowBtnImgOver);
+    rotationLeftArrowBtn.SetSoundOver(btnSoundOver);
+    rotationLeftArrowBtn.SetTrigger(trigA);
+    rotationLeftArrowBtn.SetEffectGrow();
+
+    rotationRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    rotationRightArrowBtn.SetPosition(80, 60 + 1 * 40);
+    rotationRightArrowBtn.SetLabel(&rotationRightArrowBtnTxt);
+    rotationRightArrowBtn.SetLabelOver(&rotationRightArrowBtnTxtOver);
+    rotationRightArrowBtn.SetImage(&rotationRightArrowBtnImg);
+    rotationRightArrowBtn.SetImageOver(&rotationRightArrowBtnImgOver);
+    rotationRightArrowBtn.SetSoundOver(btnSoundOver);
+    rotationRightArrowBtn.SetTrigger(trigA);
+    rotationRightArrowBtn.SetEffectGrow();
+
+    rotationTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    rotationTxt.SetPosition(0, 60 + PADDING_TOP + 1 * 40);
+
+    shadowTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    shadowTxtBtn.SetPosition(20, 60 + PADDING_TOP + 2 * 40);
+    shadowTxtBtn.SetLabel(&shadowTxtBtnTxt);
+    shadowTxtBtn.SetLabelOver(&shadowTxtBtnTxtOver);
+    shadowTxtBtn.SetSoundOver(btnSoundOver);
+    shadowTxtBtn.SetTrigger(trigA);
+
+    shadowLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    shadowLeftArrowBtn.SetPosition(-80, 60 + 2 * 40);
+    shadowLeftArrowBtn.SetLabel(&shadowLeftArrowBtnTxt);
+    shadowLeftArrowBtn.SetLabelOver(&shadowLeftArrowBtnTxtOver);
+    shadowLeftArrowBtn.SetImage(&shadowLeftArrowBtnImg);
+    shadowLeftArrowBtn.SetImageOver(&shadowLeftArrowBtnImgOver);
+    shadowLeftArrowBtn.SetSoundOver(btnSoundOver);
+    shadowLeftArrowBtn.SetTrigger(trigA);
+    shadowLeftArrowBtn.SetEffectGrow();
+
+    shadowRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    shadowRightArrowBtn.SetPosition(80, 60 + 2 * 40);
+    shadowRightArrowBtn.SetLabel(&shadowRightArrowBtnTxt);
+    shadowRightArrowBtn.SetLabelOver(&shadowRightArrowBtnTxtOver);
+    shadowRightArrowBtn.SetImage(&shadowRightArrowBtnImg);
+    shadowRightArrowBtn.SetImageOver(&shadowRightArrowBtnImgOver);
+    shadowRightArrowBtn.SetSoundOver(btnSoundOver);
+    shadowRightArrowBtn.SetTrigger(trigA);
+    shadowRightArrowBtn.SetEffectGrow();
+
+    shadowTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    shadowTxt.SetPosition(0, 60 + PADDING_TOP + 2 * 40);
+
+    previewTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    previewTxtBtn.SetPosition(20, 60 + PADDING_TOP + 3 * 40);
+    previewTxtBtn.SetLabel(&previewTxtBtnTxt);
+    previewTxtBtn.SetLabelOver(&previewTxtBtnTxtOver);
+    previewTxtBtn.SetSoundOver(btnSoundOver);
+    previewTxtBtn.SetTrigger(trigA);
+
+    previewLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    previewLeftArrowBtn.SetPosition(-80, 60 + 3 * 40);
+    previewLeftArrowBtn.SetLabel(&previewLeftArrowBtnTxt);
+    previewLeftArrowBtn.SetLabelOver(&previewLeftArrowBtnTxtOver);
+    previewLeftArrowBtn.SetImage(&previewLeftArrowBtnImg);
+    previewLeftArrowBtn.SetImageOver(&previewLeftArrowBtnImgOver);
+    previewLeftArrowBtn.SetSoundOver(btnSoundOver);
+    previewLeftArrowBtn.SetTrigger(trigA);
+    previewLeftArrowBtn.SetEffectGrow();
+
+    previewRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    previewRightArrowBtn.SetPosition(80, 60 + 3 * 40);
+    previewRightArrowBtn.SetLabel(&previewRightArrowBtnTxt);
+    previewRightArrowBtn.SetLabelOver(&previewRightArrowBtnTxtOver);
+    previewRightArrowBtn.SetImage(&previewRightArrowBtnImg);
+    previewRightArrowBtn.SetImageOver(&previewRightArrowBtnImgOver);
+    previewRightArrowBtn.SetSoundOver(btnSoundOver);
+    previewRightArrowBtn.SetTrigger(trigA);
+    previewRightArrowBtn.SetEffectGrow();
+
+    previewTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    previewTxt.SetPosition(0, 60 + PADDING_TOP + 3 * 40);
+
+    shakeTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    shakeTxtBtn.SetPosition(20, 60 + PADDING_TOP + 4 * 40);
+    shakeTxtBtn.SetLabel(&shakeTxtBtnTxt);
+    shakeTxtBtn.SetLabelOver(&shakeTxtBtnTxtOver);
+    shakeTxtBtn.SetSoundOver(btnSoundOver);
+    shakeTxtBtn.SetTrigger(trigA);
+
+    shakeLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    shakeLeftArrowBtn.SetPosition(-80, 60 + 4 * 40);
+    shakeLeftArrowBtn.SetLabel(&shakeLeftArrowBtnTxt);
+    shakeLeftArrowBtn.SetLabelOver(&shakeLeftArrowBtnTxtOver);
+    shakeLeftArrowBtn.SetImage(&shakeLeftArrowBtnImg);
+    shakeLeftArrowBtn.SetImageOver(&shakeLeftArrowBtnImgOver);
+    shakeLeftArrowBtn.SetSoundOver(btnSoundOver);
+    shakeLeftArrowBtn.SetTrigger(trigA);
+    shakeLeftArrowBtn.SetEffectGrow();
+
+    shakeRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    shakeRightArrowBtn.SetPosition(80, 60 + 4 * 40);
+    shakeRightArrowBtn.SetLabel(&shakeRightArrowBtnTxt);
+    shakeRightArrowBtn.SetLabelOver(&shakeRightArrowBtnTxtOver);
+    shakeRightArrowBtn.SetImage(&shakeRightArrowBtnImg);
+    shakeRightArrowBtn.SetImageOver(&shakeRightArrowBtnImgOver);
+    shakeRightArrowBtn.SetSoundOver(btnSoundOver);
+    shakeRightArrowBtn.SetTrigger(trigA);
+    shakeRightArrowBtn.SetEffectGrow();
+
+    shakeTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    shakeTxt.SetPosition(0, 60 + PADDING_TOP + 4 * 40);
+
+    confirmBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
+    confirmBtn.SetPosition(-10, -10);
+    confirmBtn.SetLabel(&confirmBtnTxt);
+    confirmBtn.SetImage(&confirmBtnImg);
+    confirmBtn.SetImageOver(&confirmBtnImgOver);
+    confirmBtn.SetSoundOver(btnSoundOver);
+    confirmBtn.SetTrigger(trigA);
+    confirmBtn.SetEffectGrow();
+
+    cancelBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    cancelBtn.SetPosition(-10, 10);
+    cancelBtn.SetLabel(&cancelBtnTxt);
+    cancelBtn.SetImage(&cancelBtnImg);
+    cancelBtn.SetImageOver(&cancelBtnImgOver);
+    cancelBtn.SetSoundOver(btnSoundOver);
+    cancelBtn.SetTrigger(trigA);
+    cancelBtn.SetEffectGrow();
+
+    helpBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    helpBtn.SetPosition(10, -10);
+    helpBtn.SetLabel(&helpBtnTxt);
+    helpBtn.SetImage(&helpBtnImg);
+    helpBtn.SetImageOver(&helpBtnImgOver);
+    helpBtn.SetSoundOver(btnSoundOver);
+    helpBtn.SetTrigger(trigA);
+    helpBtn.SetEffectGrow();
+
+    // Populate the window.
+    promptWindow.Append(&profilesBgImg);
+    promptWindow.Append(&titleTxt);
+    promptWindow.Append(&playerLeftArrowBtn);
+    promptWindow.Append(&playerRightArrowBtn);
+    promptWindow.Append(&playerTxt);
+
+    promptWindow.Append(&rotationTxtBtn);
+    promptWindow.Append(&rotationLeftArrowBtn);
+    promptWindow.Append(&rotationRightArrowBtn);
+    promptWindow.Append(&rotationTxt);
+
+    promptWindow.Append(&shakeTxtBtn);
+    promptWindow.Append(&shakeLeftArrowBtn);
+    promptWindow.Append(&shakeRightArrowBtn);
+    promptWindow.Append(&shakeTxt);
+
+    promptWindow.Append(&shadowTxtBtn);
+    promptWindow.Append(&shadowLeftArrowBtn);
+    promptWindow.Append(&shadowRightArrowBtn);
+    promptWindow.Append(&shadowTxt);
+
+    promptWindow.Append(&previewTxtBtn);
+    promptWindow.Append(&previewLeftArrowBtn);
+    promptWindow.Append(&previewRightArrowBtn);
+    promptWindow.Append(&previewTxt);
+
+    promptWindow.Append(&confirmBtn);
+    promptWindow.Append(&cancelBtn);
+    promptWindow.Append(&helpBtn);
+  }
+
+  // Bind the popup to the current player settings.
+  playerTxt.SetText(playerBuf);
+  rotationTxt.SetText(rotateStr[rotation[player]]);
+  shadowTxt.SetText(guideStr[guide[player]]);
+  previewTxt.SetText(isPreviewEnabled[player] ? "on" : "off");
+  shakeTxt.SetText(isShakeEnabled[player] ? "on" : "off");
+  promptWindow.SetState(STATE_DEFAULT);
+  promptWindow.ResetEffects();
 
   promptWindow.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_IN, 50);
   HaltGui();
@@ -1171,7 +1359,7 @@ void TCYC_MenuPlayerProfilesPopup()
 
   while (true)
   {
-    usleep(THREAD_SLEEP);
+    WaitGuiFrame();
 
     if (confirmBtn.GetState() == STATE_CLICKED)
     {
@@ -1350,7 +1538,7 @@ void TCYC_MenuPlayerProfilesPopup()
   }
 
   promptWindow.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_OUT, 50);
-  while(promptWindow.GetEffect() > 0) usleep(THREAD_SLEEP);
+  while(promptWindow.GetEffect() > 0) WaitGuiFrame();
   HaltGui();
   mainWindow->Remove(&promptWindow);
   mainWindow->SetState(STATE_DEFAULT);
@@ -1371,240 +1559,238 @@ void TCYC_MenuPowerupsPopup(GuiWindow *parentWindow,
   memcpy(tmpPowerupStartQueue, powerupStartQueue, sizeof(tmpPowerupStartQueue));
 
   // popup window
-  GuiWindow window(screenwidth - 100, screenheight - 100);
-  window.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
-  window.SetPosition(0, 0);
-  window.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_IN, 50);
+  static GuiWindow window(screenwidth - 100, screenheight - 100);
 
   // background image
-  GuiImage bgImg(screenwidth - 100, screenheight - 100, (GXColor){150, 150, 150, 255});
+  static GuiImage bgImg(screenwidth - 100, screenheight - 100, (GXColor){150, 150, 150, 255});
 
   // title text
-  GuiText titleTxt("Powerups", 30, blackColor);
-  titleTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  titleTxt.SetPosition(0, 15);
+  static GuiText titleTxt("Powerups", 30, blackColor);
 
   // CONFIRM BUTTON
-  GuiButton confirmBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText confirmBtnTxt("OK", 22, (GXColor){0, 0, 255, 255});
-  GuiImage confirmBtnImg(btnData40x40Square);
-  GuiImage confirmBtnImgOver(btnData40x40SquareOver);
-
-  confirmBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
-  confirmBtn.SetPosition(-10, -10);
-  confirmBtn.SetLabel(&confirmBtnTxt);
-  confirmBtn.SetImage(&confirmBtnImg);
-  confirmBtn.SetImageOver(&confirmBtnImgOver);
-  confirmBtn.SetSoundOver(btnSoundOver);
-  confirmBtn.SetTrigger(trigA);
-  confirmBtn.SetEffectGrow();
+  static GuiButton confirmBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText confirmBtnTxt("OK", 22, (GXColor){0, 0, 255, 255});
+  static GuiImage confirmBtnImg(btnData40x40Square);
+  static GuiImage confirmBtnImgOver(btnData40x40SquareOver);
 
   // CANCEL BUTTON
-  GuiButton cancelBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText cancelBtnTxt("X", 22, (GXColor){255, 0, 0, 255});
-  GuiImage cancelBtnImg(btnData40x40Square);
-  GuiImage cancelBtnImgOver(btnData40x40SquareOver);
-
-  cancelBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  cancelBtn.SetPosition(-10, 10);
-  cancelBtn.SetLabel(&cancelBtnTxt);
-  cancelBtn.SetImage(&cancelBtnImg);
-  cancelBtn.SetImageOver(&cancelBtnImgOver);
-  cancelBtn.SetSoundOver(btnSoundOver);
-  cancelBtn.SetTrigger(trigA);
-  cancelBtn.SetEffectGrow();
+  static GuiButton cancelBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText cancelBtnTxt("X", 22, (GXColor){255, 0, 0, 255});
+  static GuiImage cancelBtnImg(btnData40x40Square);
+  static GuiImage cancelBtnImgOver(btnData40x40SquareOver);
 
   // HELP BUTTON
-  GuiButton helpBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText helpBtnTxt("?", 22, helpTxtColor);
-  GuiImage helpBtnImg(btnData40x40Square);
-  GuiImage helpBtnImgOver(btnData40x40SquareOver);
-
-  helpBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  helpBtn.SetPosition(10, -10);
-  helpBtn.SetLabel(&helpBtnTxt);
-  helpBtn.SetImage(&helpBtnImg);
-  helpBtn.SetImageOver(&helpBtnImgOver);
-  helpBtn.SetSoundOver(btnSoundOver);
-  helpBtn.SetTrigger(trigA);
-  helpBtn.SetEffectGrow();
+  static GuiButton helpBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText helpBtnTxt("?", 22, helpTxtColor);
+  static GuiImage helpBtnImg(btnData40x40Square);
+  static GuiImage helpBtnImgOver(btnData40x40SquareOver);
 
   // ALL ON BUTTON
-  GuiButton allOnBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText allOnTxt("on", 22, blackColor);
-  GuiImage allOnImg(btnData40x40Square);
-  GuiImage allOnImgOver(btnData40x40SquareOver);
-
-  allOnBtn.SetAlignment(ALIGN_CENTRE, ALIGN_BOTTOM);
-  allOnBtn.SetPosition(-btnData40x40Square->GetWidth() / 2, -10);
-  allOnBtn.SetLabel(&allOnTxt);
-  allOnBtn.SetImage(&allOnImg);
-  allOnBtn.SetImageOver(&allOnImgOver);
-  allOnBtn.SetSoundOver(btnSoundOver);
-  allOnBtn.SetTrigger(trigA);
-  allOnBtn.SetEffectGrow();
+  static GuiButton allOnBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText allOnTxt("on", 22, blackColor);
+  static GuiImage allOnImg(btnData40x40Square);
+  static GuiImage allOnImgOver(btnData40x40SquareOver);
 
   // ALL OFF BUTTON
-  GuiButton allOffBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText allOffTxt("off", 22, blackColor);
-  GuiImage allOffImg(btnData40x40Square);
-  GuiImage allOffImgOver(btnData40x40SquareOver);
-
-  allOffBtn.SetAlignment(ALIGN_CENTRE, ALIGN_BOTTOM);
-  allOffBtn.SetPosition(btnData40x40Square->GetWidth() / 2, -10);
-  allOffBtn.SetLabel(&allOffTxt);
-  allOffBtn.SetImage(&allOffImg);
-  allOffBtn.SetImageOver(&allOffImgOver);
-  allOffBtn.SetSoundOver(btnSoundOver);
-  allOffBtn.SetTrigger(trigA);
-  allOffBtn.SetEffectGrow();
+  static GuiButton allOffBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText allOffTxt("off", 22, blackColor);
+  static GuiImage allOffImg(btnData40x40Square);
+  static GuiImage allOffImgOver(btnData40x40SquareOver);
 
   // SCROLL UP BUTTON
-  GuiButton scrollUpBtn(upArrowImgData->GetWidth(), upArrowImgData->GetHeight());
-  GuiImage scrollUpImg(upArrowImgData);
-  GuiImage scrollUpImgOver(upArrowOverImgData);
-
-  scrollUpBtn.SetAlignment(ALIGN_RIGHT, ALIGN_MIDDLE);
-  scrollUpBtn.SetPosition(-10, -upArrowImgData->GetHeight() / 2 - 10);
-  scrollUpBtn.SetImage(&scrollUpImg);
-  scrollUpBtn.SetImageOver(&scrollUpImgOver);
-  scrollUpBtn.SetSoundOver(btnSoundOver);
-  scrollUpBtn.SetTrigger(trigA);
-  scrollUpBtn.SetEffectGrow();
+  static GuiButton scrollUpBtn(upArrowImgData->GetWidth(), upArrowImgData->GetHeight());
+  static GuiImage scrollUpImg(upArrowImgData);
+  static GuiImage scrollUpImgOver(upArrowOverImgData);
 
   // SCROLL DOWN BUTTON
-  GuiButton scrollDownBtn(downArrowImgData->GetWidth(), downArrowImgData->GetHeight());
-  GuiImage scrollDownImg(downArrowImgData);
-  GuiImage scrollDownImgOver(downArrowOverImgData);
-
-  scrollDownBtn.SetAlignment(ALIGN_RIGHT, ALIGN_MIDDLE);
-  scrollDownBtn.SetPosition(-10, downArrowImgData->GetHeight() / 2 + 10);
-  scrollDownBtn.SetImage(&scrollDownImg);
-  scrollDownBtn.SetImageOver(&scrollDownImgOver);
-  scrollDownBtn.SetSoundOver(btnSoundOver);
-  scrollDownBtn.SetTrigger(trigA);
-  scrollDownBtn.SetEffectGrow();
-
-  // add buttons to window
-  window.Append(&bgImg);
-  window.Append(&titleTxt);
-  window.Append(&confirmBtn);
-  window.Append(&cancelBtn);
-  window.Append(&helpBtn);
-  window.Append(&allOnBtn);
-  window.Append(&allOffBtn);
-  window.Append(&scrollUpBtn);
-  window.Append(&scrollDownBtn);
+  static GuiButton scrollDownBtn(downArrowImgData->GetWidth(), downArrowImgData->GetHeight());
+  static GuiImage scrollDownImg(downArrowImgData);
+  static GuiImage scrollDownImgOver(downArrowOverImgData);
 
   // POWERUP BUTTONS
-  int top = 60;
+  static vector<GuiButton> powerupIconBtns(g_totalPowerups);
+  static vector<GuiImage> powerupIconImgs(g_totalPowerups);
 
-  vector<GuiButton> powerupIconBtns(g_totalPowerups);
-  vector<GuiImage> powerupIconImgs(g_totalPowerups);
+  static vector<GuiButton> powerupOnBtns(g_totalPowerups);
+  static vector<GuiText> powerupOnTxts(g_totalPowerups);
+  static vector<GuiImage> powerupOnImgs(g_totalPowerups);
+  static vector<GuiImage> powerupOnImgsOver(g_totalPowerups);
 
-  vector<GuiButton> powerupOnBtns(g_totalPowerups);
-  vector<GuiText> powerupOnTxts(g_totalPowerups);
-  vector<GuiImage> powerupOnImgs(g_totalPowerups);
-  vector<GuiImage> powerupOnImgsOver(g_totalPowerups);
+  static vector<GuiButton> powerupHelpBtns(g_totalPowerups);
+  static vector<GuiText> powerupHelpTxts(g_totalPowerups);
+  static vector<GuiImage> powerupHelpImgs(g_totalPowerups);
+  static vector<GuiImage> powerupHelpImgsOver(g_totalPowerups);
 
-  vector<GuiButton> powerupHelpBtns(g_totalPowerups);
-  vector<GuiText> powerupHelpTxts(g_totalPowerups);
-  vector<GuiImage> powerupHelpImgs(g_totalPowerups);
-  vector<GuiImage> powerupHelpImgsOver(g_totalPowerups);
+  // POWERUP QUEUE BUTTONS
+  static GuiButton powerupQueueBtns[MAX_ACQUIRED_POWERUPS];
+  static GuiImage powerupQueueImgs[MAX_ACQUIRED_POWERUPS];
 
-  for (int i = 0; i < g_totalPowerups; ++i)
+  static bool isBuilt = false;
+  if (!isBuilt)
   {
-    // powerup icon buttons
-    powerupIconImgs[i].SetImage(PowerupUtils::GetImageData((PowerupId)i));
-    powerupIconImgs[i].SetDisplaySize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-
-    powerupIconBtns[i].SetSize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-    powerupIconBtns[i].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-    powerupIconBtns[i].SetPosition(20, top + i * btnData40x40Square->GetHeight());
-    powerupIconBtns[i].SetImage(&powerupIconImgs[i]);
-    powerupIconBtns[i].SetSoundOver(btnSoundOver);
-    powerupIconBtns[i].SetTrigger(trigA);
-    powerupIconBtns[i].SetEffectGrow();
-
-    // powerup on/off buttons
-    powerupOnTxts[i].SetText(tmpIsPowerupEnabled[i] ? "on" : "off");
-    powerupOnTxts[i].SetFontSize(22);
-    powerupOnTxts[i].SetColor(blackColor);
-    powerupOnImgs[i].SetImage(btnData40x40Square);
-    powerupOnImgsOver[i].SetImage(btnData40x40SquareOver);
-
-    powerupOnBtns[i].SetSize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-    powerupOnBtns[i].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-    powerupOnBtns[i].SetPosition(20 + btnData40x40Square->GetWidth(), top + i * btnData40x40Square->GetHeight());
-    powerupOnBtns[i].SetLabel(&powerupOnTxts[i]);
-    powerupOnBtns[i].SetImage(&powerupOnImgs[i]);
-    powerupOnBtns[i].SetImageOver(&powerupOnImgsOver[i]);
-    powerupOnBtns[i].SetSoundOver(btnSoundOver);
-    powerupOnBtns[i].SetTrigger(trigA);
-    powerupOnBtns[i].SetEffectGrow();
-
-    // powerup help buttons
-    powerupHelpTxts[i].SetText("?");
-    powerupHelpTxts[i].SetFontSize(22);
-    powerupHelpTxts[i].SetColor(helpTxtColor);
-    powerupHelpImgs[i].SetImage(btnData40x40Square);
-    powerupHelpImgsOver[i].SetImage(btnData40x40SquareOver);
-
-    powerupHelpBtns[i].SetSize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-    powerupHelpBtns[i].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-    powerupHelpBtns[i].SetPosition(20 + 2 * btnData40x40Square->GetWidth(), top + i * btnData40x40Square->GetHeight());
-    powerupHelpBtns[i].SetLabel(&powerupHelpTxts[i]);
-    powerupHelpBtns[i].SetImage(&powerupHelpImgs[i]);
-    powerupHelpBtns[i].SetImageOver(&powerupHelpImgsOver[i]);
-    powerupHelpBtns[i].SetSoundOver(btnSoundOver);
-    powerupHelpBtns[i].SetTrigger(trigA);
-    powerupHelpBtns[i].SetEffectGrow();
-
-    int state = STATE_DEFAULT;
-    bool visible = true;
-    int ypos = top + i * btnData40x40Square->GetHeight();
+    isBuilt = true;
+
+    window.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
+    window.SetPosition(0, 0);
+
+    titleTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    titleTxt.SetPosition(0, 15);
+
+    confirmBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
+    confirmBtn.SetPosition(-10, -10);
+    confirmBtn.SetLabel(&confirmBtnTxt);
+    confirmBtn.SetImage(&confirmBtnImg);
+    confirmBtn.SetImageOver(&confirmBtnImgOver);
+    confirmBtn.SetSoundOver(btnSoundOver);
+    confirmBtn.SetTrigger(trigA);
+    confirmBtn.SetEffectGrow();
+
+    cancelBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    cancelBtn.SetPosition(-10, 10);
+    cancelBtn.SetLabel(&cancelBtnTxt);
+    cancelBtn.SetImage(&cancelBtnImg);
+    cancelBtn.SetImageOver(&cancelBtnImgOver);
+    cancelBtn.SetSoundOver(btnSoundOver);
+    cancelBtn.SetTrigger(trigA);
+    cancelBtn.SetEffectGrow();
+
+    helpBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    helpBtn.SetPosition(10, -10);
+    helpBtn.SetLabel(&helpBtnTxt);
+    helpBtn.SetImage(&helpBtnImg);
+    helpBtn.SetImageOver(&helpBtnImgOver);
+    helpBtn.SetSoundOver(btnSoundOver);
+    helpBtn.SetTrigger(trigA);
+    helpBtn.SetEffectGrow();
+
+    allOnBtn.SetAlignment(ALIGN_CENTRE, ALIGN_BOTTOM);
+    allOnBtn.SetPosition(-btnData40x40Square->GetWidth() / 2, -10);
+    allOnBtn.SetLabel(&allOnTxt);
+    allOnBtn.SetImage(&allOnImg);
+    allOnBtn.SetImageOver(&allOnImgOver);
+    allOnBtn.SetSoundOver(btnSoundOver);
+    allOnBtn.SetTrigger(trigA);
+    allOnBtn.SetEffectGrow();
+
+    allOffBtn.SetAlignment(ALIGN_CENTRE, ALIGN_BOTTOM);
+    allOffBtn.SetPosition(btnData40x40Square->GetWidth() / 2, -10);
+    allOffBtn.SetLabel(&allOffTxt);
+    allOffBtn.SetImage(&allOffImg);
+    allOffBtn.SetImageOver(&allOffImgOver);
+    allOffBtn.SetSoundOver(btnSoundOver);
+    allOffBtn.SetTrigger(trigA);
+    allOffBtn.SetEffectGrow();
+
+    scrollUpBtn.SetAlignment(ALIGN_RIGHT, ALIGN_MIDDLE);
+    scrollUpBtn.SetPosition(-10, -upArrowImgData->GetHeight() / 2 - 10);
+    scrollUpBtn.SetImage(&scrollUpImg);
+    scrollUpBtn.SetImageOver(&scrollUpImgOver);
+    scrollUpBtn.SetSoundOver(btnSoundOver);
+    scrollUpBtn.SetTrigger(trigA);
+    scrollUpBtn.SetEffectGrow();
+
+    scrollDownBtn.SetAlignment(ALIGN_RIGHT, ALIGN_MIDDLE);
+    scrollDownBtn.SetPosition(-10, downArrowImgData->GetHeight() / 2 + 10);
+    scrollDownBtn.SetImage(&scrollDownImg);
+    scrollDownBtn.SetImageOver(&scrollDownImgOver);
+    scrollDownBtn.SetSoundOver(btnSoundOver);
+    scrollDownBtn.SetTrigger(trigA);
+    scrollDownBtn.SetEffectGrow();
+
+    // add buttons to window
+    window.Append(&bgImg);
+    window.Append(&titleTxt);
+    window.Append(&confirmBtn);
+    window.Append(&cancelBtn);
+    window.Append(&helpBtn);
+    window.Append(&allOnBtn);
+    window.Append(&allOffBtn);
+    window.Append(&scrollUpBtn);
+    window.Append(&scrollDownBtn);
 
-    // only show 6 powerups at a time
-    if (ypos < 60 || ypos > 60 + 5 * 40)
+    for (int i = 0; i < g_totalPowerups; ++i)
     {
-      state = STATE_DISABLED;
-      visible = false;
+      // powerup icon buttons
+      powerupIconImgs[i].SetImage(PowerupUtils::GetImageData((PowerupId)i));
+      powerupIconImgs[i].SetDisplaySize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+
+      powerupIconBtns[i].SetSize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+      powerupIconBtns[i].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+      powerupIconBtns[i].SetImage(&powerupIconImgs[i]);
+      powerupIconBtns[i].SetSoundOver(btnSoundOver);
+      powerupIconBtns[i].SetTrigger(trigA);
+      powerupIconBtns[i].SetEffectGrow();
+
+      // powerup on/off buttons
+      powerupOnTxts[i].SetFontSize(22);
+      powerupOnTxts[i].SetColor(blackColor);
+      powerupOnImgs[i].SetImage(btnData40x40Square);
+      powerupOnImgsOver[i].SetImage(btnData40x40SquareOver);
+
+      powerupOnBtns[i].SetSize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+      powerupOnBtns[i].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+      powerupOnBtns[i].SetLabel(&powerupOnTxts[i]);
+      powerupOnBtns[i].SetImage(&powerupOnImgs[i]);
+      powerupOnBtns[i].SetImageOver(&powerupOnImgsOver[i]);
+      powerupOnBtns[i].SetSoundOver(btnSoundOver);
+      powerupOnBtns[i].SetTrigger(trigA);
+      powerupOnBtns[i].SetEffectGrow();
+
+      // powerup help buttons
+      powerupHelpTxts[i].SetText("?");
+      powerupHelpTxts[i].SetFontSize(22);
+      powerupHelpTxts[i].SetColor(helpTxtColor);
+      powerupHelpImgs[i].SetImage(btnData40x40Square);
+      powerupHelpImgsOver[i].SetImage(btnData40x40SquareOver);
+
+      powerupHelpBtns[i].SetSize(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+      powerupHelpBtns[i].SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+      powerupHelpBtns[i].SetLabel(&powerupHelpTxts[i]);
+      powerupHelpBtns[i].SetImage(&powerupHelpImgs[i]);
+      powerupHelpBtns[i].SetImageOver(&powerupHelpImgsOver[i]);
+      powerupHelpBtns[i].SetSoundOver(btnSoundOver);
+      powerupHelpBtns[i].SetTrigger(trigA);
+      powerupHelpBtns[i].SetEffectGrow();
+
+      window.Append(&powerupIconBtns[i]);
+      window.Append(&powerupOnBtns[i]);
+      window.Append(&powerupHelpBtns[i]);
+    }
+
+    int y = 0;
+    for (int i = 0; i < MAX_ACQUIRED_POWERUPS; ++i, y += POWERUP_WIDTH)
+    {
+      powerupQueueImgs[i].SetDisplaySize(POWERUP_WIDTH, POWERUP_WIDTH);
+
+      powerupQueueBtns[i].SetSize(POWERUP_WIDTH, POWERUP_WIDTH);
+      powerupQueueBtns[i].SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+      powerupQueueBtns[i].SetPosition(-60, 60 + y);
+      powerupQueueBtns[i].SetImage(powerupQueueImgs + i);
+      powerupQueueBtns[i].SetSoundOver(btnSoundOver);
+      powerupQueueBtns[i].SetTrigger(trigA);
+      powerupQueueBtns[i].SetEffectGrow();
+
+      window.Append(powerupQueueBtns + i);
     }
+  }
 
-    powerupIconBtns[i].SetState(state);
-    powerupIconBtns[i].SetVisible(visible);
-    powerupOnBtns[i].SetState(state);
-    powerupOnBtns[i].SetVisible(visible);
-    powerupHelpBtns[i].SetState(state);
-    powerupHelpBtns[i].SetVisible(visible);
+  // Bind the popup to the settings being edited.
+  int top = 60;
 
-    window.Append(&powerupIconBtns[i]);
-    window.Append(&powerupOnBtns[i]);
-    window.Append(&powerupHelpBtns[i]);
-  }
+  window.SetState(STATE_DEFAULT);
+  window.ResetEffects();
+  _LayoutPowerupRows(top, powerupIconBtns, powerupOnBtns, powerupHelpBtns);
 
-  // POWERUP QUEUE BUTTONS
-  GuiButton powerupQueueBtns[MAX_ACQUIRED_POWERUPS];
-  GuiImage powerupQueueImgs[MAX_ACQUIRED_POWERUPS];
+  for (int i = 0; i < g_totalPowerups; ++i)
+    powerupOnTxts[i].SetText(tmpIsPowerupEnabled[i] ? "on" : "off");
 
-  int y = 0;
-  for (int i = 0; i < MAX_ACQUIRED_POWERUPS; ++i, y += POWERUP_WIDTH)
+  for (int i = 0; i < MAX_ACQUIRED_POWERUPS; ++i)
   {
     powerupQueueImgs[i].SetImage(tmpPowerupStartQueue[i] == POWERUP_ID_NONE ? 
       btnData40x40Square : PowerupUtils::GetImageData(tmpPowerupStartQueue[i]));
-    powerupQueueImgs[i].SetDisplaySize(POWERUP_WIDTH, POWERUP_WIDTH);
-
-    powerupQueueBtns[i].SetSize(POWERUP_WIDTH, POWERUP_WIDTH);
-    powerupQueueBtns[i].SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-    powerupQueueBtns[i].SetPosition(-60, 60 + y);
-    powerupQueueBtns[i].SetImage(powerupQueueImgs + i);
-    powerupQueueBtns[i].SetSoundOver(btnSoundOver);
-    powerupQueueBtns[i].SetTrigger(trigA);
-    powerupQueueBtns[i].SetEffectGrow();
-
-    window.Append(powerupQueueBtns + i);
   }
 
+  window.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_IN, 50);
   HaltGui();
   // This sets the state for all child elements, including child windows; 
   // that is why we disable the state first, then add the child window.
@@ -1614,7 +1800,7 @@ void TCYC_MenuPowerupsPopup(GuiWindow *parentWindow,
 
   while (true)
   {
-    usleep(THREAD_SLEEP);
+    WaitGuiFrame();
 
     if (confirmBtn.GetState() == STATE_CLICKED)
     {
@@ -1670,30 +1856,7 @@ void TCYC_MenuPowerupsPopup(GuiWindow *parentWindow,
         if (top < min)
           top = min; // always show at least 2 powerups
       }
-      for (int i = 0; i < g_totalPowerups; ++i)
-      {
-        int ypos = top + i * btnData40x40Square->GetHeight();
-        powerupIconBtns[i].SetPosition(20, ypos);
-        powerupOnBtns[i].SetPosition(20 + btnData40x40Square->GetWidth(), ypos);
-        powerupHelpBtns[i].SetPosition(20 + 2 * btnData40x40Square->GetWidth(), ypos);
-
-        int state = STATE_DEFAULT;
-        bool visible = true;
-
-        // only show 6 powerups at a time
-        if (ypos < 60 || ypos > 60 + 5 * 40)
-        {
-          state = STATE_DISABLED;
-          visible = false;
-        }
-
-        powerupIconBtns[i].SetState(state);
-        powerupIconBtns[i].SetVisible(visible);
-        powerupOnBtns[i].SetState(state);
-        powerupOnBtns[i].SetVisible(visible);
-        powerupHelpBtns[i].SetState(state);
-        powerupHelpBtns[i].SetVisible(visible);
-      }
+      _LayoutPowerupRows(top, powerupIconBtns, powerupOnBtns, powerupHelpBtns);
     }
 
     for (int i = 0; i < g_totalPowerups; ++i)
@@ -1750,13 +1913,45 @@ void TCYC_MenuPowerupsPopup(GuiWindow *parentWindow,
   }
 
   window.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_OUT, 50);
-  while (window.GetEffect() > 0) usleep(THREAD_SLEEP);
+  while (window.GetEffect() > 0) WaitGuiFrame();
   HaltGui();
   parentWindow->Remove(&window);
   parentWindow->SetState(STATE_DEFAULT);
   ResumeGui();
 }
 
+/// Positions the powerup popup's rows for the given scroll offset.
+void _LayoutPowerupRows(int top,
+                        vector<GuiButton> &iconBtns,
+                        vector<GuiButton> &onBtns,
+                        vector<GuiButton> &helpBtns)
+{
+  for (int i = 0; i < g_totalPowerups; ++i)
+  {
+    int ypos = top + i * btnData40x40Square->GetHeight();
+    iconBtns[i].SetPosition(20, ypos);
+    onBtns[i].SetPosition(20 + btnData40x40Square->GetWidth(), ypos);
+    helpBtns[i].SetPosition(20 + 2 * btnData40x40Square->GetWidth(), ypos);
+
+    int state = STATE_DEFAULT;
+    bool visible = true;
+
+    // only show 6 powerups at a time
+    if (ypos < 60 || ypos > 60 + 5 * 40)
+    {
+      state = STATE_DISABLED;
+      visible = false;
+    }
+
+    iconBtns[i].SetState(state);
+    iconBtns[i].SetVisible(visible);
+    onBtns[i].SetState(state);
+    onBtns[i].SetVisible(visible);
+    helpBtns[i].SetState(state);
+    helpBtns[i].SetVisible(visible);
+  }
+}
+
 /// Launches the multiplayer options popup.
 void TCYC_MenuMpOptionsPopup(bool isGlobalOptions)
 {
@@ -1803,394 +1998,435 @@ void TCYC_MenuMpOptionsPopup(bool isGlobalOptions)
   sprintf(defPowerupRateBuf, "%d", DEFAULT_POWERUP_RATE);
 
   // popup window
-  GuiWindow promptWindow(screenwidth - 100, screenheight - 100);
-  promptWindow.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
-  promptWindow.SetPosition(0, 0);
+  static GuiWindow promptWindow(screenwidth - 100, screenheight - 100);
 
   // background image
-  GuiImage mpOptBgImg(screenwidth - 100, screenheight - 100, (GXColor){170, 170, 170, 255});
+  static GuiImage mpOptBgImg(screenwidth - 100, screenheight - 100, (GXColor){170, 170, 170, 255});
 
   // title text
-  GuiText titleTxt(isGlobalOptions ? "Multiplayer Options" : "Handicap Options", 30, blackColor);
-  titleTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  titleTxt.SetPosition(0, 15);
+  static GuiText titleTxt(NULL, 30, blackColor);
 
   // PLAYER LEFT ARROW BUTTON
-  GuiButton playerLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText playerLeftArrowBtnTxt("<", 22, blackColor);
-  GuiText playerLeftArrowBtnTxtOver("<", 22, helpTxtColor);
-  GuiImage playerLeftArrowBtnImg(btnData40x40Square);
-  GuiImage playerLeftArrowBtnImgOver(btnData40x40SquareOver);
-
-  playerLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  playerLeftArrowBtn.SetPosition(-80, 60);
-  playerLeftArrowBtn.SetLabel(&playerLeftArrowBtnTxt);
-  playerLeftArrowBtn.SetLabelOver(&playerLeftArrowBtnTxtOver);
-  playerLeftArrowBtn.SetImage(&playerLeftArrowBtnImg);
-  playerLeftArrowBtn.SetImageOver(&playerLeftArrowBtnImgOver);
-  playerLeftArrowBtn.SetSoundOver(btnSoundOver);
-  playerLeftArrowBtn.SetTrigger(trigA);
-  playerLeftArrowBtn.SetEffectGrow();
+  static GuiButton playerLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText playerLeftArrowBtnTxt("<", 22, blackColor);
+  static GuiText playerLeftArrowBtnTxtOver("<", 22, helpTxtColor);
+  static GuiImage playerLeftArrowBtnImg(btnData40x40Square);
+  static GuiImage playerLeftArrowBtnImgOver(btnData40x40SquareOver);
 
   // PLAYER RIGHT ARROW BUTTON
-  GuiButton playerRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText playerRightArrowBtnTxt(">", 22, blackColor);
-  GuiText playerRightArrowBtnTxtOver(">", 22, helpTxtColor);
-  GuiImage playerRightArrowBtnImg(btnData40x40Square);
-  GuiImage playerRightArrowBtnImgOver(btnData40x40SquareOver);
-
-  playerRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  playerRightArrowBtn.SetPosition(80, 60);
-  playerRightArrowBtn.SetLabel(&playerRightArrowBtnTxt);
-  playerRightArrowBtn.SetLabelOver(&playerRightArrowBtnTxtOver);
-  playerRightArrowBtn.SetImage(&playerRightArrowBtnImg);
-  playerRightArrowBtn.SetImageOver(&playerRightArrowBtnImgOver);
-  playerRightArrowBtn.SetSoundOver(btnSoundOver);
-  playerRightArrowBtn.SetTrigger(trigA);
-  playerRightArrowBtn.SetEffectGrow();
+  static GuiButton playerRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText playerRightArrowBtnTxt(">", 22, blackColor);
+  static GuiText playerRightArrowBtnTxtOver(">", 22, helpTxtColor);
+  static GuiImage playerRightArrowBtnImg(btnData40x40Square);
+  static GuiImage playerRightArrowBtnImgOver(btnData40x40SquareOver);
 
   // PLAYER TEXT
-  GuiText playerTxt(playerBuf, 22, blackColor);
-  playerTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  playerTxt.SetPosition(0, 60 + PADDING_TOP);
+  static GuiText playerTxt(NULL, 22, blackColor);
 
   // HANDICAP LEFT ARROW BUTTON
-  GuiButton handicapLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText handicapLeftArrowBtnTxt("<", 22, blackColor);
-  GuiText handicapLeftArrowBtnTxtOver("<", 22, helpTxtColor);
-  GuiImage handicapLeftArrowBtnImg(btnData40x40Square);
-  GuiImage handicapLeftArrowBtnImgOver(btnData40x40SquareOver);
-
-  handicapLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  handicapLeftArrowBtn.SetPosition(-80, 60 + btnData40x40Square->GetHeight());
-  handicapLeftArrowBtn.SetLabel(&handicapLeftArrowBtnTxt);
-  handicapLeftArrowBtn.SetLabelOver(&handicapLeftArrowBtnTxtOver);
-  handicapLeftArrowBtn.SetImage(&handicapLeftArrowBtnImg);
-  handicapLeftArrowBtn.SetImageOver(&handicapLeftArrowBtnImgOver);
-  handicapLeftArrowBtn.SetSoundOver(btnSoundOver);
-  handicapLeftArrowBtn.SetTrigger(trigA);
-  handicapLeftArrowBtn.SetEffectGrow();
+  static GuiButton handicapLeftArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText handicapLeftArrowBtnTxt("<", 22, blackColor);
+  static GuiText handicapLeftArrowBtnTxtOver("<", 22, helpTxtColor);
+  static GuiImage handicapLeftArrowBtnImg(btnData40x40Square);
+  static GuiImage handicapLeftArrowBtnImgOver(btnData40x40SquareOver);
 
   // HANDICAP RIGHT ARROW BUTTON
-  GuiButton handicapRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText handicapRightArrowBtnTxt(">", 22, blackColor);
-  GuiText handicapRightArrowBtnTxtOver(">", 22, helpTxtColor);
-  GuiImage handicapRightArrowBtnImg(btnData40x40Square);
-  GuiImage handicapRightArrowBtnImgOver(btnData40x40SquareOver);
-
-  handicapRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  handicapRightArrowBtn.SetPosition(80, 60 + btnData40x40Square->GetHeight());
-  handicapRightArrowBtn.SetLabel(&handicapRightArrowBtnTxt);
-  handicapRightArrowBtn.SetLabelOver(&handicapRightArrowBtnTxtOver);
-  handicapRightArrowBtn.SetImage(&handicapRightArrowBtnImg);
-  handicapRightArrowBtn.SetImageOver(&handicapRightArrowBtnImgOver);
-  handicapRightArrowBtn.SetSoundOver(btnSoundOver);
-  handicapRightArrowBtn.SetTrigger(trigA);
-  handicapRightArrowBtn.SetEffectGrow();
+  static GuiButton handicapRightArrowBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText handicapRightArrowBtnTxt(">", 22, blackColor);
+  static GuiText handicapRightArrowBtnTxtOver(">", 22, helpTxtColor);
+  static GuiImage handicapRightArrowBtnImg(btnData40x40Square);
+  static GuiImage handicapRightArrowBtnImgOver(btnData40x40SquareOver);
 
   // HANDICAP TEXT
-  GuiText handicapTxt(isHandicapEnabled[player] ? "enabled" : "disabled", 22, blackColor);
-  handicapTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  handicapTxt.SetPosition(0, 60 + PADDING_TOP + btnData40x40Square->GetHeight());
+  static GuiText handicapTxt(NULL, 22, blackColor);
 
   // MAX LINES TEXT BUTTON
-  GuiButton linesTxtBtn((10 + 1) * 11, 22);
-  GuiText linesTxtBtnTxt("max lines:", 22, blackColor);
-  GuiText linesTxtBtnTxtOver("max lines:", 22, helpTxtColor);
-
-  linesTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  linesTxtBtn.SetPosition(10, 60 + PADDING_TOP + 2 * btnData40x40Square->GetHeight());
-  linesTxtBtn.SetLabel(&linesTxtBtnTxt);
-  linesTxtBtn.SetLabelOver(&linesTxtBtnTxtOver);
-  linesTxtBtn.SetSoundOver(btnSoundOver);
-  linesTxtBtn.SetTrigger(trigA);
+  static GuiButton linesTxtBtn((10 + 1) * 11, 22);
+  static GuiText linesTxtBtnTxt("max lines:", 22, blackColor);
+  static GuiText linesTxtBtnTxtOver("max lines:", 22, helpTxtColor);
 
   // MAX LINES TEXT
-  GuiText linesTxt(isHandicapEnabled[player] ? (profiles[player].maxLines ? maxLinesBuf : "off") : "disabled", 22, blackColor);
-  linesTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  linesTxt.SetPosition(-20, 60 + PADDING_TOP + 2 * btnData40x40Square->GetHeight());
+  static GuiText linesTxt(NULL, 22, blackColor);
 
   // MAX LINES DEFAULT BUTTON
-  GuiButton linesDefaultBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText linesDefaultBtnTxt(defMaxLinesBuf, 22, blackColor);
-  GuiText linesDefaultBtnTxtOver(defMaxLinesBuf, 22, helpTxtColor);
-  GuiImage linesDefaultBtnImg(btnData40x40Square);
-  GuiImage linesDefaultBtnImgOver(btnData40x40SquareOver);
-
-  linesDefaultBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  linesDefaultBtn.SetPosition(-10 - 2 * btnData40x40Square->GetWidth(), 60 + 2 * btnData40x40Square->GetHeight());
-  linesDefaultBtn.SetLabel(&linesDefaultBtnTxt);
-  linesDefaultBtn.SetLabelOver(&linesDefaultBtnTxtOver);
-  linesDefaultBtn.SetImage(&linesDefaultBtnImg);
-  linesDefaultBtn.SetImageOver(&linesDefaultBtnImgOver);
-  linesDefaultBtn.SetSoundOver(btnSoundOver);
-  linesDefaultBtn.SetTrigger(trigA);
-  linesDefaultBtn.SetEffectGrow();
+  static GuiButton linesDefaultBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText linesDefaultBtnTxt(defMaxLinesBuf, 22, blackColor);
+  static GuiText linesDefaultBtnTxtOver(defMaxLinesBuf, 22, helpTxtColor);
+  static GuiImage linesDefaultBtnImg(btnData40x40Square);
+  static GuiImage linesDefaultBtnImgOver(btnData40x40SquareOver);
 
   // MAX LINES MINUS BUTTON
-  GuiButton linesMinusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText linesMinusBtnTxt("-", 22, blackColor);
-  GuiText linesMinusBtnTxtOver("-", 22, helpTxtColor);
-  GuiImage linesMinusBtnImg(btnData40x40Square);
-  GuiImage linesMinusBtnImgOver(btnData40x40SquareOver);
-
-  linesMinusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  linesMinusBtn.SetPosition(-10 - btnData40x40Square->GetWidth(), 60 + 2 * btnData40x40Square->GetHeight());
-  linesMinusBtn.SetLabel(&linesMinusBtnTxt);
-  linesMinusBtn.SetLabelOver(&linesMinusBtnTxtOver);
-  linesMinusBtn.SetImage(&linesMinusBtnImg);
-  linesMinusBtn.SetImageOver(&linesMinusBtnImgOver);
-  linesMinusBtn.SetSoundOver(btnSoundOver);
-  linesMinusBtn.SetTrigger(trigA);
-  linesMinusBtn.SetEffectGrow();
+  static GuiButton linesMinusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText linesMinusBtnTxt("-", 22, blackColor);
+  static GuiText linesMinusBtnTxtOver("-", 22, helpTxtColor);
+  static GuiImage linesMinusBtnImg(btnData40x40Square);
+  static GuiImage linesMinusBtnImgOver(btnData40x40SquareOver);
 
   // MAX LINES PLUS BUTTON
-  GuiButton linesPlusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText linesPlusBtnTxt("+", 22, blackColor);
-  GuiText linesPlusBtnTxtOver("+", 22, helpTxtColor);
-  GuiImage linesPlusBtnImg(btnData40x40Square);
-  GuiImage linesPlusBtnImgOver(btnData40x40SquareOver);
-
-  linesPlusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  linesPlusBtn.SetPosition(-10, 60 + 2 * btnData40x40Square->GetHeight());
-  linesPlusBtn.SetLabel(&linesPlusBtnTxt);
-  linesPlusBtn.SetLabelOver(&linesPlusBtnTxtOver);
-  linesPlusBtn.SetImage(&linesPlusBtnImg);
-  linesPlusBtn.SetImageOver(&linesPlusBtnImgOver);
-  linesPlusBtn.SetSoundOver(btnSoundOver);
-  linesPlusBtn.SetTrigger(trigA);
-  linesPlusBtn.SetEffectGrow();
+  static GuiButton linesPlusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText linesPlusBtnTxt("+", 22, blackColor);
+  static GuiText linesPlusBtnTxtOver("+", 22, helpTxtColor);
+  static GuiImage linesPlusBtnImg(btnData40x40Square);
+  static GuiImage linesPlusBtnImgOver(btnData40x40SquareOver);
 
   // ATTACK RATE TEXT BUTTON
-  GuiButton attackTxtBtn((12 + 1) * 11, 22);
-  GuiText attackTxtBtnTxt("attack rate:", 22, blackColor);
-  GuiText attackTxtBtnTxtOver("attack rate:", 22, helpTxtColor);
-
-  attackTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  attackTxtBtn.SetPosition(10, 60 + PADDING_TOP + 3 * btnData40x40Square->GetHeight());
-  attackTxtBtn.SetLabel(&attackTxtBtnTxt);
-  attackTxtBtn.SetLabelOver(&attackTxtBtnTxtOver);
-  attackTxtBtn.SetSoundOver(btnSoundOver);
-  attackTxtBtn.SetTrigger(trigA);
+  static GuiButton attackTxtBtn((12 + 1) * 11, 22);
+  static GuiText attackTxtBtnTxt("attack rate:", 22, blackColor);
+  static GuiText attackTxtBtnTxtOver("attack rate:", 22, helpTxtColor);
 
   // ATTACK RATE TEXT
-  GuiText attackTxt(isHandicapEnabled[player] ? (profiles[player].attackRate ? attackRateBuf : "off") : "disabled", 22, blackColor);
-  attackTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  attackTxt.SetPosition(-20, 60 + PADDING_TOP + 3 * btnData40x40Square->GetHeight());
+  static GuiText attackTxt(NULL, 22, blackColor);
 
   // ATTACK RATE DEFAULT BUTTON
-  GuiButton attackDefaultBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText attackDefaultBtnTxt(defAttackRateBuf, 22, blackColor);
-  GuiText attackDefaultBtnTxtOver(defAttackRateBuf, 22, helpTxtColor);
-  GuiImage attackDefaultBtnImg(btnData40x40Square);
-  GuiImage attackDefaultBtnImgOver(btnData40x40SquareOver);
-
-  attackDefaultBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  attackDefaultBtn.SetPosition(-10 - 2 * btnData40x40Square->GetWidth(), 60 + 3 * btnData40x40Square->GetHeight());
-  attackDefaultBtn.SetLabel(&attackDefaultBtnTxt);
-  attackDefaultBtn.SetLabelOver(&attackDefaultBtnTxtOver);
-  attackDefaultBtn.SetImage(&attackDefaultBtnImg);
-  attackDefaultBtn.SetImageOver(&attackDefaultBtnImgOver);
-  attackDefaultBtn.SetSoundOver(btnSoundOver);
-  attackDefaultBtn.SetTrigger(trigA);
-  attackDefaultBtn.SetEffectGrow();
+  static GuiButton attackDefaultBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText attackDefaultBtnTxt(defAttackRateBuf, 22, blackColor);
+  static GuiText attackDefaultBtnTxtOver(defAttackRateBuf, 22, helpTxtColor);
+  static GuiImage attackDefaultBtnImg(btnData40x40Square);
+  static GuiImage attackDefaultBtnImgOver(btnData40x40SquareOver);
 
   // ATTACK RATE MINUS BUTTON
-  GuiButton attackMinusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText attackMinusBtnTxt("-", 22, blackColor);
-  GuiText attackMinusBtnTxtOver("-", 22, helpTxtColor);
-  GuiImage attackMinusBtnImg(btnData40x40Square);
-  GuiImage attackMinusBtnImgOver(btnData40x40SquareOver);
-
-  attackMinusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  attackMinusBtn.SetPosition(-10 - btnData40x40Square->GetWidth(), 60 + 3 * btnData40x40Square->GetHeight());
-  attackMinusBtn.SetLabel(&attackMinusBtnTxt);
-  attackMinusBtn.SetLabelOver(&attackMinusBtnTxtOver);
-  attackMinusBtn.SetImage(&attackMinusBtnImg);
-  attackMinusBtn.SetImageOver(&attackMinusBtnImgOver);
-  attackMinusBtn.SetSoundOver(btnSoundOver);
-  attackMinusBtn.SetTrigger(trigA);
-  attackMinusBtn.SetEffectGrow();
+  static GuiButton attackMinusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText attackMinusBtnTxt("-", 22, blackColor);
+  static GuiText attackMinusBtnTxtOver("-", 22, helpTxtColor);
+  static GuiImage attackMinusBtnImg(btnData40x40Square);
+  static GuiImage attackMinusBtnImgOver(btnData40x40SquareOver);
 
   // ATTACK RATE PLUS BUTTON
-  GuiButton attackPlusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText attackPlusBtnTxt("+", 22, blackColor);
-  GuiText attackPlusBtnTxtOver("+", 22, helpTxtColor);
-  GuiImage attackPlusBtnImg(btnData40x40Square);
-  GuiImage attackPlusBtnImgOver(btnData40x40SquareOver);
-
-  attackPlusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  attackPlusBtn.SetPosition(-10, 60 + 3 * btnData40x40Square->GetHeight());
-  attackPlusBtn.SetLabel(&attackPlusBtnTxt);
-  attackPlusBtn.SetLabelOver(&attackPlusBtnTxtOver);
-  attackPlusBtn.SetImage(&attackPlusBtnImg);
-  attackPlusBtn.SetImageOver(&attackPlusBtnImgOver);
-  attackPlusBtn.SetSoundOver(btnSoundOver);
-  attackPlusBtn.SetTrigger(trigA);
-  attackPlusBtn.SetEffectGrow();
+  static GuiButton attackPlusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText attackPlusBtnTxt("+", 22, blackColor);
+  static GuiText attackPlusBtnTxtOver("+", 22, helpTxtColor);
+  static GuiImage attackPlusBtnImg(btnData40x40Square);
+  static GuiImage attackPlusBtnImgOver(btnData40x40SquareOver);
 
   //---
   // POWERUP RATE TEXT BUTTON
-  GuiButton powerupRateTxtBtn((14 + 1) * 11, 22);
-  GuiText powerupRateTxtBtnTxt("powerup rate:", 22, blackColor);
-  GuiText powerupRateTxtBtnTxtOver("powerup rate:", 22, helpTxtColor);
-
-  powerupRateTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
-  powerupRateTxtBtn.SetPosition(10, 60 + PADDING_TOP + 4 * 40);
-  powerupRateTxtBtn.SetLabel(&powerupRateTxtBtnTxt);
-  powerupRateTxtBtn.SetLabelOver(&powerupRateTxtBtnTxtOver);
-  powerupRateTxtBtn.SetSoundOver(btnSoundOver);
-  powerupRateTxtBtn.SetTrigger(trigA);
+  static GuiButton powerupRateTxtBtn((14 + 1) * 11, 22);
+  static GuiText powerupRateTxtBtnTxt("powerup rate:", 22, blackColor);
+  static GuiText powerupRateTxtBtnTxtOver("powerup rate:", 22, helpTxtColor);
 
   // POWERUP RATE TEXT
-  GuiText powerupRateTxt(isHandicapEnabled[player] ? (profiles[player].powerupRate ? powerupRateBuf : "off") : "disabled", 22, blackColor);
-  powerupRateTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
-  powerupRateTxt.SetPosition(-20, 60 + PADDING_TOP + 4 * 40);
+  static GuiText powerupRateTxt(NULL, 22, blackColor);
 
   // POWERUP RATE DEFAULT BUTTON
-  GuiButton powerupRateDefaultBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText powerupRateDefaultBtnTxt(defPowerupRateBuf, 22, blackColor);
-  GuiText powerupRateDefaultBtnTxtOver(defPowerupRateBuf, 22, helpTxtColor);
-  GuiImage powerupRateDefaultBtnImg(btnData40x40Square);
-  GuiImage powerupRateDefaultBtnImgOver(btnData40x40SquareOver);
-
-  powerupRateDefaultBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  powerupRateDefaultBtn.SetPosition(-10 - 2 * btnData40x40Square->GetWidth(), 60 + 4 * 40);
-  powerupRateDefaultBtn.SetLabel(&powerupRateDefaultBtnTxt);
-  powerupRateDefaultBtn.SetLabelOver(&powerupRateDefaultBtnTxtOver);
-  powerupRateDefaultBtn.SetImage(&powerupRateDefaultBtnImg);
-  powerupRateDefaultBtn.SetImageOver(&powerupRateDefaultBtnImgOver);
-  powerupRateDefaultBtn.SetSoundOver(btnSoundOver);
-  powerupRateDefaultBtn.SetTrigger(trigA);
-  powerupRateDefaultBtn.SetEffectGrow();
+  static GuiButton powerupRateDefaultBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText powerupRateDefaultBtnTxt(defPowerupRateBuf, 22, blackColor);
+  static GuiText powerupRateDefaultBtnTxtOver(defPowerupRateBuf, 22, helpTxtColor);
+  static GuiImage powerupRateDefaultBtnImg(btnData40x40Square);
+  static GuiImage powerupRateDefaultBtnImgOver(btnData40x40SquareOver);
 
   // POWERUP RATE MINUS BUTTON
-  GuiButton powerupRateMinusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText powerupRateMinusBtnTxt("-", 22, blackColor);
-  GuiText powerupRateMinusBtnTxtOver("-", 22, helpTxtColor);
-  GuiImage powerupRateMinusBtnImg(btnData40x40Square);
-  GuiImage powerupRateMinusBtnImgOver(btnData40x40SquareOver);
-
-  powerupRateMinusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  powerupRateMinusBtn.SetPosition(-10 - btnData40x40Square->GetWidth(), 60 + 4 * 40);
-  powerupRateMinusBtn.SetLabel(&powerupRateMinusBtnTxt);
-  powerupRateMinusBtn.SetLabelOver(&powerupRateMinusBtnTxtOver);
-  powerupRateMinusBtn.SetImage(&powerupRateMinusBtnImg);
-  powerupRateMinusBtn.SetImageOver(&powerupRateMinusBtnImgOver);
-  powerupRateMinusBtn.SetSoundOver(btnSoundOver);
-  powerupRateMinusBtn.SetTrigger(trigA);
-  powerupRateMinusBtn.SetEffectGrow();
+  static GuiButton powerupRateMinusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText powerupRateMinusBtnTxt("-", 22, blackColor);
+  static GuiText powerupRateMinusBtnTxtOver("-", 22, helpTxtColor);
+  static GuiImage powerupRateMinusBtnImg(btnData40x40Square);
+  static GuiImage powerupRateMinusBtnImgOver(btnData40x40SquareOver);
 
   // POWERUP RATE PLUS BUTTON
-  GuiButton powerupRatePlusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText powerupRatePlusBtnTxt("+", 22, blackColor);
-  GuiText powerupRatePlusBtnTxtOver("+", 22, helpTxtColor);
-  GuiImage powerupRatePlusBtnImg(btnData40x40Square);
-  GuiImage powerupRatePlusBtnImgOver(btnData40x40SquareOver);
-
-  powerupRatePlusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  powerupRatePlusBtn.SetPosition(-10, 60 + 4 * 40);
-  powerupRatePlusBtn.SetLabel(&powerupRatePlusBtnTxt);
-  powerupRatePlusBtn.SetLabelOver(&powerupRatePlusBtnTxtOver);
-  powerupRatePlusBtn.SetImage(&powerupRatePlusBtnImg);
-  powerupRatePlusBtn.SetImageOver(&powerupRatePlusBtnImgOver);
-  powerupRatePlusBtn.SetSoundOver(btnSoundOver);
-  powerupRatePlusBtn.SetTrigger(trigA);
-  powerupRatePlusBtn.SetEffectGrow();
+  static GuiButton powerupRatePlusBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText powerupRatePlusBtnTxt("+", 22, blackColor);
+  static GuiText powerupRatePlusBtnTxtOver("+", 22, helpTxtColor);
+  static GuiImage powerupRatePlusBtnImg(btnData40x40Square);
+  static GuiImage powerupRatePlusBtnImgOver(btnData40x40SquareOver);
 
   // CONFIRM BUTTON
-  GuiButton confirmBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText confirmBtnTxt("OK", 22, (GXColor){0, 0, 255, 255});
-  GuiImage confirmBtnImg(btnData40x40Square);
-  GuiImage confirmBtnImgOver(btnData40x40SquareOver);
-
-  confirmBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
-  confirmBtn.SetPosition(-10, -10);
-  confirmBtn.SetLabel(&confirmBtnTxt);
-  confirmBtn.SetImage(&confirmBtnImg);
-  confirmBtn.SetImageOver(&confirmBtnImgOver);
-  confirmBtn.SetSoundOver(btnSoundOver);
-  confirmBtn.SetTrigger(trigA);
-  confirmBtn.SetEffectGrow();
+  static GuiButton confirmBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText confirmBtnTxt("OK", 22, (GXColor){0, 0, 255, 255});
+  static GuiImage confirmBtnImg(btnData40x40Square);
+  static GuiImage confirmBtnImgOver(btnData40x40SquareOver);
 
   // CANCEL BUTTON
-  GuiButton cancelBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText cancelBtnTxt("X", 22, (GXColor){255, 0, 0, 255});
-  GuiImage cancelBtnImg(btnData40x40Square);
-  GuiImage cancelBtnImgOver(btnData40x40SquareOver);
-
-  cancelBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
-  cancelBtn.SetPosition(-10, 10);
-  cancelBtn.SetLabel(&cancelBtnTxt);
-  cancelBtn.SetImage(&cancelBtnImg);
-  cancelBtn.SetImageOver(&cancelBtnImgOver);
-  cancelBtn.SetSoundOver(btnSoundOver);
-  cancelBtn.SetTrigger(trigA);
-  cancelBtn.SetEffectGrow();
+  static GuiButton cancelBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText cancelBtnTxt("X", 22, (GXColor){255, 0, 0, 255});
+  static GuiImage cancelBtnImg(btnData40x40Square);
+  static GuiImage cancelBtnImgOver(btnData40x40SquareOver);
 
   // HELP BUTTON
-  GuiButton helpBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
-  GuiText helpBtnTxt("?", 22, helpTxtColor);
-  GuiImage helpBtnImg(btnData40x40Square);
-  GuiImage helpBtnImgOver(btnData40x40SquareOver);
-
-  helpBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
-  helpBtn.SetPosition(10, -10);
-  helpBtn.SetLabel(&helpBtnTxt);
-  helpBtn.SetImage(&helpBtnImg);
-  helpBtn.SetImageOver(&helpBtnImgOver);
-  helpBtn.SetSoundOver(btnSoundOver);
-  helpBtn.SetTrigger(trigA);
-  helpBtn.SetEffectGrow();
+  static GuiButton helpBtn(btnData40x40Square->GetWidth(), btnData40x40Square->GetHeight());
+  static GuiText helpBtnTxt("?", 22, helpTxtColor);
+  static GuiImage helpBtnImg(btnData40x40Square);
+  static GuiImage helpBtnImgOver(btnData40x40SquareOver);
 
   // POWERUP BUTTON
-  GuiButton powerupBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
-  GuiText powerupTxt("Powerups", 22, (GXColor){0, 0, 0, 255});
-  GuiImage powerupImg(btnOutline);
-  GuiImage powerupImgOver(btnOutlineOver);
-
-  powerupBtn.SetAlignment(ALIGN_CENTRE, ALIGN_BOTTOM);
-  powerupBtn.SetPosition(0, -10);
-  powerupBtn.SetLabel(&powerupTxt);
-  powerupBtn.SetImage(&powerupImg);
-  powerupBtn.SetImageOver(&powerupImgOver);
-  powerupBtn.SetSoundOver(btnSoundOver);
-  powerupBtn.SetTrigger(trigA);
-  powerupBtn.SetEffectGrow();
-  powerupBtn.SetState(!isHandicapEnabled[player] ? STATE_DISABLED : STATE_DEFAULT);
-  //powerupBtn.SetVisible(isHandicapEnabled[player]);
+  static GuiButton powerupBtn(btnOutline->GetWidth(), btnOutline->GetHeight());
+  static GuiText powerupTxt("Powerups", 22, (GXColor){0, 0, 0, 255});
+  static GuiImage powerupImg(btnOutline);
+  static GuiImage powerupImgOver(btnOutlineOver);
 
-  promptWindow.Append(&mpOptBgImg);
-  promptWindow.Append(&titleTxt);
-  if (!isGlobalOptions)
+  static bool isBuilt = false;
+  if (!isBuilt)
   {
-    // handicap options
-    promptWindow.Append(&playerLeftArrowBtn);
-    promptWindow.Append(&playerRightArrowBtn);
-    promptWindow.Append(&playerTxt);
-    promptWindow.Append(&handicapLeftArrowBtn);
-    promptWindow.Append(&handicapRightArrowBtn);
-    promptWindow.Append(&handicapTxt);
+    isBuilt = true;
+
+    promptWindow.SetAlignment(ALIGN_CENTRE, ALIGN_MIDDLE);
+    promptWindow.SetPosition(0, 0);
+
+    titleTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    titleTxt.SetPosition(0, 15);
+
+    playerLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    playerLeftArrowBtn.SetPosition(-80, 60);
+    playerLeftArrowBtn.SetLabel(&playerLeftArrowBtnTxt);
+    playerLeftArrowBtn.SetLabelOver(&playerLeftArrowBtnTxtOver);
+    playerLeftArrowBtn.SetImage(&playerLeftArrowBtnImg);
+    playerLeftArrowBtn.SetImageOver(&playerLeftArrowBtnImgOver);
+    playerLeftArrowBtn.SetSoundOver(btnSoundOver);
+    playerLeftArrowBtn.SetTrigger(trigA);
+    playerLeftArrowBtn.SetEffectGrow();
+
+    playerRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    playerRightArrowBtn.SetPosition(80, 60);
+    playerRightArrowBtn.SetLabel(&playerRightArrowBtnTxt);
+    playerRightArrowBtn.SetLabelOver(&playerRightArrowBtnTxtOver);
+    playerRightArrowBtn.SetImage(&playerRightArrowBtnImg);
+    playerRightArrowBtn.SetImageOver(&playerRightArrowBtnImgOver);
+    playerRightArrowBtn.SetSoundOver(btnSoundOver);
+    playerRightArrowBtn.SetTrigger(trigA);
+    playerRightArrowBtn.SetEffectGrow();
+
+    playerTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    playerTxt.SetPosition(0, 60 + PADDING_TOP);
+
+    handicapLeftArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    handicapLeftArrowBtn.SetPosition(-80, 60 + btnData40x40Square->GetHeight());
+    handicapLeftArrowBtn.SetLabel(&handicapLeftArrowBtnTxt);
+    handicapLeftArrowBtn.SetLabelOver(&handicapLeftArrowBtnTxtOver);
+    handicapLeftArrowBtn.SetImage(&handicapLeftArrowBtnImg);
+    handicapLeftArrowBtn.SetImageOver(&handicapLeftArrowBtnImgOver);
+    handicapLeftArrowBtn.SetSoundOver(btnSoundOver);
+    handicapLeftArrowBtn.SetTrigger(trigA);
+    handicapLeftArrowBtn.SetEffectGrow();
+
+    handicapRightArrowBtn.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    handicapRightArrowBtn.SetPosition(80, 60 + btnData40x40Square->GetHeight());
+    handicapRightArrowBtn.SetLabel(&handicapRightArrowBtnTxt);
+    handicapRightArrowBtn.SetLabelOver(&handicapRightArrowBtnTxtOver);
+    handicapRightArrowBtn.SetImage(&handicapRightArrowBtnImg);
+    handicapRightArrowBtn.SetImageOver(&handicapRightArrowBtnImgOver);
+    handicapRightArrowBtn.SetSoundOver(btnSoundOver);
+    handicapRightArrowBtn.SetTrigger(trigA);
+    handicapRightArrowBtn.SetEffectGrow();
+
+    handicapTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    handicapTxt.SetPosition(0, 60 + PADDING_TOP + btnData40x40Square->GetHeight());
+
+    linesTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    linesTxtBtn.SetPosition(10, 60 + PADDING_TOP + 2 * btnData40x40Square->GetHeight());
+    linesTxtBtn.SetLabel(&linesTxtBtnTxt);
+    linesTxtBtn.SetLabelOver(&linesTxtBtnTxtOver);
+    linesTxtBtn.SetSoundOver(btnSoundOver);
+    linesTxtBtn.SetTrigger(trigA);
+
+    linesTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    linesTxt.SetPosition(-20, 60 + PADDING_TOP + 2 * btnData40x40Square->GetHeight());
+
+    linesDefaultBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    linesDefaultBtn.SetPosition(-10 - 2 * btnData40x40Square->GetWidth(), 60 + 2 * btnData40x40Square->GetHeight());
+    linesDefaultBtn.SetLabel(&linesDefaultBtnTxt);
+    linesDefaultBtn.SetLabelOver(&linesDefaultBtnTxtOver);
+    linesDefaultBtn.SetImage(&linesDefaultBtnImg);
+    linesDefaultBtn.SetImageOver(&linesDefaultBtnImgOver);
+    linesDefaultBtn.SetSoundOver(btnSoundOver);
+    linesDefaultBtn.SetTrigger(trigA);
+    linesDefaultBtn.SetEffectGrow();
+
+    linesMinusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    linesMinusBtn.SetPosition(-10 - btnData40x40Square->GetWidth(), 60 + 2 * btnData40x40Square->GetHeight());
+    linesMinusBtn.SetLabel(&linesMinusBtnTxt);
+    linesMinusBtn.SetLabelOver(&linesMinusBtnTxtOver);
+    linesMinusBtn.SetImage(&linesMinusBtnImg);
+    linesMinusBtn.SetImageOver(&linesMinusBtnImgOver);
+    linesMinusBtn.SetSoundOver(btnSoundOver);
+    linesMinusBtn.SetTrigger(trigA);
+    linesMinusBtn.SetEffectGrow();
+
+    linesPlusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    linesPlusBtn.SetPosition(-10, 60 + 2 * btnData40x40Square->GetHeight());
+    linesPlusBtn.SetLabel(&linesPlusBtnTxt);
+    linesPlusBtn.SetLabelOver(&linesPlusBtnTxtOver);
+    linesPlusBtn.SetImage(&linesPlusBtnImg);
+    linesPlusBtn.SetImageOver(&linesPlusBtnImgOver);
+    linesPlusBtn.SetSoundOver(btnSoundOver);
+    linesPlusBtn.SetTrigger(trigA);
+    linesPlusBtn.SetEffectGrow();
+
+    attackTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    attackTxtBtn.SetPosition(10, 60 + PADDING_TOP + 3 * btnData40x40Square->GetHeight());
+    attackTxtBtn.SetLabel(&attackTxtBtnTxt);
+    attackTxtBtn.SetLabelOver(&attackTxtBtnTxtOver);
+    attackTxtBtn.SetSoundOver(btnSoundOver);
+    attackTxtBtn.SetTrigger(trigA);
+
+    attackTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    attackTxt.SetPosition(-20, 60 + PADDING_TOP + 3 * btnData40x40Square->GetHeight());
+
+    attackDefaultBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    attackDefaultBtn.SetPosition(-10 - 2 * btnData40x40Square->GetWidth(), 60 + 3 * btnData40x40Square->GetHeight());
+    attackDefaultBtn.SetLabel(&attackDefaultBtnTxt);
+    attackDefaultBtn.SetLabelOver(&attackDefaultBtnTxtOver);
+    attackDefaultBtn.SetImage(&attackDefaultBtnImg);
+    attackDefaultBtn.SetImageOver(&attackDefaultBtnImgOver);
+    attackDefaultBtn.SetSoundOver(btnSoundOver);
+    attackDefaultBtn.SetTrigger(trigA);
+    attackDefaultBtn.SetEffectGrow();
+
+    attackMinusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    attackMinusBtn.SetPosition(-10 - btnData40x40Square->GetWidth(), 60 + 3 * btnData40x40Square->GetHeight());
+    attackMinusBtn.SetLabel(&attackMinusBtnTxt);
+    attackMinusBtn.SetLabelOver(&attackMinusBtnTxtOver);
+    attackMinusBtn.SetImage(&attackMinusBtnImg);
+    attackMinusBtn.SetImageOver(&attackMinusBtnImgOver);
+    attackMinusBtn.SetSoundOver(btnSoundOver);
+    attackMinusBtn.SetTrigger(trigA);
+    attackMinusBtn.SetEffectGrow();
+
+    attackPlusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    attackPlusBtn.SetPosition(-10, 60 + 3 * btnData40x40Square->GetHeight());
+    attackPlusBtn.SetLabel(&attackPlusBtnTxt);
+    attackPlusBtn.SetLabelOver(&attackPlusBtnTxtOver);
+    attackPlusBtn.SetImage(&attackPlusBtnImg);
+    attackPlusBtn.SetImageOver(&attackPlusBtnImgOver);
+    attackPlusBtn.SetSoundOver(btnSoundOver);
+    attackPlusBtn.SetTrigger(trigA);
+    attackPlusBtn.SetEffectGrow();
+
+    powerupRateTxtBtn.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+    powerupRateTxtBtn.SetPosition(10, 60 + PADDING_TOP + 4 * 40);
+    powerupRateTxtBtn.SetLabel(&powerupRateTxtBtnTxt);
+    powerupRateTxtBtn.SetLabelOver(&powerupRateTxtBtnTxtOver);
+    powerupRateTxtBtn.SetSoundOver(btnSoundOver);
+    powerupRateTxtBtn.SetTrigger(trigA);
+
+    powerupRateTxt.SetAlignment(ALIGN_CENTRE, ALIGN_TOP);
+    powerupRateTxt.SetPosition(-20, 60 + PADDING_TOP + 4 * 40);
+
+    powerupRateDefaultBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    powerupRateDefaultBtn.SetPosition(-10 - 2 * btnData40x40Square->GetWidth(), 60 + 4 * 40);
+    powerupRateDefaultBtn.SetLabel(&powerupRateDefaultBtnTxt);
+    powerupRateDefaultBtn.SetLabelOver(&powerupRateDefaultBtnTxtOver);
+    powerupRateDefaultBtn.SetImage(&powerupRateDefaultBtnImg);
+    powerupRateDefaultBtn.SetImageOver(&powerupRateDefaultBtnImgOver);
+    powerupRateDefaultBtn.SetSoundOver(btnSoundOver);
+    powerupRateDefaultBtn.SetTrigger(trigA);
+    powerupRateDefaultBtn.SetEffectGrow();
+
+    powerupRateMinusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    powerupRateMinusBtn.SetPosition(-10 - btnData40x40Square->GetWidth(), 60 + 4 * 40);
+    powerupRateMinusBtn.SetLabel(&powerupRateMinusBtnTxt);
+    powerupRateMinusBtn.SetLabelOver(&powerupRateMinusBtnTxtOver);
+    powerupRateMinusBtn.SetImage(&powerupRateMinusBtnImg);
+    powerupRateMinusBtn.SetImageOver(&powerupRateMinusBtnImgOver);
+    powerupRateMinusBtn.SetSoundOver(btnSoundOver);
+    powerupRateMinusBtn.SetTrigger(trigA);
+    powerupRateMinusBtn.SetEffectGrow();
+
+    powerupRatePlusBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    powerupRatePlusBtn.SetPosition(-10, 60 + 4 * 40);
+    powerupRatePlusBtn.SetLabel(&powerupRatePlusBtnTxt);
+    powerupRatePlusBtn.SetLabelOver(&powerupRatePlusBtnTxtOver);
+    powerupRatePlusBtn.SetImage(&powerupRatePlusBtnImg);
+    powerupRatePlusBtn.SetImageOver(&powerupRatePlusBtnImgOver);
+    powerupRatePlusBtn.SetSoundOver(btnSoundOver);
+    powerupRatePlusBtn.SetTrigger(trigA);
+    powerupRatePlusBtn.SetEffectGrow();
+
+    confirmBtn.SetAlignment(ALIGN_RIGHT, ALIGN_BOTTOM);
+    confirmBtn.SetPosition(-10, -10);
+    confirmBtn.SetLabel(&confirmBtnTxt);
+    confirmBtn.SetImage(&confirmBtnImg);
+    confirmBtn.SetImageOver(&confirmBtnImgOver);
+    confirmBtn.SetSoundOver(btnSoundOver);
+    confirmBtn.SetTrigger(trigA);
+    confirmBtn.SetEffectGrow();
+
+    cancelBtn.SetAlignment(ALIGN_RIGHT, ALIGN_TOP);
+    cancelBtn.SetPosition(-10, 10);
+    cancelBtn.SetLabel(&cancelBtnTxt);
+    cancelBtn.SetImage(&cancelBtnImg);
+    cancelBtn.SetImageOver(&cancelBtnImgOver);
+    cancelBtn.SetSoundOver(btnSoundOver);
+    cancelBtn.SetTrigger(trigA);
+    cancelBtn.SetEffectGrow();
+
+    helpBtn.SetAlignment(ALIGN_LEFT, ALIGN_BOTTOM);
+    helpBtn.SetPosition(10, -10);
+    helpBtn.SetLabel(&helpBtnTxt);
+    helpBtn.SetImage(&helpBtnImg);
+    helpBtn.SetImageOver(&helpBtnImgOver);
+    helpBtn.SetSoundOver(btnSoundOver);
+    helpBtn.SetTrigger(trigA);
+    helpBtn.SetEffectGrow();
+
+    powerupBtn.SetAlignment(ALIGN_CENTRE, ALIGN_BOTTOM);
+    powerupBtn.SetPosition(0, -10);
+    powerupBtn.SetLabel(&powerupTxt);
+    powerupBtn.SetImage(&powerupImg);
+    powerupBtn.SetImageOver(&powerupImgOver);
+    powerupBtn.SetSoundOver(btnSoundOver);
+    powerupBtn.SetTrigger(trigA);
+    powerupBtn.SetEffectGrow();
+
+    promptWindow.Append(&mpOptBgImg);
+    promptWindow.Append(&titleTxt);
+    promptWindow.Append(&linesTxtBtn);
+    promptWindow.Append(&linesTxt);
+    promptWindow.Append(&linesDefaultBtn);
+    promptWindow.Append(&linesMinusBtn);
+    promptWindow.Append(&linesPlusBtn);
+    promptWindow.Append(&attackTxtBtn);
+    promptWindow.Append(&attackTxt);
+    promptWindow.Append(&attackDefaultBtn);
+    promptWindow.Append(&attackMinusBtn);
+    promptWindow.Append(&attackPlusBtn);
+    promptWindow.Append(&powerupRateTxtBtn);
+    promptWindow.Append(&powerupRateTxt);
+    promptWindow.Append(&powerupRateDefaultBtn);
+    promptWindow.Append(&powerupRateMinusBtn);
+    promptWindow.Append(&powerupRatePlusBtn);
+    promptWindow.Append(&confirmBtn);
+    promptWindow.Append(&cancelBtn);
+    promptWindow.Append(&helpBtn);
+    promptWindow.Append(&powerupBtn);
+  }
+
+  // The same popup serves both the global and the handicap options, so bind
+  // it to whichever set is being edited.
+  GuiElement *handicapElements[] = {
+    &playerLeftArrowBtn, &playerRightArrowBtn, &playerTxt,
+    &handicapLeftArrowBtn, &handicapRightArrowBtn, &handicapTxt
+  };
+  for (u32 i = 0; i < sizeof(handicapElements) / sizeof(handicapElements[0]); ++i)
+  {
+    if (isGlobalOptions)
+      promptWindow.Remove(handicapElements[i]);
+    else
+      promptWindow.Append(handicapElements[i]);
   }
-  promptWindow.Append(&linesTxtBtn);
-  promptWindow.Append(&linesTxt);
-  promptWindow.Append(&linesDefaultBtn);
-  promptWindow.Append(&linesMinusBtn);
-  promptWindow.Append(&linesPlusBtn);
-  promptWindow.Append(&attackTxtBtn);
-  promptWindow.Append(&attackTxt);
-  promptWindow.Append(&attackDefaultBtn);
-  promptWindow.Append(&attackMinusBtn);
-  promptWindow.Append(&attackPlusBtn);
-  promptWindow.Append(&powerupRateTxtBtn);
-  promptWindow.Append(&powerupRateTxt);
-  promptWindow.Append(&powerupRateDefaultBtn);
-  promptWindow.Append(&powerupRateMinusBtn);
-  promptWindow.Append(&powerupRatePlusBtn);
-  promptWindow.Append(&confirmBtn);
-  promptWindow.Append(&cancelBtn);
-  promptWindow.Append(&helpBtn);
-  promptWindow.Append(&powerupBtn);
+
+  promptWindow.SetState(STATE_DEFAULT);
+  promptWindow.ResetEffects();
+
+  titleTxt.SetText(isGlobalOptions ? "Multiplayer Options" : "Handicap Options");
+  playerTxt.SetText(playerBuf);
+  handicapTxt.SetText(isHandicapEnabled[player] ? "enabled" : "disabled");
+
+  if (isHandicapEnabled[player])
+  {
+    linesTxt.SetText(profiles[player].maxLines ? maxLinesBuf : "off");
+    attackTxt.SetText(profiles[player].attackRate ? attackRateBuf : "off");
+    powerupRateTxt.SetText(profiles[player].powerupRate ? powerupRateBuf : "off");
+  }
+  else
+  {
+    linesTxt.SetText("disabled");
+    attackTxt.SetText("disabled");
+    powerupRateTxt.SetText("disabled");
+  }
+  linesTxt.SetColor(blackColor);
+  attackTxt.SetColor(blackColor);
+  powerupRateTxt.SetColor(blackColor);
+
+  //powerupBtn.SetVisible(isHandicapEnabled[player]);
+  powerupBtn.SetState(!isHandicapEnabled[player] ? STATE_DISABLED : STATE_DEFAULT);
 
   promptWindow.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_IN, 50);
   HaltGui();
@@ -2203,7 +2439,7 @@ void TCYC_MenuMpOptionsPopup(bool isGlobalOptions)
 
   while (true)
   {
-    usleep(THREAD_SLEEP);
+    WaitGuiFrame();
 
     if (confirmBtn.GetState() == STATE_CLICKED)
     {
@@ -2562,7 +2798,7 @@ void TCYC_MenuMpOptionsPopup(bool isGlobalOptions)
   }
 
   promptWindow.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_OUT, 50);
-  while (promptWindow.GetEffect() > 0) usleep(THREAD_SLEEP);
+  while (promptWindow.GetEffect() > 0) WaitGuiFrame();
   HaltGui();
   mainWindow->Remove(&promptWindow);
   mainWindow->SetState(STATE_DEFAULT);
@@ -2595,23 +2831,24 @@ void _DoEasterEgg()
 
   bgMusic->SetVolume(20);
 
-  bool loop = true;
-  while (loop)
+  // The heartbeat is only ever heard here, so it's only unpacked for now.
+  u32 heartbeatSize;
+  const u8 *heartbeat = Assets_Acquire("heartbeat.pcm", MEM_TAG_SOUND, &heartbeatSize);
+  GuiSound heartbeatSound(heartbeat, heartbeatSize, SOUND_PCM);
+  heartbeatSound.SetPriority(MIXER_PRIORITY_HIGH);
+
+  GuiButtonPressed(); // discard the press that opened this window
+
+  while (!GuiButtonPressed())
   {
-    if (!g_heartbeatSound->IsPlaying())
-      g_heartbeatSound->Play();
+    if (!heartbeatSound.IsPlaying())
+      heartbeatSound.Play();
 
-    for (int i = 0; i < MAX_PLAYERS; ++i)
-    {
-      if (WPAD_ButtonsDown(i))
-      {
-        loop = false;
-        break;
-      }
-    }
+    WaitGuiFrame();
   }
 
-  g_heartbeatSound->Stop();
+  heartbeatSound.Stop();
+  Assets_Release("heartbeat.pcm");
   bgMusic->SetVolume(50);
 
   HaltGui();
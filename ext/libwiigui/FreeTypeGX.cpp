@@ -21,10 +21,16 @@
  */
 
 #include "FreeTypeGX.h"
+#include "render.h"
+#include "framearena.h"
 
 static FT_Library ftLibrary;	/**< FreeType FT_Library instance. */
 static FT_Face ftFace;			/**< FreeType reusable FT_Face typographic object. */
 static FT_GlyphSlot ftSlot;		/**< FreeType reusable FT_GlyphSlot glyph container object. */
+static FT_UInt ftFaceSize = 0;	/**< Pixel size the shared FT_Face is currently set to. */
+
+static const uint8_t *bakedFonts = NULL;	/**< Pre-rendered font data, see InitBakedFonts. */
+static uint32_t bakedFontsSize = 0;			/**< Size of the pre-rendered font data in bytes. */
 
 FreeTypeGX *fontSystem[MAX_FONT_SIZE+1];
 
@@ -38,9 +44,57 @@ void InitFreeType(uint8_t* fontBuffer, FT_Long bufferSize)
 		fontSystem[i] = NULL;
 }
 
-void ChangeFontSize(FT_UInt pixelSize)
+/**
+ * Sets the pixel size of the shared FT_Face.
+ *
+ * Every FreeTypeGX instance shares one FT_Face, so each instance sets its own size right before FreeType needs it.
+ * The size is only changed when it differs, since FT_Set_Pixel_Sizes recomputes the face metrics.
+ *
+ * @param pixelSize	The requested pixel size.
+ */
+static void setFaceSize(FT_UInt pixelSize)
 {
+	if(ftFaceSize == pixelSize)
+		return;
+
 	FT_Set_Pixel_Sizes(ftFace, 0, pixelSize);
+	ftFaceSize = pixelSize;
+}
+
+/**
+ * Reads a big-endian value from the pre-rendered font data.
+ */
+static uint16_t readU16(const uint8_t *data)
+{
+	return (data[0] << 8) | data[1];
+}
+
+static uint32_t readU32(const uint8_t *data)
+{
+	return (readU16(data) << 16) | readU16(data + 2);
+}
+
+/**
+ * Registers pre-rendered font data built by tools/fontbake.
+ *
+ * Font sizes found in the data are loaded from it when first used instead of being rendered by FreeType; other
+ * sizes, and characters missing from the data, still go through FreeType. The buffer must stay valid.
+ *
+ * @param bakedBuffer	A pointer to the pre-rendered font data.
+ * @param bufferSize	The size of the data in bytes.
+ */
+void InitBakedFonts(const uint8_t* bakedBuffer, uint32_t bufferSize)
+{
+	if(bufferSize < 8 || memcmp(bakedBuffer, "FTGX", 4) != 0 || readU16(bakedBuffer + 4) != FTGX_BAKED_VERSION)
+		return;
+
+	bakedFonts = bakedBuffer;
+	bakedFontsSize = bufferSize;
+}
+
+void ChangeFontSize(FT_UInt pixelSize)
+{
+	setFaceSize(pixelSize);
 }
 
 void ClearFontData()
@@ -89,6 +143,26 @@ FreeTypeGX::FreeTypeGX(FT_UInt pixelSize, uint8_t textureFormat, uint8_t vertexI
 	this->ftPointSize = pixelSize;
 	this->ftKerningEnabled = FT_HAS_KERNING(ftFace);
    this->z = 0; // GX_MAX_Z24 - 1;
+
+	memset(this->glyphTable, 0, sizeof(this->glyphTable));
+	this->atlasData = NULL;
+	this->atlasWidth = 0;
+	this->atlasHeight = 0;
+	this->atlasPenX = 0;
+	this->atlasPenY = 0;
+	this->atlasShelfHeight = 0;
+	this->atlasDirty = false;
+
+	this->isBaked = false;
+	this->bakedKerning = NULL;
+	this->bakedKerningCount = 0;
+
+	if(!this->loadBakedFont())
+	{
+		setFaceSize(pixelSize);
+		this->ftAscender = ftFace->size->metrics.ascender >> 6;
+		this->ftDescender = ftFace->size->metrics.descender >> 6;
+	}
 }
 
 /**
@@ -154,19 +228,19 @@ void FreeTypeGX::setDefaultMode()
 		switch(this->compatibilityMode & 0x00FF)
 		{
 			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_MODULATE:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
+				Render_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
 				break;
 			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_DECAL:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_DECAL);
+				Render_SetTevOp(GX_TEVSTAGE0, GX_DECAL);
 				break;
 			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_BLEND:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_BLEND);
+				Render_SetTevOp(GX_TEVSTAGE0, GX_BLEND);
 				break;
 			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_REPLACE:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_REPLACE);
+				Render_SetTevOp(GX_TEVSTAGE0, GX_REPLACE);
 				break;
 			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_PASSCLR:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+				Render_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
 				break;
 			default:
 				break;
@@ -175,16 +249,16 @@ void FreeTypeGX::setDefaultMode()
 		switch(this->compatibilityMode & 0xFF00)
 		{
 			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_NONE:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_NONE);
+				Render_SetVtxDesc(GX_VA_TEX0, GX_NONE);
 				break;
 			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_DIRECT:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
+				Render_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
 				break;
 			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_INDEX8:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_INDEX8);
+				Render_SetVtxDesc(GX_VA_TEX0, GX_INDEX8);
 				break;
 			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_INDEX16:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_INDEX16);
+				Render_SetVtxDesc(GX_VA_TEX0, GX_INDEX16);
 				break;
 			default:
 				break;
@@ -199,10 +273,17 @@ void FreeTypeGX::setDefaultMode()
  */
 void FreeTypeGX::unloadFont()
 {
+	if(this->atlasData)
+	{
+		MemTrack_Free(this->atlasData);
+		this->atlasData = NULL;
+	}
+	memset(this->glyphTable, 0, sizeof(this->glyphTable));
+
 	if(this->fontData.size() == 0)
 		return;
 	for(std::map<wchar_t, ftgxCharData>::iterator i = this->fontData.begin(); i != this->fontData.end(); i++)
-		free(i->second.glyphDataTexture);
+		MemTrack_Free(i->second.glyphDataTexture);
 	this->fontData.clear();
 }
 
@@ -284,6 +365,7 @@ ftgxCharData *FreeTypeGX::cacheGlyphData(wchar_t charCode)
 	FT_UInt gIndex;
 	uint16_t textureWidth = 0, textureHeight = 0;
 
+	setFaceSize(this->ftPointSize);
 	gIndex = FT_Get_Char_Index( ftFace, charCode );
 	if (!FT_Load_Glyph(ftFace, gIndex, FT_LOAD_DEFAULT )) {
 		FT_Render_Glyph( ftSlot, FT_RENDER_MODE_NORMAL );
@@ -294,7 +376,8 @@ ftgxCharData *FreeTypeGX::cacheGlyphData(wchar_t charCode)
 			textureWidth = adjustTextureWidth(glyphBitmap->width, this->textureFormat);
 			textureHeight = adjustTextureHeight(glyphBitmap->rows, this->textureFormat);
 
-			this->fontData[charCode] = (ftgxCharData){
+			ftgxCharData *charData = &this->fontData[charCode];
+			*charData = (ftgxCharData){
 				ftSlot->bitmap_left,
 				ftSlot->advance.x >> 6,
 				gIndex,
@@ -303,11 +386,15 @@ ftgxCharData *FreeTypeGX::cacheGlyphData(wchar_t charCode)
 				ftSlot->bitmap_top,
 				ftSlot->bitmap_top,
 				glyphBitmap->rows - ftSlot->bitmap_top,
-				NULL
+				NULL,
+				0,
+				0,
+				false
 			};
-			this->loadGlyphData(glyphBitmap, &this->fontData[charCode]);
+			this->loadGlyphData(glyphBitmap, charData);
+			this->packGlyphData(charData);
 
-			return &this->fontData[charCode];
+			return charData;
 		}
 	}
 	return NULL;
@@ -344,7 +431,7 @@ uint16_t FreeTypeGX::cacheGlyphDataComplete()
  */
 void FreeTypeGX::loadGlyphData(FT_Bitmap *bmp, ftgxCharData *charData)
 {
-	uint32_t *glyphData = (uint32_t *)memalign(32, charData->textureWidth * charData->textureHeight * 4);
+	uint32_t *glyphData = (uint32_t *)FrameArena_Alloc(charData->textureWidth * charData->textureHeight * 4, 32);
 	memset(glyphData, 0x00, charData->textureWidth * charData->textureHeight * 4);
 
 	for (uint16_t imagePosY = 0; imagePosY < bmp->rows; imagePosY++)
@@ -381,7 +468,279 @@ void FreeTypeGX::loadGlyphData(FT_Bitmap *bmp, ftgxCharData *charData)
 			charData->glyphDataTexture = Metaphrasis::convertBufferToRGBA8(glyphData, charData->textureWidth, charData->textureHeight);
 			break;
 	}
-	free(glyphData);
+	FrameArena_Free(glyphData);
+}
+
+/**
+ * Looks up the glyph data for a character, caching it if necessary.
+ *
+ * Once cached, characters in the ASCII and Latin-1 range are found with a direct table lookup; any other character
+ * takes a single search of the font map.
+ *
+ * @param charCode	The requested glyph's character code.
+ * @return A pointer to the glyph's font structure, or NULL if the font has no such glyph.
+ */
+ftgxCharData *FreeTypeGX::getGlyphData(wchar_t charCode)
+{
+	bool isInTable = (uint32_t)charCode < FTGX_GLYPH_TABLE_SIZE;
+	if(isInTable && this->glyphTable[charCode])
+		return this->glyphTable[charCode];
+
+	ftgxCharData *glyphData;
+	std::map<wchar_t, ftgxCharData>::iterator i = this->fontData.find(charCode);
+	if(i != this->fontData.end())
+		glyphData = &i->second;
+	else
+		glyphData = this->cacheGlyphData(charCode);
+
+	if(isInTable)
+		this->glyphTable[charCode] = glyphData;
+	return glyphData;
+}
+
+/**
+ * Determines the kerning adjustment between two consecutive glyphs.
+ *
+ * @param prevGlyph	The glyph to the left, or NULL at the start of a string.
+ * @param glyphData	The glyph to the right.
+ * @return The X adjustment in pixels.
+ */
+int16_t FreeTypeGX::getKerning(ftgxCharData *prevGlyph, ftgxCharData *glyphData)
+{
+	if(!this->ftKerningEnabled || !prevGlyph)
+		return 0;
+
+	if(this->isBaked)
+	{
+		// Binary search the sorted pairs; glyphs rendered at runtime get no kerning.
+		uint32_t key = (prevGlyph->glyphIndex << 16) | glyphData->glyphIndex;
+		int lo = 0, hi = this->bakedKerningCount - 1;
+		while(lo <= hi)
+		{
+			int mid = (lo + hi) >> 1;
+			uint32_t midKey = readU32(this->bakedKerning + mid * 6);
+			if(midKey == key)
+				return (int16_t)readU16(this->bakedKerning + mid * 6 + 4);
+			if(midKey < key)
+				lo = mid + 1;
+			else
+				hi = mid - 1;
+		}
+		return 0;
+	}
+
+	setFaceSize(this->ftPointSize);
+	FT_Vector pairDelta;
+	FT_Get_Kerning( ftFace, prevGlyph->glyphIndex, glyphData->glyphIndex, FT_KERNING_DEFAULT, &pairDelta );
+	return pairDelta.x >> 6;
+}
+
+/**
+ * Allocates the glyph atlas texture.
+ *
+ * The atlas is sized to hold FTGX_ATLAS_GLYPHS glyphs of the font's pixel size. It uses the same texture format as
+ * the individual glyph textures, so glyphs can be copied into it tile by tile.
+ *
+ * @return true if the atlas is available.
+ */
+bool FreeTypeGX::createAtlas()
+{
+	if(this->atlasData)
+		return true;
+
+	uint16_t cell = this->ftPointSize + 8;
+	uint32_t height = (FTGX_ATLAS_GLYPHS * cell * cell) / FTGX_ATLAS_WIDTH;
+	if(height > FTGX_ATLAS_MAX_HEIGHT)
+		height = FTGX_ATLAS_MAX_HEIGHT;
+
+	return this->allocateAtlas(FTGX_ATLAS_WIDTH, adjustTextureHeight(height, this->textureFormat));
+}
+
+/**
+ * Allocates an empty glyph atlas texture of the given size.
+ *
+ * @param width	Atlas width in pixels.
+ * @param height	Atlas height in pixels, a multiple of the texture format's tile height.
+ * @return true if the atlas is available.
+ */
+bool FreeTypeGX::allocateAtlas(uint16_t width, uint16_t height)
+{
+	uint32_t size = GX_GetTexBufferSize(width, height, this->textureFormat, GX_FALSE, 0);
+	this->atlasData = (uint8_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, size);
+	if(!this->atlasData)
+		return false;
+
+	memset(this->atlasData, 0x00, size);
+	this->atlasWidth = width;
+	this->atlasHeight = height;
+	this->atlasPenX = 0;
+	this->atlasPenY = 0;
+	this->atlasShelfHeight = 0;
+	this->atlasDirty = true;
+
+	GX_InitTexObj(&this->atlasTexture, this->atlasData, this->atlasWidth, this->atlasHeight, this->textureFormat, GX_CLAMP, GX_CLAMP, GX_FALSE);
+	GX_InitTexObjLOD(&this->atlasTexture, GX_NEAR, GX_NEAR, 0.0f, 0.0f, 0.0f, GX_FALSE, GX_FALSE, GX_ANISO_1);
+	return true;
+}
+
+/**
+ * Loads this size from the pre-rendered font data, if it is there.
+ *
+ * The pre-tiled atlas is copied into an atlas of the usual size, so glyphs missing from the data can still be
+ * rendered at runtime and packed into the space left over. The atlas texture format comes from the data.
+ *
+ * @return true if the size was found and loaded.
+ */
+bool FreeTypeGX::loadBakedFont()
+{
+	if(!bakedFonts)
+		return false;
+
+	const uint8_t *data = bakedFonts + 8;
+	const uint8_t *end = bakedFonts + bakedFontsSize;
+	uint16_t fonts = readU16(bakedFonts + 6);
+
+	for(uint16_t font = 0; font < fonts && data + 28 <= end; font++)
+	{
+		uint16_t glyphCount = readU16(data + 20);
+		uint16_t kerningCount = readU16(data + 22);
+		uint32_t atlasSize = readU32(data + 24);
+		const uint8_t *glyphs = data + 28;
+		const uint8_t *kerning = glyphs + glyphCount * 22;
+		const uint8_t *atlas = kerning + kerningCount * 6;
+
+		if(atlas + atlasSize > end)
+			return false;
+
+		if(readU16(data) != this->ftPointSize)
+		{
+			data = atlas + atlasSize;
+			continue;
+		}
+
+		this->textureFormat = readU16(data + 2);
+		if(!this->allocateAtlas(readU16(data + 8), readU16(data + 10)))
+			return false;
+
+		memcpy(this->atlasData, atlas, atlasSize);
+		this->ftAscender = (int16_t)readU16(data + 4);
+		this->ftDescender = (int16_t)readU16(data + 6);
+		this->atlasPenX = readU16(data + 14);
+		this->atlasPenY = readU16(data + 16);
+		this->atlasShelfHeight = readU16(data + 18);
+
+		for(uint16_t i = 0; i < glyphCount; i++, glyphs += 22)
+		{
+			wchar_t charCode = readU16(glyphs);
+			ftgxCharData *charData = &this->fontData[charCode];
+			*charData = (ftgxCharData){
+				(int16_t)readU16(glyphs + 2),
+				readU16(glyphs + 4),
+				readU16(glyphs + 6),
+				readU16(glyphs + 8),
+				readU16(glyphs + 10),
+				(int16_t)readU16(glyphs + 12),
+				(int16_t)readU16(glyphs + 14),
+				(int16_t)readU16(glyphs + 16),
+				NULL,
+				readU16(glyphs + 18),
+				readU16(glyphs + 20),
+				true
+			};
+
+			if((uint32_t)charCode < FTGX_GLYPH_TABLE_SIZE)
+				this->glyphTable[charCode] = charData;
+		}
+
+		this->bakedKerning = kerning;
+		this->bakedKerningCount = kerningCount;
+		this->isBaked = true;
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Moves a glyph's texture into the glyph atlas.
+ *
+ * Glyphs are packed left to right onto shelves. Glyph textures are already padded to whole texture tiles, and tiles
+ * are stored one after another in row order, so each row of tiles is a single copy. If the atlas is full the glyph
+ * keeps its own texture and is drawn separately.
+ *
+ * @param charData	A pointer to a glyph whose texture was just loaded by loadGlyphData.
+ */
+void FreeTypeGX::packGlyphData(ftgxCharData *charData)
+{
+	uint16_t width = charData->textureWidth;
+	uint16_t height = charData->textureHeight;
+
+	if(width == 0 || height == 0)
+	{
+		// Nothing to draw (e.g., a space).
+		MemTrack_Free(charData->glyphDataTexture);
+		charData->glyphDataTexture = NULL;
+		charData->isInAtlas = true;
+		return;
+	}
+
+	if(!this->createAtlas())
+		return;
+
+	if(this->atlasPenX + width > this->atlasWidth)
+	{
+		this->atlasPenX = 0;
+		this->atlasPenY += this->atlasShelfHeight;
+		this->atlasShelfHeight = 0;
+	}
+
+	if(width > this->atlasWidth || this->atlasPenY + height > this->atlasHeight)
+		return;
+
+	uint16_t tileWidth = adjustTextureWidth(1, this->textureFormat);
+	uint16_t tileHeight = adjustTextureHeight(1, this->textureFormat);
+	uint32_t tileSize = GX_GetTexBufferSize(tileWidth, tileHeight, this->textureFormat, GX_FALSE, 0);
+	uint32_t glyphRowSize = (width / tileWidth) * tileSize;
+	uint32_t atlasRowSize = (this->atlasWidth / tileWidth) * tileSize;
+
+	uint8_t *src = (uint8_t *)charData->glyphDataTexture;
+	uint8_t *dst = this->atlasData + (this->atlasPenY / tileHeight) * atlasRowSize + (this->atlasPenX / tileWidth) * tileSize;
+
+	for(uint16_t row = 0; row < height / tileHeight; row++)
+	{
+		memcpy(dst, src, glyphRowSize);
+		src += glyphRowSize;
+		dst += atlasRowSize;
+	}
+
+	charData->atlasX = this->atlasPenX;
+	charData->atlasY = this->atlasPenY;
+	charData->isInAtlas = true;
+	MemTrack_Free(charData->glyphDataTexture);
+	charData->glyphDataTexture = NULL;
+
+	this->atlasPenX += width;
+	if(height > this->atlasShelfHeight)
+		this->atlasShelfHeight = height;
+	this->atlasDirty = true;
+}
+
+/**
+ * Loads the glyph atlas and sets up the TEV and vertex descriptor for textured glyph quads.
+ *
+ * The texture cache is only invalidated when glyphs were added since the atlas was last loaded.
+ */
+void FreeTypeGX::loadAtlas()
+{
+	Render_LoadTexObj(&this->atlasTexture, GX_TEXMAP0);
+	if(this->atlasDirty)
+	{
+		DCFlushRange(this->atlasData, GX_GetTexBufferSize(this->atlasWidth, this->atlasHeight, this->textureFormat, GX_FALSE, 0));
+		Render_InvalidateTexAll();
+		this->atlasDirty = false;
+	}
+
+	Render_SetTevOp (GX_TEVSTAGE0, GX_MODULATE);
+	Render_SetVtxDesc (GX_VA_TEX0, GX_DIRECT);
 }
 
 /**
@@ -458,9 +817,11 @@ uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, wchar_t *text, GXColor color
 	uint16_t strLength = wcslen(text);
 	uint16_t x_pos = x, printed = 0;
 	uint16_t x_offset = 0, y_offset = 0;
+	uint16_t atlasQuads = 0;
+	bool hasGlyphTextures = false;
 	GXTexObj glyphTexture;
-	FT_Vector pairDelta;
 	ftgxDataOffset offset;
+	ftgxCharData *glyphData, *prevGlyph;
 
 	if(textStyle & FTGX_JUSTIFY_MASK)
 	{
@@ -472,31 +833,95 @@ uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, wchar_t *text, GXColor color
 		y_offset = this->getStyleOffsetHeight(&offset, textStyle);
 	}
 
+	// Cache every glyph up front so the atlas quads can go out as one batch.
 	for (uint16_t i = 0; i < strLength; i++)
 	{
-		ftgxCharData* glyphData = NULL;
-		if( this->fontData.find(text[i]) != this->fontData.end() )
-		{
-			glyphData = &this->fontData[text[i]];
-		}
-		else
+		glyphData = this->getGlyphData(text[i]);
+		if(glyphData == NULL)
+			continue;
+
+		printed++;
+		if(!glyphData->isInAtlas)
+			hasGlyphTextures = true;
+		else if(glyphData->textureWidth && glyphData->textureHeight)
+			atlasQuads++;
+	}
+
+	if(atlasQuads)
+	{
+		this->loadAtlas();
+		Render_Begin(GX_QUADS, this->vertexIndex, atlasQuads * 4);
+
+		f32 scaleX = 1.0f / this->atlasWidth;
+		f32 scaleY = 1.0f / this->atlasHeight;
+		prevGlyph = NULL;
+
+		for (uint16_t i = 0; i < strLength; i++)
 		{
-			glyphData = this->cacheGlyphData(text[i]);
+			glyphData = this->getGlyphData(text[i]);
+			if(glyphData == NULL)
+				continue;
+
+			x_pos += this->getKerning(prevGlyph, glyphData);
+			prevGlyph = glyphData;
+
+			if(glyphData->isInAtlas && glyphData->textureWidth && glyphData->textureHeight)
+			{
+				int16_t screenX = x_pos + glyphData->renderOffsetX + x_offset;
+				int16_t screenY = y - glyphData->renderOffsetY + y_offset;
+				int16_t width = glyphData->textureWidth;
+				int16_t height = glyphData->textureHeight;
+				f32 s0 = glyphData->atlasX * scaleX;
+				f32 t0 = glyphData->atlasY * scaleY;
+				f32 s1 = (glyphData->atlasX + width) * scaleX;
+				f32 t1 = (glyphData->atlasY + height) * scaleY;
+
+				GX_Position2s16(screenX, screenY);
+				GX_Color4u8(color.r, color.g, color.b, color.a);
+				GX_TexCoord2f32(s0, t0);
+
+				GX_Position2s16(width + screenX, screenY);
+				GX_Color4u8(color.r, color.g, color.b, color.a);
+				GX_TexCoord2f32(s1, t0);
+
+				GX_Position2s16(width + screenX, height + screenY);
+				GX_Color4u8(color.r, color.g, color.b, color.a);
+				GX_TexCoord2f32(s1, t1);
+
+				GX_Position2s16(screenX, height + screenY);
+				GX_Color4u8(color.r, color.g, color.b, color.a);
+				GX_TexCoord2f32(s0, t1);
+			}
+
+			x_pos += glyphData->glyphAdvanceX;
 		}
 
-		if(glyphData != NULL)
+		Render_End();
+		this->setDefaultMode();
+	}
+
+	// Glyphs that didn't fit in the atlas are drawn with their own textures.
+	if(hasGlyphTextures)
+	{
+		x_pos = x;
+		prevGlyph = NULL;
+
+		for (uint16_t i = 0; i < strLength; i++)
 		{
-			if(this->ftKerningEnabled && i)
+			glyphData = this->getGlyphData(text[i]);
+			if(glyphData == NULL)
+				continue;
+
+			x_pos += this->getKerning(prevGlyph, glyphData);
+			prevGlyph = glyphData;
+
+			if(!glyphData->isInAtlas)
 			{
-				FT_Get_Kerning( ftFace, this->fontData[text[i - 1]].glyphIndex, glyphData->glyphIndex, FT_KERNING_DEFAULT, &pairDelta );
-				x_pos += pairDelta.x >> 6;
+				GX_InitTexObj(&glyphTexture, glyphData->glyphDataTexture, glyphData->textureWidth, glyphData->textureHeight, this->textureFormat, GX_CLAMP, GX_CLAMP, GX_FALSE);
+				this->copyTextureToFramebuffer(&glyphTexture, glyphData->textureWidth, glyphData->textureHeight, x_pos + glyphData->renderOffsetX + x_offset, y - glyphData->renderOffsetY + y_offset, color);
 			}
 
-			GX_InitTexObj(&glyphTexture, glyphData->glyphDataTexture, glyphData->textureWidth, glyphData->textureHeight, this->textureFormat, GX_CLAMP, GX_CLAMP, GX_FALSE);
-			this->copyTextureToFramebuffer(&glyphTexture, glyphData->textureWidth, glyphData->textureHeight, x_pos + glyphData->renderOffsetX + x_offset, y - glyphData->renderOffsetY + y_offset, color);
-
 			x_pos += glyphData->glyphAdvanceX;
-			printed++;
 		}
 	}
 
@@ -541,29 +966,17 @@ uint16_t FreeTypeGX::getWidth(wchar_t *text)
 {
 	uint16_t strLength = wcslen(text);
 	uint16_t strWidth = 0;
-	FT_Vector pairDelta;
+	ftgxCharData *prevGlyph = NULL;
 
 	for (uint16_t i = 0; i < strLength; i++)
 	{
-
-		ftgxCharData* glyphData = NULL;
-		if( this->fontData.find(text[i]) != this->fontData.end() )
-		{
-			glyphData = &this->fontData[text[i]];
-		}
-		else
-		{
-			glyphData = this->cacheGlyphData(text[i]);
-		}
+		ftgxCharData* glyphData = this->getGlyphData(text[i]);
 
 		if(glyphData != NULL)
 		{
-			if(this->ftKerningEnabled && (i > 0))
-			{
-				FT_Get_Kerning( ftFace, this->fontData[text[i - 1]].glyphIndex, glyphData->glyphIndex, FT_KERNING_DEFAULT, &pairDelta );
-				strWidth += pairDelta.x >> 6;
-			}
+			strWidth += this->getKerning(prevGlyph, glyphData);
 			strWidth += glyphData->glyphAdvanceX;
+			prevGlyph = glyphData;
 		}
 	}
 	return strWidth;
@@ -620,16 +1033,7 @@ void FreeTypeGX::getOffset(wchar_t *text, ftgxDataOffset* offset)
 
 	for (uint16_t i = 0; i < strLength; i++)
 	{
-
-		ftgxCharData* glyphData = NULL;
-		if( this->fontData.find(text[i]) != this->fontData.end() )
-		{
-			glyphData = &this->fontData[text[i]];
-		}
-		else
-		{
-			glyphData = this->cacheGlyphData(text[i]);
-		}
+		ftgxCharData* glyphData = this->getGlyphData(text[i]);
 
 		if(glyphData != NULL)
 		{
@@ -637,8 +1041,8 @@ void FreeTypeGX::getOffset(wchar_t *text, ftgxDataOffset* offset)
 			strMin = glyphData->renderOffsetMin < strMin ? glyphData->renderOffsetMin : strMin;
 		}
 	}
-	offset->ascender = ftFace->size->metrics.ascender>>6;
-	offset->descender = ftFace->size->metrics.descender>>6;
+	offset->ascender = this->ftAscender;
+	offset->descender = this->ftDescender;
 	offset->max = strMax;
 	offset->min = strMin;
 }
@@ -666,11 +1070,11 @@ void FreeTypeGX::getOffset(wchar_t const *text, ftgxDataOffset* offset)
  */
 void FreeTypeGX::copyTextureToFramebuffer(GXTexObj *texObj, f32 texWidth, f32 texHeight, int16_t screenX, int16_t screenY, GXColor color)
 {
-	GX_LoadTexObj(texObj, GX_TEXMAP0);
-	GX_InvalidateTexAll();
+	Render_LoadTexObj(texObj, GX_TEXMAP0);
+	Render_InvalidateTexAll();
 
-	GX_SetTevOp (GX_TEVSTAGE0, GX_MODULATE);
-	GX_SetVtxDesc (GX_VA_TEX0, GX_DIRECT);
+	Render_SetTevOp (GX_TEVSTAGE0, GX_MODULATE);
+	Render_SetVtxDesc (GX_VA_TEX0, GX_DIRECT);
 
    //GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_POS, GX_POS_XY, GX_S16, 0);
    //GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_POS, GX_POS_XYZ, GX_S16, 0);
@@ -680,7 +1084,7 @@ void FreeTypeGX::copyTextureToFramebuffer(GXTexObj *texObj, f32 texWidth, f32 te
    //GX_Position3s16(texWidth + screenX, texHeight + screenY, z);
    //GX_Position3s16(screenX, texHeight + screenY, z);
 
-	GX_Begin(GX_QUADS, this->vertexIndex, 4);
+	Render_Begin(GX_QUADS, this->vertexIndex, 4);
 	GX_Position2s16(screenX, screenY);
 	GX_Color4u8(color.r, color.g, color.b, color.a);
 	GX_TexCoord2f32(0.0f, 0.0f);
@@ -696,7 +1100,7 @@ void FreeTypeGX::copyTextureToFramebuffer(GXTexObj *texObj, f32 texWidth, f32 te
 	GX_Position2s16(screenX, texHeight + screenY);
 	GX_Color4u8(color.r, color.g, color.b, color.a);
 	GX_TexCoord2f32(0.0f, 1.0f);
-	GX_End();
+	Render_End();
 
 	this->setDefaultMode();
 }
@@ -714,8 +1118,8 @@ void FreeTypeGX::copyTextureToFramebuffer(GXTexObj *texObj, f32 texWidth, f32 te
  */
 void FreeTypeGX::copyFeatureToFramebuffer(f32 featureWidth, f32 featureHeight, int16_t screenX, int16_t screenY, GXColor color)
 {
-	GX_SetTevOp (GX_TEVSTAGE0, GX_PASSCLR);
-	GX_SetVtxDesc (GX_VA_TEX0, GX_NONE);
+	Render_SetTevOp (GX_TEVSTAGE0, GX_PASSCLR);
+	Render_SetVtxDesc (GX_VA_TEX0, GX_NONE);
 
    //GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_POS, GX_POS_XY, GX_S16, 0);
    //GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_POS, GX_POS_XYZ, GX_S16, 0);
@@ -724,7 +1128,7 @@ void FreeTypeGX::copyFeatureToFramebuffer(f32 featureWidth, f32 featureHeight, i
    //GX_Position3s16(featureWidth + screenX, featureHeight + screenY, z);
    //GX_Position3s16(screenX, featureHeight + screenY, z);
 
-	GX_Begin(GX_QUADS, this->vertexIndex, 4);
+	Render_Begin(GX_QUADS, this->vertexIndex, 4);
 	GX_Position2s16(screenX, screenY);
 	GX_Color4u8(color.r, color.g, color.b, color.a);
 
@@ -736,7 +1140,7 @@ void FreeTypeGX::copyFeatureToFramebuffer(f32 featureWidth, f32 featureHeight, i
 
 	GX_Position2s16(screenX, featureHeight + screenY);   
 	GX_Color4u8(color.r, color.g, color.b, color.a);
-	GX_End();
+	Render_End();
 
 	this->setDefaultMode();
 }
@@ -164,6 +164,12 @@
 
 #define MAX_FONT_SIZE 100
 
+#define FTGX_GLYPH_TABLE_SIZE	256		/**< Characters below this code (ASCII and Latin-1) are looked up directly. */
+#define FTGX_ATLAS_WIDTH		512		/**< Width in pixels of the glyph atlas texture. */
+#define FTGX_ATLAS_MAX_HEIGHT	1024	/**< Maximum height in pixels of the glyph atlas texture. */
+#define FTGX_ATLAS_GLYPHS		128		/**< Number of full-size glyphs the atlas is sized to hold. */
+#define FTGX_BAKED_VERSION		1		/**< Version of the pre-rendered font data written by tools/fontbake. */
+
 /*! \struct ftgxCharData_
  *
  * Font face character glyph relevant data structure.
@@ -180,7 +186,11 @@ typedef struct ftgxCharData_ {
 	int16_t renderOffsetMax;	/**< Texture Y axis bearing maximum value. */
 	int16_t renderOffsetMin;	/**< Texture Y axis bearing minimum value. */
 
-	uint32_t* glyphDataTexture;	/**< Glyph texture bitmap data buffer. */
+	uint32_t* glyphDataTexture;	/**< Glyph texture bitmap data buffer; NULL once the glyph is in the atlas. */
+
+	uint16_t atlasX;			/**< Texture X position in the glyph atlas. */
+	uint16_t atlasY;			/**< Texture Y position in the glyph atlas. */
+	bool isInAtlas;				/**< Flag indicating the glyph is drawn from the glyph atlas. */
 } ftgxCharData;
 
 /*! \struct ftgxDataOffset_
@@ -236,6 +246,7 @@ typedef struct ftgxDataOffset_ ftgxDataOffset;
 const GXColor ftgxWhite = (GXColor){0xff, 0xff, 0xff, 0xff}; /**< Constant color value used only to sanitize Doxygen documentation. */
 
 void InitFreeType(uint8_t* fontBuffer, FT_Long bufferSize);
+void InitBakedFonts(const uint8_t* bakedBuffer, uint32_t bufferSize);
 void ChangeFontSize(FT_UInt pixelSize);
 wchar_t* charToWideChar(const char* p);
 void ClearFontData();
@@ -254,11 +265,27 @@ class FreeTypeGX {
 	private:
 		FT_UInt ftPointSize;	/**< Requested size of the rendered font. */
 		bool ftKerningEnabled;	/**< Flag indicating the availability of font kerning data. */
+		int16_t ftAscender;		/**< Font ascender in pixels at this size. */
+		int16_t ftDescender;	/**< Font descender in pixels at this size. */
+
+		bool isBaked;				/**< Flag indicating this size was loaded from pre-rendered font data. */
+		const uint8_t *bakedKerning;	/**< Sorted kerning pairs from the pre-rendered font data. */
+		uint16_t bakedKerningCount;	/**< Number of pre-rendered kerning pairs. */
 
 		uint8_t textureFormat;	/**< Defined texture format of the target EFB. */
 		uint8_t vertexIndex;	/**< Vertex format descriptor index. */
 		uint32_t compatibilityMode;	/**< Compatibility mode for default tev operations and vertex descriptors. */
 		std::map<wchar_t, ftgxCharData> fontData; /**< Map which holds the glyph data structures for the corresponding characters. */
+		ftgxCharData *glyphTable[FTGX_GLYPH_TABLE_SIZE]; /**< Direct lookup into fontData for the most common characters. */
+
+		uint8_t *atlasData;			/**< Glyph atlas texture data buffer. */
+		uint16_t atlasWidth;		/**< Glyph atlas texture width in pixels. */
+		uint16_t atlasHeight;		/**< Glyph atlas texture height in pixels. */
+		uint16_t atlasPenX;			/**< Next free X position on the current atlas shelf. */
+		uint16_t atlasPenY;			/**< Y position of the current atlas shelf. */
+		uint16_t atlasShelfHeight;	/**< Height of the tallest glyph on the current atlas shelf. */
+		bool atlasDirty;			/**< Flag indicating the atlas changed since it was last loaded. */
+		GXTexObj atlasTexture;		/**< Texture object for the glyph atlas. */
       int z; /**< Text Z-value. */
 
 		static uint16_t adjustTextureWidth(uint16_t textureWidth, uint8_t textureFormat);
@@ -271,6 +298,14 @@ class FreeTypeGX {
 		ftgxCharData *cacheGlyphData(wchar_t charCode);
 		uint16_t cacheGlyphDataComplete();
 		void loadGlyphData(FT_Bitmap *bmp, ftgxCharData *charData);
+		ftgxCharData *getGlyphData(wchar_t charCode);
+		int16_t getKerning(ftgxCharData *prevGlyph, ftgxCharData *glyphData);
+
+		bool createAtlas();
+		bool allocateAtlas(uint16_t width, uint16_t height);
+		bool loadBakedFont();
+		void packGlyphData(ftgxCharData *charData);
+		void loadAtlas();
 
 		void setDefaultMode();
 
@@ -48,19 +48,23 @@ Metaphrasis::~Metaphrasis() {
 
 uint32_t* Metaphrasis::convertBufferToI4(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
 	uint32_t bufferSize = bufferWidth * bufferHeight >> 1;
-	uint32_t* dataBufferI4 = (uint32_t *)memalign(32, bufferSize);
-	memset(dataBufferI4, 0x00, bufferSize);
-
-	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint32_t* dataBufferI4 = (uint32_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, bufferSize);
 	uint8_t *dst = (uint8_t *)dataBufferI4;
 
 	for(uint16_t y = 0; y < bufferHeight; y += 8) {
+		uint32_t *tileRow = rgbaBuffer + y * bufferWidth;
 		for(uint16_t x = 0; x < bufferWidth; x += 8) {
-			for(uint16_t rows = 0; rows < 8; rows++) {
-				*dst++ = (src[((y + rows) * bufferWidth) + (x + 0)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 1)] & 0xf0) >> 4);
-				*dst++ = (src[((y + rows) * bufferWidth) + (x + 2)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 3)] & 0xf0) >> 4);
-				*dst++ = (src[((y + rows) * bufferWidth) + (x + 4)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 5)] & 0xf0) >> 4);
-				*dst++ = (src[((y + rows) * bufferWidth) + (x + 5)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 7)] & 0xf0) >> 4);
+			uint32_t *src = tileRow + x;
+			for(uint16_t rows = 0; rows < 8; rows++, src += bufferWidth) {
+				// Pixel 5 is used twice and pixel 6 is skipped; kept as is so the output doesn't change.
+				// The pixels are read first, as the byte stores could otherwise alias them.
+				uint32_t p0 = src[0], p1 = src[1], p2 = src[2], p3 = src[3];
+				uint32_t p4 = src[4], p5 = src[5], p7 = src[7];
+				dst[0] = (p0 & 0xf0) | ((p1 & 0xf0) >> 4);
+				dst[1] = (p2 & 0xf0) | ((p3 & 0xf0) >> 4);
+				dst[2] = (p4 & 0xf0) | ((p5 & 0xf0) >> 4);
+				dst[3] = (p5 & 0xf0) | ((p7 & 0xf0) >> 4);
+				dst += 4;
 			}
 		}
 	}
@@ -82,23 +86,23 @@ uint32_t* Metaphrasis::convertBufferToI4(uint32_t* rgbaBuffer, uint16_t bufferWi
 
 uint32_t* Metaphrasis::convertBufferToI8(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
 	uint32_t bufferSize = bufferWidth * bufferHeight;
-	uint32_t* dataBufferI8 = (uint32_t *)memalign(32, bufferSize);
-	memset(dataBufferI8, 0x00, bufferSize);
-
-	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint32_t* dataBufferI8 = (uint32_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, bufferSize);
 	uint8_t *dst = (uint8_t *)dataBufferI8;
 
 	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		uint32_t *tileRow = rgbaBuffer + y * bufferWidth;
 		for(uint16_t x = 0; x < bufferWidth; x += 8) {
-			for(uint16_t rows = 0; rows < 4; rows++) {
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 0)] & 0xff;
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 1)] & 0xff;
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 2)] & 0xff;
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 3)] & 0xff;
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 4)] & 0xff;
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 5)] & 0xff;
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 6)] & 0xff;
-				*dst++ = src[((y + rows) * bufferWidth) + (x + 7)] & 0xff;
+			uint32_t *src = tileRow + x;
+			for(uint16_t rows = 0; rows < 4; rows++, src += bufferWidth) {
+				dst[0] = src[0] & 0xff;
+				dst[1] = src[1] & 0xff;
+				dst[2] = src[2] & 0xff;
+				dst[3] = src[3] & 0xff;
+				dst[4] = src[4] & 0xff;
+				dst[5] = src[5] & 0xff;
+				dst[6] = src[6] & 0xff;
+				dst[7] = src[7] & 0xff;
+				dst += 8;
 			}
 		}
 	}
@@ -138,23 +142,23 @@ uint8_t Metaphrasis::convertRGBAToIA4(uint32_t rgba) {
 
 uint32_t* Metaphrasis::convertBufferToIA4(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
 	uint32_t bufferSize = bufferWidth * bufferHeight;
-	uint32_t* dataBufferIA4 = (uint32_t *)memalign(32, bufferSize);
-	memset(dataBufferIA4, 0x00, bufferSize);
-
-	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint32_t* dataBufferIA4 = (uint32_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, bufferSize);
 	uint8_t *dst = (uint8_t *)dataBufferIA4;
 
 	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		uint32_t *tileRow = rgbaBuffer + y * bufferWidth;
 		for(uint16_t x = 0; x < bufferWidth; x += 8) {
-			for(uint16_t rows = 0; rows < 4; rows++) {
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 0)]);
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 1)]);
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 2)]);
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 3)]);
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 4)]);
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 5)]);
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 6)]);
-				*dst++ = Metaphrasis::convertRGBAToIA4(src[((y + rows) * bufferWidth) + (x + 7)]);
+			uint32_t *src = tileRow + x;
+			for(uint16_t rows = 0; rows < 4; rows++, src += bufferWidth) {
+				dst[0] = Metaphrasis::convertRGBAToIA4(src[0]);
+				dst[1] = Metaphrasis::convertRGBAToIA4(src[1]);
+				dst[2] = Metaphrasis::convertRGBAToIA4(src[2]);
+				dst[3] = Metaphrasis::convertRGBAToIA4(src[3]);
+				dst[4] = Metaphrasis::convertRGBAToIA4(src[4]);
+				dst[5] = Metaphrasis::convertRGBAToIA4(src[5]);
+				dst[6] = Metaphrasis::convertRGBAToIA4(src[6]);
+				dst[7] = Metaphrasis::convertRGBAToIA4(src[7]);
+				dst += 8;
 			}
 		}
 	}
@@ -194,19 +198,19 @@ uint16_t Metaphrasis::convertRGBAToIA8(uint32_t rgba) {
 
 uint32_t* Metaphrasis::convertBufferToIA8(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
 	uint32_t bufferSize = (bufferWidth * bufferHeight) << 1;
-	uint32_t* dataBufferIA8 = (uint32_t *)memalign(32, bufferSize);
-	memset(dataBufferIA8, 0x00, bufferSize);
-
-	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint32_t* dataBufferIA8 = (uint32_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, bufferSize);
 	uint16_t *dst = (uint16_t *)dataBufferIA8;
 
 	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		uint32_t *tileRow = rgbaBuffer + y * bufferWidth;
 		for(uint16_t x = 0; x < bufferWidth; x += 4) {
-			for(uint16_t rows = 0; rows < 4; rows++) {
-				*dst++ = Metaphrasis::convertRGBAToIA8(src[((y + rows) * bufferWidth) + (x + 0)]);
-				*dst++ = Metaphrasis::convertRGBAToIA8(src[((y + rows) * bufferWidth) + (x + 1)]);
-				*dst++ = Metaphrasis::convertRGBAToIA8(src[((y + rows) * bufferWidth) + (x + 2)]);
-				*dst++ = Metaphrasis::convertRGBAToIA8(src[((y + rows) * bufferWidth) + (x + 3)]);
+			uint32_t *src = tileRow + x;
+			for(uint16_t rows = 0; rows < 4; rows++, src += bufferWidth) {
+				dst[0] = Metaphrasis::convertRGBAToIA8(src[0]);
+				dst[1] = Metaphrasis::convertRGBAToIA8(src[1]);
+				dst[2] = Metaphrasis::convertRGBAToIA8(src[2]);
+				dst[3] = Metaphrasis::convertRGBAToIA8(src[3]);
+				dst += 4;
 			}
 		}
 	}
@@ -228,26 +232,26 @@ uint32_t* Metaphrasis::convertBufferToIA8(uint32_t* rgbaBuffer, uint16_t bufferW
 
 uint32_t* Metaphrasis::convertBufferToRGBA8(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
 	uint32_t bufferSize = (bufferWidth * bufferHeight) << 2;
-	uint32_t* dataBufferRGBA8 = (uint32_t *)memalign(32, bufferSize);
-	memset(dataBufferRGBA8, 0x00, bufferSize);
-
-	uint8_t *src = (uint8_t *)rgbaBuffer;
+	uint32_t* dataBufferRGBA8 = (uint32_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, bufferSize);
 	uint8_t *dst = (uint8_t *)dataBufferRGBA8;
+	uint32_t rowStride = bufferWidth * 4;
 
 	for(uint16_t block = 0; block < bufferHeight; block += 4) {
+		uint8_t *tileRow = (uint8_t *)rgbaBuffer + block * rowStride;
 		for(uint16_t i = 0; i < bufferWidth; i += 4) {
-			for (uint16_t c = 0; c < 4; c++) {
-				for (uint16_t ar = 0; ar < 4; ar++) {
-					*dst++ = src[(((i + ar) + ((block + c) * bufferWidth)) * 4) + 3];
-					*dst++ = src[((i + ar) + ((block + c) * bufferWidth)) * 4];
-				}
-			}
-			for (uint16_t c = 0; c < 4; c++) {
-				for (uint16_t gb = 0; gb < 4; gb++) {
-					*dst++ = src[(((i + gb) + ((block + c) * bufferWidth)) * 4) + 1];
-					*dst++ = src[(((i + gb) + ((block + c) * bufferWidth)) * 4) + 2];
+			// Each tile is 32 bytes of AR pairs followed by 32 bytes of GB pairs.
+			uint8_t *ar = dst;
+			uint8_t *gb = dst + 32;
+			uint8_t *src = tileRow + i * 4;
+			for (uint16_t c = 0; c < 4; c++, src += rowStride) {
+				for (uint16_t n = 0; n < 16; n += 4) {
+					*ar++ = src[n + 3];
+					*ar++ = src[n];
+					*gb++ = src[n + 1];
+					*gb++ = src[n + 2];
 				}
 			}
+			dst += 64;
 		}
 	}
 	DCFlushRange(dataBufferRGBA8, bufferSize);
@@ -288,19 +292,19 @@ uint16_t Metaphrasis::convertRGBAToRGB565(uint32_t rgba) {
 
 uint32_t* Metaphrasis::convertBufferToRGB565(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
 	uint32_t bufferSize = (bufferWidth * bufferHeight) << 1;
-	uint32_t* dataBufferRGB565 = (uint32_t *)memalign(32, bufferSize);
-	memset(dataBufferRGB565, 0x00, bufferSize);
-
-	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint32_t* dataBufferRGB565 = (uint32_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, bufferSize);
 	uint16_t *dst = (uint16_t *)dataBufferRGB565;
 
 	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		uint32_t *tileRow = rgbaBuffer + y * bufferWidth;
 		for(uint16_t x = 0; x < bufferWidth; x += 4) {
-			for(uint16_t rows = 0; rows < 4; rows++) {
-				*dst++ = Metaphrasis::convertRGBAToRGB565(src[((y + rows) * bufferWidth) + (x + 0)]);
-				*dst++ = Metaphrasis::convertRGBAToRGB565(src[((y + rows) * bufferWidth) + (x + 1)]);
-				*dst++ = Metaphrasis::convertRGBAToRGB565(src[((y + rows) * bufferWidth) + (x + 2)]);
-				*dst++ = Metaphrasis::convertRGBAToRGB565(src[((y + rows) * bufferWidth) + (x + 3)]);
+			uint32_t *src = tileRow + x;
+			for(uint16_t rows = 0; rows < 4; rows++, src += bufferWidth) {
+				dst[0] = Metaphrasis::convertRGBAToRGB565(src[0]);
+				dst[1] = Metaphrasis::convertRGBAToRGB565(src[1]);
+				dst[2] = Metaphrasis::convertRGBAToRGB565(src[2]);
+				dst[3] = Metaphrasis::convertRGBAToRGB565(src[3]);
+				dst += 4;
 			}
 		}
 	}
@@ -348,6 +352,20 @@ uint16_t Metaphrasis::convertRGBAToRGB5A3(uint32_t rgba) {
 	return color;
 }
 	
+/*
+ * The same conversion without the branch on alpha, for the buffer loop: both
+ * results are computed and one is masked in. Images with mixed alpha would
+ * otherwise mispredict the branch on most pixels.
+ */
+
+static inline uint16_t pixelToRGB5A3(uint32_t rgba) {
+	uint32_t opaque = 0x8000 | ((rgba >> 17) & 0x7c00) | ((rgba >> 14) & 0x3e0) | ((rgba >> 11) & 0x1f);
+	uint32_t translucent = ((rgba << 7) & 0x7000) | ((rgba >> 20) & 0xf00) | ((rgba >> 16) & 0xf0) | ((rgba >> 12) & 0xf);
+	uint32_t mask = 0 - (uint32_t)((rgba & 0xff) > 0xe0);
+
+	return (opaque & mask) | (translucent & ~mask);
+}
+
 /**
  * Convert the specified RGBA data buffer into the RGB5A3 texture format
  * 
@@ -361,19 +379,19 @@ uint16_t Metaphrasis::convertRGBAToRGB5A3(uint32_t rgba) {
 
 uint32_t* Metaphrasis::convertBufferToRGB5A3(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
 	uint32_t bufferSize = (bufferWidth * bufferHeight) << 1;
-	uint32_t* dataBufferRGB5A3 = (uint32_t *)memalign(32, bufferSize);
-	memset(dataBufferRGB5A3, 0x00, bufferSize);
-
-	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint32_t* dataBufferRGB5A3 = (uint32_t *)MemTrack_Memalign(MEM_TAG_GLYPH, 32, bufferSize);
 	uint16_t *dst = (uint16_t *)dataBufferRGB5A3;
 
 	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		uint32_t *tileRow = rgbaBuffer + y * bufferWidth;
 		for(uint16_t x = 0; x < bufferWidth; x += 4) {
-			for(uint16_t rows = 0; rows < 4; rows++) {
-				*dst++ = Metaphrasis::convertRGBAToRGB5A3(src[((y + rows) * bufferWidth) + (x + 0)]);
-				*dst++ = Metaphrasis::convertRGBAToRGB5A3(src[((y + rows) * bufferWidth) + (x + 1)]);
-				*dst++ = Metaphrasis::convertRGBAToRGB5A3(src[((y + rows) * bufferWidth) + (x + 2)]);
-				*dst++ = Metaphrasis::convertRGBAToRGB5A3(src[((y + rows) * bufferWidth) + (x + 3)]);
+			uint32_t *src = tileRow + x;
+			for(uint16_t rows = 0; rows < 4; rows++, src += bufferWidth) {
+				dst[0] = pixelToRGB5A3(src[0]);
+				dst[1] = pixelToRGB5A3(src[1]);
+				dst[2] = pixelToRGB5A3(src[2]);
+				dst[3] = pixelToRGB5A3(src[3]);
+				dst += 4;
 			}
 		}
 	}
@@ -81,6 +81,7 @@
 #include <stdint.h>
 #include <malloc.h>
 #include <string.h>
+#include "memtrack.h"
 
 /*! \class Metaphrasis
  * \brief A static conversion class for transforming RGBA image buffers into verious GX texture formats for
@@ -0,0 +1,270 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * assets.cpp
+ * Packed asset archive, with LZ4 entries decompressed on demand
+ *
+ * The archive is built by tools/assetpack and linked in as assets_pak.
+ * Assets_Acquire hands out a shared copy of an entry, decompressed the
+ * first time it is acquired and freed when the last user releases it, so
+ * big sounds only take memory while a screen is using them. Entries that
+ * are stored uncompressed are used in place. Assets_Load decompresses
+ * into a buffer the caller owns instead.
+ ***************************************************************************/
+
+#include <gccore.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "assets.h"
+#include "memtrack.h"
+#include "startup.h"
+
+struct AssetEntry
+{
+	const char * name;
+	const u8 * packed;
+	u32 packedSize;
+	u32 size;
+	u32 flags;
+	u8 * data; // the decompressed copy while acquired
+	u16 refs;
+};
+
+static AssetEntry * entries = NULL;
+static int entryCount = 0;
+static bool isAligned = false; // stored entries can be used in place
+
+static u32 ReadU16(const u8 * p)
+{
+	return (p[0] << 8) | p[1];
+}
+
+static u32 ReadU32(const u8 * p)
+{
+	return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+/****************************************************************************
+ * DecompressLZ4
+ *
+ * Decodes one LZ4 block; returns false if the block is corrupt or doesn't
+ * decode to exactly dstSize bytes
+ ***************************************************************************/
+static bool DecompressLZ4(const u8 * src, u32 srcSize, u8 * dst, u32 dstSize)
+{
+	const u8 * in = src;
+	const u8 * inEnd = src + srcSize;
+	u8 * out = dst;
+	u8 * outEnd = dst + dstSize;
+
+	while(in < inEnd)
+	{
+		u8 token = *in++;
+		u32 length = token >> 4;
+
+		if(length == 15)
+		{
+			u8 b;
+			do
+			{
+				if(in == inEnd)
+					return false;
+				b = *in++;
+				length += b;
+			} while(b == 255);
+		}
+
+		if(length > (u32)(inEnd - in) || length > (u32)(outEnd - out))
+			return false;
+
+		memcpy(out, in, length);
+		in += length;
+		out += length;
+
+		if(in == inEnd)
+			break; // the last sequence has no match
+
+		if(inEnd - in < 2)
+			return false;
+
+		u32 offset = in[0] | (in[1] << 8);
+		in += 2;
+		length = (token & 0xF) + 4;
+
+		if((token & 0xF) == 15)
+		{
+			u8 b;
+			do
+			{
+				if(in == inEnd)
+					return false;
+				b = *in++;
+				length += b;
+			} while(b == 255);
+		}
+
+		if(!offset || offset > (u32)(out - dst) || length > (u32)(outEnd - out))
+			return false;
+
+		// matches may overlap their own output, so copy forwards
+		const u8 * match = out - offset;
+		while(length--)
+			*out++ = *match++;
+	}
+	return out == outEnd;
+}
+
+static AssetEntry * FindEntry(const char * name)
+{
+	for(int i=0; i < entryCount; i++)
+		if(strcmp(entries[i].name, name) == 0)
+			return &entries[i];
+	return NULL;
+}
+
+/****************************************************************************
+ * Assets_Init
+ *
+ * Reads the index of the archive; the archive must stay in memory
+ ***************************************************************************/
+bool Assets_Init(const u8 * pak, u32 size)
+{
+	if(!pak || size < ASSETPACK_HEADER || memcmp(pak, "TCPK", 4) != 0 ||
+		ReadU16(pak + 4) != ASSETPACK_VERSION)
+		return false;
+
+	int count = ReadU16(pak + 6);
+	const u8 * index = pak + ASSETPACK_HEADER;
+
+	if(ASSETPACK_HEADER + count * (ASSETPACK_NAME + 16) > size)
+		return false;
+
+	AssetEntry * table = (AssetEntry *)MemTrack_Malloc(MEM_TAG_OTHER, count * sizeof(AssetEntry));
+
+	if(!table)
+		return false;
+
+	for(int i=0; i < count; i++, index += ASSETPACK_NAME + 16)
+	{
+		AssetEntry * e = &table[i];
+		u32 offset = ReadU32(index + ASSETPACK_NAME);
+		e->name = (const char *)index;
+		e->packedSize = ReadU32(index + ASSETPACK_NAME + 4);
+		e->size = ReadU32(index + ASSETPACK_NAME + 8);
+		e->flags = ReadU32(index + ASSETPACK_NAME + 12);
+		e->packed = pak + offset;
+		e->data = NULL;
+		e->refs = 0;
+
+		if(offset > size || e->packedSize > size - offset)
+		{
+			MemTrack_Free(table);
+			return false;
+		}
+	}
+
+	if(entries)
+		MemTrack_Free(entries);
+
+	entries = table;
+	entryCount = count;
+	isAligned = ((u32)pak % ASSETPACK_ALIGN) == 0;
+	return true;
+}
+
+/****************************************************************************
+ * Assets_GetSize
+ *
+ * Returns the decompressed size of an entry, or 0 if there is no such entry
+ ***************************************************************************/
+u32 Assets_GetSize(const char * name)
+{
+	AssetEntry * e = FindEntry(name);
+	return e ? e->size : 0;
+}
+
+/****************************************************************************
+ * Assets_Load
+ *
+ * Decompresses an entry into the given buffer, which must hold at least
+ * Assets_GetSize bytes
+ ***************************************************************************/
+bool Assets_Load(const char * name, u8 * dst, u32 dstSize)
+{
+	AssetEntry * e = FindEntry(name);
+
+	if(!e || dstSize < e->size)
+		return false;
+
+	if(!(e->flags & ASSETPACK_LZ4))
+	{
+		memcpy(dst, e->packed, e->size);
+		return true;
+	}
+	return DecompressLZ4(e->packed, e->packedSize, dst, e->size);
+}
+
+/****************************************************************************
+ * Assets_Acquire
+ *
+ * Returns the contents of an entry, 32 byte aligned and flushed from the
+ * data cache so ASND and GX can read it. The memory is booked under tag.
+ * Every call must be matched by an Assets_Release.
+ ***************************************************************************/
+const u8 * Assets_Acquire(const char * name, u8 tag, u32 * size)
+{
+	AssetEntry * e = FindEntry(name);
+
+	if(!e)
+		return NULL;
+
+	if(size)
+		*size = e->size;
+
+	if(!(e->flags & ASSETPACK_LZ4) && isAligned)
+		return e->packed;
+
+	if(!e->data)
+	{
+		e->data = (u8 *)MemTrack_Memalign(tag, ASSETPACK_ALIGN, e->size);
+
+		if(!e->data)
+			return NULL;
+
+		u32 start = Startup_Now();
+
+		if(!Assets_Load(name, e->data, e->size))
+		{
+			MemTrack_Free(e->data);
+			e->data = NULL;
+			return NULL;
+		}
+
+		DCFlushRange(e->data, e->size);
+		Startup_Load(e->name, start);
+	}
+
+	e->refs++;
+	return e->data;
+}
+
+/****************************************************************************
+ * Assets_Release
+ *
+ * Drops a reference taken by Assets_Acquire; the last one frees the copy
+ ***************************************************************************/
+void Assets_Release(const char * name)
+{
+	AssetEntry * e = FindEntry(name);
+
+	if(!e || !e->refs)
+		return;
+
+	if(--e->refs == 0)
+	{
+		MemTrack_Free(e->data);
+		e->data = NULL;
+	}
+}
@@ -0,0 +1,27 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * assets.h
+ * Packed asset archive, with LZ4 entries decompressed on demand
+ ***************************************************************************/
+
+#ifndef _ASSETS_H_
+#define _ASSETS_H_
+
+#include <gccore.h>
+
+// These must match tools/assetpack.cpp.
+#define ASSETPACK_VERSION 1
+#define ASSETPACK_HEADER 16
+#define ASSETPACK_NAME 32
+#define ASSETPACK_ALIGN 32
+#define ASSETPACK_LZ4 0x1
+
+bool Assets_Init(const u8 * pak, u32 size);
+u32 Assets_GetSize(const char * name);
+bool Assets_Load(const char * name, u8 * dst, u32 dstSize);
+const u8 * Assets_Acquire(const char * name, u8 tag, u32 * size);
+void Assets_Release(const char * name);
+
+#endif
@@ -9,17 +9,52 @@
 #include <gccore.h>
 #include <ogcsys.h>
 #include <asndlib.h>
+#include <string.h>
+
+#include "audio.h"
+#include "mixer.h"
+
+static short mixBuffer[2][AUDIO_MIX_FRAMES * 2] ATTRIBUTE_ALIGN(32);
+static int mixNext = 0; // the buffer the next frames are mixed into
+static s32 mixVoice = -1;
+
+/****************************************************************************
+ * MixerCallback
+ *
+ * Called by ASND when the sound effects voice has room for another buffer
+ ***************************************************************************/
+static void MixerCallback(s32 voice)
+{
+	if(!ASND_TestVoiceBufferReady(voice))
+		return;
+
+	Mixer_Render(mixBuffer[mixNext], AUDIO_MIX_FRAMES);
+	DCFlushRange(mixBuffer[mixNext], sizeof(mixBuffer[0]));
+
+	if(ASND_AddVoice(voice, mixBuffer[mixNext], sizeof(mixBuffer[0])) == SND_OK)
+		mixNext ^= 1;
+}
 
 /****************************************************************************
  * InitAudio
  *
- * Initializes the Wii's audio subsystem
+ * Initializes the Wii's audio subsystem, and starts the voice that plays
+ * the sound effects mixer
  ***************************************************************************/
 void InitAudio()
 {
 	AUDIO_Init(NULL);
 	ASND_Init();
 	ASND_Pause(0);
+
+	memset(mixBuffer, 0, sizeof(mixBuffer));
+	DCFlushRange(mixBuffer, sizeof(mixBuffer));
+	mixNext = 1;
+	mixVoice = ASND_GetFirstUnusedVoice();
+
+	if(mixVoice >= 0)
+		ASND_SetVoice(mixVoice, VOICE_STEREO_16BIT, MIXER_RATE, 0, mixBuffer[0],
+			sizeof(mixBuffer[0]), 255, 255, MixerCallback);
 }
 
 /****************************************************************************
@@ -31,5 +66,11 @@ void InitAudio()
 void ShutdownAudio()
 {
 	ASND_Pause(1);
+
+	if(mixVoice >= 0)
+	{
+		ASND_StopVoice(mixVoice);
+		mixVoice = -1;
+	}
 	ASND_End();
 }
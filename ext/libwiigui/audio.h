@@ -9,6 +9,8 @@
 #ifndef _AUDIO_H_
 #define _AUDIO_H_
 
+#define AUDIO_MIX_FRAMES 512 // frames per sound effects buffer, about 11 ms
+
 void InitAudio();
 void ShutdownAudio();
 
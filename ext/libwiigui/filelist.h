@@ -14,8 +14,9 @@
 extern const u8		font_ttf[];
 extern const u32	font_ttf_size;
 
-extern const u8		bg_music_ogg[];
-extern const u32	bg_music_ogg_size;
+// heartbeat.pcm, tetris_cheer.pcm and tetris.mod are packed in here; see assets.h
+extern const u8		assets_pak[];
+extern const u32	assets_pak_size;
 
 extern const u8		button_over_pcm[];
 extern const u32	button_over_pcm_size;
@@ -143,12 +144,6 @@ extern const u32	down_arrow_over_png_size;
 extern const u8		tetricycle_by_dj_dimz_ogg[];
 extern const u32	tetricycle_by_dj_dimz_ogg_size;
 
-extern const u8	  tetris_cheer_pcm[];
-extern const u32	tetris_cheer_pcm_size;
-
-extern const u8	  heartbeat_pcm[];
-extern const u32	heartbeat_pcm_size;
-
 extern const u8	  powerup_default_pcm[];
 extern const u32	powerup_default_pcm_size;
 
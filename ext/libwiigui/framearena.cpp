@@ -0,0 +1,155 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * framearena.cpp
+ * Frame-scoped bump allocator for short-lived buffers
+ ***************************************************************************/
+
+#include <gccore.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "framearena.h"
+
+#if FRAMEARENA_CHECK
+#define ARENA_HEADER 32 // keeps the payload 32 byte aligned
+#define ARENA_MAGIC 0x46524D41 // 'FRMA'
+#define ARENA_POISON 0xDB
+
+typedef struct _arenaheader {
+	u32 magic;
+	u32 frame; // frame the buffer was handed out in
+	u32 size;
+} ArenaHeader;
+#else
+#define ARENA_HEADER 0
+#endif
+
+static u8 arena[FRAMEARENA_SIZE] ATTRIBUTE_ALIGN(32);
+static u32 arenaTop = 0; // first free byte
+static lwp_t arenaOwner = LWP_THREAD_NULL; // thread that renders
+static FrameArenaStats stats;
+static FrameArenaStats lastStats;
+#if FRAMEARENA_CHECK
+static u32 arenaFrame = 0;
+static int arenaLive = 0; // buffers handed out this frame and not yet freed
+#endif
+
+/****************************************************************************
+ * FrameArena_Alloc
+ *
+ * Returns a buffer that is valid until the end of the current frame. Must
+ * be released with FrameArena_Free.
+ ***************************************************************************/
+void * FrameArena_Alloc(u32 size, u32 align)
+{
+	if(align < 4)
+		align = 4;
+
+	if(LWP_GetSelf() == arenaOwner)
+	{
+		u32 start = (arenaTop + ARENA_HEADER + align - 1) & ~(align - 1);
+
+		if(start + size <= FRAMEARENA_SIZE)
+		{
+			arenaTop = start + size;
+			stats.used = arenaTop;
+#if FRAMEARENA_CHECK
+			ArenaHeader * header = (ArenaHeader *)(arena + start - sizeof(ArenaHeader));
+			header->magic = ARENA_MAGIC;
+			header->frame = arenaFrame;
+			header->size = size;
+			arenaLive++;
+#endif
+			return arena + start;
+		}
+	}
+
+	stats.fallbacks++;
+	return memalign(align > 32 ? align : 32, size);
+}
+
+/****************************************************************************
+ * FrameArena_StrDup
+ ***************************************************************************/
+char * FrameArena_StrDup(const char * str)
+{
+	u32 len = strlen(str) + 1;
+	char * copy = (char *)FrameArena_Alloc(len, 1);
+
+	if(copy)
+		memcpy(copy, str, len);
+	return copy;
+}
+
+/****************************************************************************
+ * FrameArena_Free
+ *
+ * Arena memory is only reclaimed when the frame ends; heap fallbacks are
+ * freed right away.
+ ***************************************************************************/
+void FrameArena_Free(void * ptr)
+{
+	if(!ptr)
+		return;
+
+	if(!FrameArena_Owns(ptr))
+	{
+		free(ptr);
+		return;
+	}
+
+#if FRAMEARENA_CHECK
+	ArenaHeader * header = (ArenaHeader *)((u8 *)ptr - sizeof(ArenaHeader));
+
+	if(header->magic != ARENA_MAGIC || header->frame != arenaFrame)
+	{
+		stats.staleFrees++;
+		printf("FrameArena: %p released after its frame ended\n", ptr);
+		return;
+	}
+	header->magic = 0;
+	arenaLive--;
+#endif
+}
+
+bool FrameArena_Owns(const void * ptr)
+{
+	return (const u8 *)ptr >= arena && (const u8 *)ptr < arena + FRAMEARENA_SIZE;
+}
+
+/****************************************************************************
+ * FrameArena_Reset
+ *
+ * Called by the rendering thread once a frame has been submitted. Empties
+ * the arena and hands it to the calling thread.
+ ***************************************************************************/
+void FrameArena_Reset()
+{
+	if(stats.used > stats.peak)
+		stats.peak = stats.used;
+
+#if FRAMEARENA_CHECK
+	if(arenaLive > 0)
+	{
+		stats.leaks += arenaLive;
+		printf("FrameArena: %d buffers outlived frame %u\n", arenaLive, arenaFrame);
+	}
+	// anything still pointing into the arena now reads garbage
+	memset(arena, ARENA_POISON, arenaTop);
+	arenaLive = 0;
+	arenaFrame++;
+#endif
+
+	lastStats = stats;
+	stats.used = 0;
+	arenaTop = 0;
+	arenaOwner = LWP_GetSelf();
+}
+
+const FrameArenaStats * FrameArena_GetStats()
+{
+	return &lastStats;
+}
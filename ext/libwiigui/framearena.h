@@ -0,0 +1,50 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * framearena.h
+ * Frame-scoped bump allocator for short-lived buffers
+ *
+ * Buffers that only live while a frame is being drawn (text being wrapped
+ * or scrolled, glyph bitmaps on their way to a texture) are carved out of
+ * a fixed arena instead of the heap. The arena is emptied in one step when
+ * the frame has been submitted, so these buffers never fragment MEM1 and
+ * never take the malloc lock the GUI and audio threads share.
+ *
+ * The arena belongs to the thread that renders; allocations made by any
+ * other thread, or that do not fit, fall back to the heap. Either way the
+ * buffer is released with FrameArena_Free before the frame ends. With
+ * FRAMEARENA_CHECK enabled, every buffer records the frame it was handed
+ * out in, and buffers that outlive their frame are reported.
+ ***************************************************************************/
+
+#ifndef _FRAMEARENA_H_
+#define _FRAMEARENA_H_
+
+#include <gccore.h>
+
+#include "defines.h" // for DEBUG
+
+// set to 1 to report arena buffers that outlive their frame; on in debug builds
+#ifndef FRAMEARENA_CHECK
+#define FRAMEARENA_CHECK DEBUG
+#endif
+
+#define FRAMEARENA_SIZE (64 * 1024) // bytes available to a single frame
+
+typedef struct _framearenastats {
+	u32 used; // bytes handed out during the last completed frame
+	u32 peak; // highest number of bytes handed out in a frame
+	u32 fallbacks; // allocations that went to the heap instead
+	u32 leaks; // buffers still live when their frame ended (FRAMEARENA_CHECK)
+	u32 staleFrees; // buffers released after their frame ended (FRAMEARENA_CHECK)
+} FrameArenaStats;
+
+void * FrameArena_Alloc(u32 size, u32 align = 4);
+char * FrameArena_StrDup(const char * str);
+void FrameArena_Free(void * ptr);
+bool FrameArena_Owns(const void * ptr);
+void FrameArena_Reset();
+const FrameArenaStats * FrameArena_GetStats();
+
+#endif
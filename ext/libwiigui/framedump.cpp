@@ -0,0 +1,300 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * framedump.cpp
+ * Writes presented frames to storage, as PPM screenshots or a Y4M stream
+ *
+ * The external framebuffer holds YUV 4:2:2 with every 32-bit word packing
+ * Y0 Cb Y1 Cr, in video range (Y 16-235, Cb and Cr 16-240). PPM screenshots
+ * are converted to full range RGB; Y4M streams store the frame as-is
+ * (deinterleaved into planes) so recording stays cheap and the stream can
+ * be encoded to video offline.
+ *
+ * Streams keep every FRAMEDUMP_EVERY'th presented frame, and the header
+ * states that rate, so a recording plays back at the speed of the game.
+ * The game thread only deinterleaves a kept frame into a free slot; a
+ * writer thread running below every other thread puts the slots on storage
+ * while the game waits for vsync. If the writer falls behind and no slot is
+ * free, the game waits for one rather than dropping the frame, which would
+ * make the stream skip.
+ ***************************************************************************/
+
+#include <gccore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#include "framedump.h"
+
+static FILE * dumpFile = NULL;
+static u16 dumpWidth = 0;
+static u16 dumpHeight = 0;
+static u8 * dumpSlots[FRAMEDUMP_SLOTS]; // Y, Cb and Cr planes of a frame each
+static u32 dumpQueued = 0; // frames put in a slot
+static u32 dumpWritten = 0; // frames written out; the slots in between are full
+static u32 dumpPresented = 0; // frames presented since recording started
+static u32 dumpStalls = 0; // times the game waited for a free slot
+static bool dumpStopping = false;
+static mutex_t dumpMutex = LWP_MUTEX_NULL;
+static cond_t dumpCond = LWP_COND_NULL;
+static lwp_t dumpThread = LWP_THREAD_NULL;
+static u8 dumpStack[FRAMEDUMP_STACKSIZE] ATTRIBUTE_ALIGN(8);
+
+static char screenshotPath[256] = ""; // saved from the next frame, if set
+static GXRModeObj * screenshotMode = NULL;
+
+static inline u8 Clamp(int c)
+{
+	return c < 0 ? 0 : (c > 255 ? 255 : c);
+}
+
+/****************************************************************************
+ * FrameDump_SavePPM
+ *
+ * Saves the given external framebuffer as a binary PPM image
+ ***************************************************************************/
+bool FrameDump_SavePPM(const char * path, u32 * xfb, GXRModeObj * rmode)
+{
+	if(!xfb || !rmode)
+		return false;
+
+	int width = rmode->fbWidth;
+	int height = rmode->xfbHeight;
+	u8 * row = (u8 *)malloc(width * 3);
+
+	if(!row)
+		return false;
+
+	FILE * file = fopen(path, "wb");
+
+	if(!file)
+	{
+		free(row);
+		return false;
+	}
+
+	fprintf(file, "P6\n%d %d\n255\n", width, height);
+
+	for(int y=0; y < height; y++)
+	{
+		u32 * src = xfb + y * (width >> 1);
+		u8 * dst = row;
+
+		for(int x=0; x < width; x += 2)
+		{
+			u32 yuyv = *src++;
+			int y0 = (((yuyv >> 24) & 0xFF) - 16) * 76309;
+			int cb = ((yuyv >> 16) & 0xFF) - 128;
+			int y1 = (((yuyv >> 8) & 0xFF) - 16) * 76309;
+			int cr = (yuyv & 0xFF) - 128;
+
+			// BT.601 video range to full range, 16.16 fixed point
+			int r = 104597 * cr + 32768;
+			int g = -25675 * cb - 53279 * cr + 32768;
+			int b = 132201 * cb + 32768;
+
+			*dst++ = Clamp((y0 + r) >> 16);
+			*dst++ = Clamp((y0 + g) >> 16);
+			*dst++ = Clamp((y0 + b) >> 16);
+			*dst++ = Clamp((y1 + r) >> 16);
+			*dst++ = Clamp((y1 + g) >> 16);
+			*dst++ = Clamp((y1 + b) >> 16);
+		}
+		fwrite(row, 1, width * 3, file);
+	}
+
+	fclose(file);
+	free(row);
+	return true;
+}
+
+/****************************************************************************
+ * FrameDump_Screenshot
+ *
+ * Saves the next presented frame as a PPM image, e.g. to compare against a
+ * golden image with tools/ppmdiff. Unlike recording, the conversion and the write happen on
+ * the game thread, so that one frame takes longer.
+ ***************************************************************************/
+void FrameDump_Screenshot(const char * path, GXRModeObj * rmode)
+{
+	snprintf(screenshotPath, sizeof(screenshotPath), "%s", path);
+	screenshotMode = rmode;
+}
+
+static void * DumpThread(void * arg)
+{
+	int frameSize = dumpWidth * dumpHeight * 2;
+
+	LWP_MutexLock(dumpMutex);
+
+	while(1)
+	{
+		while(dumpWritten == dumpQueued && !dumpStopping)
+			LWP_CondWait(dumpCond, dumpMutex);
+
+		if(dumpWritten == dumpQueued)
+			break; // stopping, and every frame is out
+
+		u8 * planes = dumpSlots[dumpWritten % FRAMEDUMP_SLOTS];
+		LWP_MutexUnlock(dumpMutex);
+
+		fputs("FRAME\n", dumpFile);
+		fwrite(planes, 1, frameSize, dumpFile);
+
+		LWP_MutexLock(dumpMutex);
+		dumpWritten++;
+		LWP_CondSignal(dumpCond); // the game may be waiting for the slot
+	}
+
+	LWP_MutexUnlock(dumpMutex);
+	return NULL;
+}
+
+static void FreeSlots()
+{
+	for(int i=0; i < FRAMEDUMP_SLOTS; i++)
+	{
+		free(dumpSlots[i]);
+		dumpSlots[i] = NULL;
+	}
+}
+
+/****************************************************************************
+ * FrameDump_Start
+ *
+ * Starts recording every FRAMEDUMP_EVERY'th presented frame to a Y4M (4:2:2)
+ * stream
+ ***************************************************************************/
+bool FrameDump_Start(const char * path, GXRModeObj * rmode)
+{
+	if(dumpFile || !rmode)
+		return false;
+
+	dumpWidth = rmode->fbWidth;
+	dumpHeight = rmode->xfbHeight;
+
+	for(int i=0; i < FRAMEDUMP_SLOTS; i++)
+	{
+		dumpSlots[i] = (u8 *)malloc(dumpWidth * dumpHeight * 2);
+
+		if(!dumpSlots[i])
+		{
+			FreeSlots();
+			return false;
+		}
+	}
+
+	dumpFile = fopen(path, "wb");
+
+	if(!dumpFile)
+	{
+		FreeSlots();
+		return false;
+	}
+
+	// PAL modes present 50 frames per second
+	bool isPal = (rmode->viTVMode >> 2) == VI_PAL;
+
+	fprintf(dumpFile, "YUV4MPEG2 W%d H%d F%d:%d Ip A1:1 C422\n",
+		dumpWidth, dumpHeight, isPal ? 50 : 60, FRAMEDUMP_EVERY);
+
+	dumpQueued = dumpWritten = dumpPresented = dumpStalls = 0;
+	dumpStopping = false;
+	LWP_MutexInit(&dumpMutex, false);
+	LWP_CondInit(&dumpCond);
+	LWP_CreateThread(&dumpThread, DumpThread, NULL, dumpStack,
+		FRAMEDUMP_STACKSIZE, FRAMEDUMP_PRIORITY);
+	return true;
+}
+
+/****************************************************************************
+ * FrameDump_Frame
+ *
+ * Queues the given external framebuffer for the stream, if recording and
+ * the frame is one to keep, and saves it if a screenshot was asked for
+ ***************************************************************************/
+void FrameDump_Frame(u32 * xfb)
+{
+	if(!xfb)
+		return;
+
+	if(screenshotPath[0])
+	{
+		FrameDump_SavePPM(screenshotPath, xfb, screenshotMode);
+		screenshotPath[0] = 0;
+	}
+
+	if(!dumpFile || dumpPresented++ % FRAMEDUMP_EVERY)
+		return;
+
+	// Only the writer frees slots, so a free slot stays free until queued.
+	LWP_MutexLock(dumpMutex);
+	if(dumpQueued - dumpWritten == FRAMEDUMP_SLOTS)
+	{
+		dumpStalls++;
+		while(dumpQueued - dumpWritten == FRAMEDUMP_SLOTS)
+			LWP_CondWait(dumpCond, dumpMutex);
+	}
+	LWP_MutexUnlock(dumpMutex);
+
+	int pixels = dumpWidth * dumpHeight;
+	u8 * yPlane = dumpSlots[dumpQueued % FRAMEDUMP_SLOTS];
+	u8 * cbPlane = yPlane + pixels;
+	u8 * crPlane = cbPlane + (pixels >> 1);
+	u32 * src = xfb;
+
+	for(int i=0; i < (pixels >> 1); i++)
+	{
+		u32 yuyv = *src++;
+		*yPlane++ = yuyv >> 24;
+		*cbPlane++ = yuyv >> 16;
+		*yPlane++ = yuyv >> 8;
+		*crPlane++ = yuyv;
+	}
+
+	LWP_MutexLock(dumpMutex);
+	dumpQueued++;
+	LWP_CondSignal(dumpCond);
+	LWP_MutexUnlock(dumpMutex);
+}
+
+/****************************************************************************
+ * FrameDump_Stop
+ *
+ * Stops recording once the queued frames are written, and closes the stream
+ ***************************************************************************/
+void FrameDump_Stop()
+{
+	if(!dumpFile)
+		return;
+
+	LWP_MutexLock(dumpMutex);
+	dumpStopping = true;
+	LWP_CondSignal(dumpCond);
+	LWP_MutexUnlock(dumpMutex);
+	LWP_JoinThread(dumpThread, NULL);
+
+	LWP_CondDestroy(dumpCond);
+	LWP_MutexDestroy(dumpMutex);
+	fclose(dumpFile);
+	dumpFile = NULL;
+	FreeSlots();
+}
+
+bool FrameDump_IsRecording()
+{
+	return dumpFile != NULL;
+}
+
+/****************************************************************************
+ * FrameDump_GetStalls
+ *
+ * Times the current (or last) recording held up the game because the writer
+ * was behind
+ ***************************************************************************/
+u32 FrameDump_GetStalls()
+{
+	return dumpStalls;
+}
@@ -0,0 +1,27 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * framedump.h
+ * Writes presented frames to storage, as PPM screenshots or a Y4M stream
+ ***************************************************************************/
+
+#ifndef _FRAMEDUMP_H_
+#define _FRAMEDUMP_H_
+
+#include <gccore.h>
+
+#define FRAMEDUMP_SLOTS 3 // frames waiting for the writer before the game waits too
+#define FRAMEDUMP_EVERY 4 // record every Nth presented frame
+#define FRAMEDUMP_STACKSIZE 16384
+#define FRAMEDUMP_PRIORITY 30 // below every other thread, so it writes in idle time only
+
+bool FrameDump_SavePPM(const char * path, u32 * xfb, GXRModeObj * rmode);
+void FrameDump_Screenshot(const char * path, GXRModeObj * rmode);
+bool FrameDump_Start(const char * path, GXRModeObj * rmode);
+void FrameDump_Frame(u32 * xfb);
+void FrameDump_Stop();
+bool FrameDump_IsRecording();
+u32 FrameDump_GetStalls();
+
+#endif
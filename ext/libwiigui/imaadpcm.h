@@ -0,0 +1,106 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * imaadpcm.h
+ * IMA ADPCM block decoder, shared by mixer.cpp and tools/adpcmenc
+ *
+ * Plain C with no libogc types, so the host encoder checks its output
+ * with exactly the decoder the game runs.
+ *
+ * A block starts with the decoder state of every channel (s16 predictor,
+ * big-endian; u8 step index; u8 zero) followed by ADPCM_BLOCK_FRAMES
+ * 4-bit codes per channel. Stereo blocks hold one frame per byte, left
+ * code in the high nibble; mono blocks hold two samples per byte, the
+ * first in the high nibble.
+ ***************************************************************************/
+
+#ifndef _IMAADPCM_H_
+#define _IMAADPCM_H_
+
+#define ADPCM_VERSION 1
+#define ADPCM_HEADER 32
+#define ADPCM_BLOCK_FRAMES 1024
+#define ADPCM_BLOCK_BYTES(channels) ((channels) * (4 + ADPCM_BLOCK_FRAMES / 2))
+
+static const int adpcmIndexTable[16] =
+{
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const int adpcmStepTable[89] =
+{
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+	45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+	230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+	963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+	3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+	9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385,
+	24623, 27086, 29794, 32767
+};
+
+typedef struct
+{
+	int predictor;
+	int index;
+} AdpcmState;
+
+/* Applies one 4-bit code to the state and returns the new sample. */
+static inline short AdpcmDecodeSample(AdpcmState * s, int code)
+{
+	int step = adpcmStepTable[s->index];
+	int diff = step >> 3;
+
+	if(code & 4) diff += step;
+	if(code & 2) diff += step >> 1;
+	if(code & 1) diff += step >> 2;
+
+	s->predictor += (code & 8) ? -diff : diff;
+	if(s->predictor > 32767) s->predictor = 32767;
+	if(s->predictor < -32768) s->predictor = -32768;
+
+	s->index += adpcmIndexTable[code];
+	if(s->index < 0) s->index = 0;
+	if(s->index > 88) s->index = 88;
+
+	return (short)s->predictor;
+}
+
+/* Loads the state at the start of a block and returns its first code byte. */
+static inline const unsigned char * AdpcmReadState(const unsigned char * block,
+	int channels, AdpcmState * state)
+{
+	for(int c=0; c < channels; c++, block += 4)
+	{
+		state[c].predictor = (short)((block[0] << 8) | block[1]);
+		state[c].index = block[2] > 88 ? 88 : block[2];
+	}
+	return block;
+}
+
+/* Decodes the first frames of a block into interleaved 16-bit samples. */
+static inline void AdpcmDecodeBlock(const unsigned char * block, int channels,
+	int frames, short * out)
+{
+	AdpcmState state[2];
+
+	block = AdpcmReadState(block, channels, state);
+
+	if(channels == 2)
+	{
+		for(int i=0; i < frames; i++)
+		{
+			*out++ = AdpcmDecodeSample(&state[0], block[i] >> 4);
+			*out++ = AdpcmDecodeSample(&state[1], block[i] & 0xF);
+		}
+	}
+	else
+	{
+		for(int i=0; i < frames; i++)
+			*out++ = AdpcmDecodeSample(&state[0],
+				(i & 1) ? block[i >> 1] & 0xF : block[i >> 1] >> 4);
+	}
+}
+
+#endif
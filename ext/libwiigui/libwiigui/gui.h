@@ -44,9 +44,13 @@
 #include "pngu.h"
 #include "FreeTypeGX.h"
 #include "video.h"
+#include "render.h"
+#include "framearena.h"
+#include "memtrack.h"
 #include "filelist.h"
 #include "input.h"
 #include "oggplayer.h"
+#include "mixer.h"
 
 extern FreeTypeGX *fontSystem[];
 
@@ -56,6 +60,10 @@ extern FreeTypeGX *fontSystem[];
 #define PAGESIZE 				8
 #define MAX_OPTIONS 			30
 #define MAX_KEYBOARD_DISPLAY	32
+#define DRAWLIST_INITIAL_SIZE	4096
+#define DRAWLIST_MAX_SIZE		65536
+#define TEXBAKE_VERSION			1 // version of the textures written by tools/texbake
+#define TEXBAKE_HEADER			32 // size of their header; keeps the texture data 32 byte aligned
 
 typedef void (*UpdateCallback)(void * e);
 
@@ -134,7 +142,7 @@ class GuiSound
 		//!Constructor
 		//!\param s Pointer to the sound data
 		//!\param l Length of sound data
-		//!\param t Sound format type (SOUND_PCM or SOUND_OGG)
+		//!\param t Sound format type (SOUND_PCM or SOUND_OGG); SOUND_PCM also plays sounds built by adpcmenc
 		GuiSound(const u8 * s, int l, int t);
 		//!Destructor
 		~GuiSound();
@@ -155,13 +163,25 @@ class GuiSound
 		//!Set the sound to loop playback (only applies to OGG)
 		//!\param l Loop (true to loop)
 		void SetLoop(bool l);
+		//!Stream the sound from a file instead, when the file can be played (only applies to OGG)
+		//!\param p Path of the file, or NULL to play the sound data
+		void SetStream(const char * p);
+		//!Set the mixer category, whose volume applies to the sound (only applies to PCM)
+		//!\param c Category (MIXER_UI or MIXER_EFFECTS)
+		void SetCategory(int c);
+		//!Set the priority used when the mixer runs out of voices (only applies to PCM)
+		//!\param p Priority (MIXER_PRIORITY_LOW to MIXER_PRIORITY_HIGH)
+		void SetPriority(int p);
 	protected:
 		const u8 * sound; //!< Pointer to the sound data
 		int type; //!< Sound format type (SOUND_PCM or SOUND_OGG)
 		s32 length; //!< Length of sound data
-		s32 voice; //!< Currently assigned ASND voice channel
+		s32 voice; //!< Currently assigned mixer handle (ASND voice channel for OGG)
 		s32 volume; //!< Sound volume (0-100)
 		bool loop; //!< Loop sound playback
+		const char * stream; //!< File to stream the sound from
+		int category; //!< Mixer category
+		int priority; //!< Mixer priority
 };
 
 //!Menu input trigger management. Determine if action is neccessary based on input data by comparing controller input data to a specific trigger element.
@@ -340,6 +360,8 @@ class GuiElement
 		void SetEffectOnOver(int e, int a, int t=0);
 		//!Shortcut to SetEffectOnOver(EFFECT_SCALE, 4, 110)
 		void SetEffectGrow();
+		//!Stops any running effect and clears the dynamic offsets, alpha and scale it left behind
+		virtual void ResetEffects();
 		//!Gets the current element effects
 		//!\return element effects
 		int GetEffect();
@@ -385,7 +407,14 @@ class GuiElement
 		virtual void Update(GuiTrigger * t);
 		//!Called constantly to redraw the element
 		virtual void Draw();
+		//!Flags the element as changed since it was last drawn
+		//!Also flags every parent, so cached draw lists containing the element are discarded
+		void MarkDirty();
+		//!Checks whether the element or one of its children changed since it was last drawn
+		//!\return true if changed, false otherwise
+		bool IsDirty();
 	protected:
+		bool dirty; //!< Changed since last drawn. Set by MarkDirty(), cleared by the enclosing GuiWindow
 		bool visible; //!< Visibility of the element. If false, Draw() is skipped
 		int focus; //!< Element focus (-1 = focus disabled, 0 = not focused, 1 = focused)
 		int width; //!< Element width
@@ -457,6 +486,8 @@ class GuiWindow : public GuiElement
 		void SetVisible(bool v);
 		//!Resets the window's state to STATE_DEFAULT
 		void ResetState();
+		//!Resets the effects of the window and all of its children
+		void ResetEffects();
 		//!Sets the window's state
 		//!\param s State
 		void SetState(int s);
@@ -485,38 +516,66 @@ class GuiWindow : public GuiElement
 		//!\param d Direction to move (-1 = up, 1 = down)
 		void MoveSelectionVert(int d);
 		//!Draws all the elements in this GuiWindow
+		//!Once nothing in the window has changed for a frame, its elements are recorded into a
+		//!display list, which is replayed until the window is flagged dirty again
 		void Draw();
 		//!Updates the window and all elements contains within
 		//!Allows the GuiWindow and all elements to respond to the input data specified
 		//!\param t Pointer to a GuiTrigger, containing the current input data from PAD/WPAD
 		void Update(GuiTrigger * t);
 	protected:
+		//!Draws every element directly
+		void DrawElements();
+		//!Checks whether the recorded draw list still matches what the window would draw
+		//!\return true if the list can be replayed, false otherwise
+		bool IsDrawListValid();
+		//!Records the elements into the draw list and replays it
+		void RecordDrawList();
 		std::vector<GuiElement*> _elements; //!< Contains all elements within the GuiWindow
+		u8 * drawList; //!< Display list of the elements, 32 byte aligned
+		u32 drawListCapacity; //!< Size of the drawList buffer, 0 if the elements don't fit in DRAWLIST_MAX_SIZE
+		u32 drawListSize; //!< Size of the recorded list, 0 if there is none
+		u32 drawListEpoch; //!< Menu_GetDrawListEpoch() at the time of recording
+		int drawListLeft; //!< GetLeft() at the time of recording
+		int drawListTop; //!< GetTop() at the time of recording
+		int drawListAlpha; //!< GetAlpha() at the time of recording
+		f32 drawListScale; //!< GetScale() at the time of recording
 };
 
-//!Converts image data into GX-useable RGBA8. Currently designed for use only with PNG files
+//!Provides image data as a GX texture. Textures pre-tiled by tools/texbake are used
+//!in place; PNG files are decoded to RGBA8
 class GuiImageData
 {
 	public:
 		//!Constructor
-		//!Converts the image data to RGBA8 - expects PNG format
+		//!Uses a texture pre-tiled by tools/texbake in place, or converts
+		//!PNG data to RGBA8
 		//!\param i Image data
 		GuiImageData(const u8 * i);
 		//!Destructor
 		~GuiImageData();
 		//!Gets a pointer to the image data
-		//!\return pointer to image data
+		//!\return pointer to image data, in the format given by GetFormat
 		u8 * GetImage();
+		//!Gets the texture format of the image data
+		//!\return GX_TF_RGBA8 for decoded PNGs, or the format picked by tools/texbake
+		u8 GetFormat();
 		//!Gets the image width
 		//!\return image width
 		int GetWidth();
 		//!Gets the image height
 		//!\return image height
 		int GetHeight();
+		//!Gets the texture object, initialized once when the image is decoded
+		//!\return pointer to texture object, or NULL if there is no image data
+		GXTexObj * GetTexObj();
 	protected:
 		u8 * data; //!< Image data
 		int height; //!< Height of image
 		int width; //!< Width of image
+		u8 format; //!< Texture format of data
+		bool isBaked; //!< Data is a pre-tiled texture embedded in the program, not owned
+		GXTexObj texObj; //!< Texture object for data
 };
 
 //!Display, manage, and manipulate images in the GUI
@@ -583,10 +642,13 @@ class GuiImage : public GuiElement
 		//!Does not alter the image data
 		//!\param s Alpha amount to draw over the image
 		void SetStripe(int s);
-      void SetDisplaySize(int w, int h) { displayWidth = w, displayHeight = h; }
+      void SetDisplaySize(int w, int h) { displayWidth = w, displayHeight = h; this->MarkDirty(); }
 	protected:
+		//!Checks that the image data is RGBA8, so pixels can be read and written
+		bool IsRGBA8();
 		int imgType; //!< Type of image data (IMAGE_TEXTURE, IMAGE_COLOR, IMAGE_DATA)
 		u8 * image; //!< Poiner to image data. May be shared with GuiImageData data
+		GXTexObj * texObj; //!< Texture object of the GuiImageData, NULL for raw image data
 		f32 imageangle; //!< Angle to draw the image
 		int tile; //!< Number of times to draw (tile) the image horizontally
 		int stripe; //!< Alpha value (0-255) to apply a stripe effect to the texture
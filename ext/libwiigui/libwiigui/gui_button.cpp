@@ -80,61 +80,73 @@ void GuiButton::SetImage(GuiImage* img)
 {
 	image = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetImageOver(GuiImage* img)
 {
 	imageOver = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetImageHold(GuiImage* img)
 {
 	imageHold = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetImageClick(GuiImage* img)
 {
 	imageClick = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetIcon(GuiImage* img)
 {
 	icon = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetIconOver(GuiImage* img)
 {
 	iconOver = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetIconHold(GuiImage* img)
 {
 	iconHold = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetIconClick(GuiImage* img)
 {
 	iconClick = img;
 	if(img) img->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetLabel(GuiText* txt, int n)
 {
 	label[n] = txt;
 	if(txt) txt->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetLabelOver(GuiText* txt, int n)
 {
 	labelOver[n] = txt;
 	if(txt) txt->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetLabelHold(GuiText* txt, int n)
 {
 	labelHold[n] = txt;
 	if(txt) txt->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetLabelClick(GuiText* txt, int n)
 {
 	labelClick[n] = txt;
 	if(txt) txt->SetParent(this);
+	this->MarkDirty();
 }
 void GuiButton::SetSoundOver(GuiSound * snd)
 {
@@ -208,6 +220,7 @@ void GuiButton::Update(GuiTrigger * t)
 					effects = effectsOver;
 					effectAmount = effectAmountOver;
 					effectTarget = effectTargetOver;
+					this->MarkDirty();
 				}
 			}
 		}
@@ -222,6 +235,7 @@ void GuiButton::Update(GuiTrigger * t)
 				effects = effectsOver;
 				effectAmount = -effectAmountOver;
 				effectTarget = 100;
+				this->MarkDirty();
 			}
 		}
 	}
@@ -15,6 +15,7 @@
  */
 GuiElement::GuiElement()
 {
+	dirty = true;
 	xoffset = 0;
 	yoffset = 0;
 	xmin = 0;
@@ -63,6 +64,7 @@ GuiElement::~GuiElement()
 void GuiElement::SetParent(GuiElement * e)
 {
 	parentElement = e;
+	this->MarkDirty();
 }
 
 GuiElement * GuiElement::GetParent()
@@ -70,6 +72,21 @@ GuiElement * GuiElement::GetParent()
 	return parentElement;
 }
 
+/**
+ * Flag the element and all of its parents as changed.
+ * Must be called by anything that alters what Draw() would produce.
+ */
+void GuiElement::MarkDirty()
+{
+	for(GuiElement * e = this; e; e = e->parentElement)
+		e->dirty = true;
+}
+
+bool GuiElement::IsDirty()
+{
+	return dirty;
+}
+
 /**
  * Get the left position of the GuiElement.
  * @see SetLeft()
@@ -212,6 +229,7 @@ void GuiElement::SetSize(int w, int h)
 
 	width = w;
 	height = h;
+	this->MarkDirty();
 }
 
 /**
@@ -232,11 +250,13 @@ bool GuiElement::IsVisible()
 void GuiElement::SetVisible(bool v)
 {
 	visible = v;
+	this->MarkDirty();
 }
 
 void GuiElement::SetAlpha(int a)
 {
 	alpha = a;
+	this->MarkDirty();
 }
 
 int GuiElement::GetAlpha()
@@ -257,6 +277,7 @@ int GuiElement::GetAlpha()
 void GuiElement::SetScale(float s)
 {
 	scale = s;
+	this->MarkDirty();
 }
 
 float GuiElement::GetScale()
@@ -283,6 +304,7 @@ void GuiElement::SetState(int s, int c)
 {
 	state = s;
 	stateChan = c;
+	this->MarkDirty();
 }
 
 void GuiElement::ResetState()
@@ -291,6 +313,7 @@ void GuiElement::ResetState()
 	{
 		state = STATE_DEFAULT;
 		stateChan = -1;
+		this->MarkDirty();
 	}
 }
 
@@ -401,6 +424,7 @@ void GuiElement::SetEffect(int eff, int amount, int target)
 	effects |= eff;
 	effectAmount = amount;
 	effectTarget = target;
+	this->MarkDirty();
 }
 
 void GuiElement::SetEffectOnOver(int eff, int amount, int target)
@@ -415,8 +439,24 @@ void GuiElement::SetEffectGrow()
 	SetEffectOnOver(EFFECT_SCALE, 4, 110);
 }
 
+void GuiElement::ResetEffects()
+{
+	effects = 0;
+	effectAmount = 0;
+	effectTarget = 0;
+	xoffsetDyn = 0;
+	yoffsetDyn = 0;
+	alphaDyn = -1;
+	scaleDyn = 1;
+	this->MarkDirty();
+}
+
 void GuiElement::UpdateEffects()
 {
+	// an animating element has to be drawn again next frame
+	if(effects)
+		this->MarkDirty();
+
 	if(effects & (EFFECT_SLIDE_IN | EFFECT_SLIDE_OUT))
 	{
 		if(effects & EFFECT_SLIDE_IN)
@@ -537,12 +577,14 @@ void GuiElement::SetPosition(int xoff, int yoff)
 {
 	xoffset = xoff;
 	yoffset = yoff;
+	this->MarkDirty();
 }
 
 void GuiElement::SetAlignment(int hor, int vert)
 {
 	alignmentHor = hor;
 	alignmentVert = vert;
+	this->MarkDirty();
 }
 
 int GuiElement::GetSelected()
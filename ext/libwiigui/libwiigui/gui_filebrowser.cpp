@@ -32,6 +32,10 @@ GuiFileBrowser::GuiFileBrowser(int w, int h)
 
 	btnSoundOver = new GuiSound(button_over_pcm, button_over_pcm_size, SOUND_PCM);
 	btnSoundClick = new GuiSound(button_click_pcm, button_click_pcm_size, SOUND_PCM);
+	btnSoundOver->SetCategory(MIXER_UI);
+	btnSoundOver->SetPriority(MIXER_PRIORITY_LOW);
+	btnSoundClick->SetCategory(MIXER_UI);
+	btnSoundClick->SetPriority(MIXER_PRIORITY_LOW);
 
 	bgFileSelection = new GuiImageData(bg_file_selection_png);
 	bgFileSelectionImg = new GuiImage(bgFileSelection);
@@ -213,6 +217,9 @@ void GuiFileBrowser::Draw()
 
 void GuiFileBrowser::Update(GuiTrigger * t)
 {
+	// the list and scrollbar follow the input every frame
+	this->MarkDirty();
+
 	if(state == STATE_DISABLED || !t)
 		return;
 
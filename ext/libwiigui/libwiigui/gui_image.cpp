@@ -15,6 +15,7 @@
 GuiImage::GuiImage() : displayWidth(0), displayHeight(0)
 {
 	image = NULL;
+	texObj = NULL;
 	width = 0;
 	height = 0;
 	imageangle = 0;
@@ -26,11 +27,13 @@ GuiImage::GuiImage() : displayWidth(0), displayHeight(0)
 GuiImage::GuiImage(GuiImageData * img) : displayWidth(0), displayHeight(0)
 {
 	image = NULL;
+	texObj = NULL;
 	width = 0;
 	height = 0;
 	if(img)
 	{
 		image = img->GetImage();
+		texObj = img->GetTexObj();
 		width = img->GetWidth();
 		height = img->GetHeight();
 	}
@@ -43,6 +46,7 @@ GuiImage::GuiImage(GuiImageData * img) : displayWidth(0), displayHeight(0)
 GuiImage::GuiImage(u8 * img, int w, int h) : displayWidth(0), displayHeight(0)
 {
 	image = img;
+	texObj = NULL;
 	width = w;
 	height = h;
 	imageangle = 0;
@@ -53,7 +57,8 @@ GuiImage::GuiImage(u8 * img, int w, int h) : displayWidth(0), displayHeight(0)
 
 GuiImage::GuiImage(int w, int h, GXColor c) : displayWidth(0), displayHeight(0)
 {
-	image = (u8 *)memalign (32, w * h * 4);
+	image = (u8 *)MemTrack_Memalign(MEM_TAG_GUI, 32, w * h * 4);
+	texObj = NULL;
 	width = w;
 	height = h;
 	imageangle = 0;
@@ -84,7 +89,7 @@ GuiImage::GuiImage(int w, int h, GXColor c) : displayWidth(0), displayHeight(0)
 GuiImage::~GuiImage()
 {
 	if(imgType == IMAGE_COLOR && image)
-		free(image);
+		MemTrack_Free(image);
 }
 
 u8 * GuiImage::GetImage()
@@ -95,38 +100,55 @@ u8 * GuiImage::GetImage()
 void GuiImage::SetImage(GuiImageData * img)
 {
 	image = NULL;
+	texObj = NULL;
 	width = 0;
 	height = 0;
 	if(img)
 	{
 		image = img->GetImage();
+		texObj = img->GetTexObj();
 		width = img->GetWidth();
 		height = img->GetHeight();
 	}
 	imgType = IMAGE_DATA;
+	this->MarkDirty();
 }
 
 void GuiImage::SetImage(u8 * img, int w, int h)
 {
 	image = img;
+	texObj = NULL;
 	width = w;
 	height = h;
 	imgType = IMAGE_TEXTURE;
+	this->MarkDirty();
 }
 
 void GuiImage::SetAngle(float a)
 {
 	imageangle = a;
+	this->MarkDirty();
 }
 
 void GuiImage::SetTile(int t)
 {
 	tile = t;
+	this->MarkDirty();
+}
+
+/**
+ * Pre-tiled textures from tools/texbake may use other formats. An RGBA8 one
+ * is embedded in the program and shared by every GuiImageData made from it,
+ * so writing its pixels changes all of them.
+ */
+bool GuiImage::IsRGBA8()
+{
+	return !texObj || GX_GetTexObjFmt(texObj) == GX_TF_RGBA8;
 }
 
 GXColor GuiImage::GetPixel(int x, int y)
 {
-	if(!image || this->GetWidth() <= 0 || x < 0 || y < 0)
+	if(!image || this->GetWidth() <= 0 || x < 0 || y < 0 || !IsRGBA8())
 		return (GXColor){0, 0, 0, 0};
 
 	u32 offset = (((y >> 2)<<4)*this->GetWidth()) + ((x >> 2)<<6) + (((y%4 << 2) + x%4 ) << 1);
@@ -140,7 +162,7 @@ GXColor GuiImage::GetPixel(int x, int y)
 
 void GuiImage::SetPixel(int x, int y, GXColor color)
 {
-	if(!image || this->GetWidth() <= 0 || x < 0 || y < 0)
+	if(!image || this->GetWidth() <= 0 || x < 0 || y < 0 || !IsRGBA8())
 		return;
 
 	u32 offset = (((y >> 2)<<4)*this->GetWidth()) + ((x >> 2)<<6) + (((y%4 << 2) + x%4 ) << 1);
@@ -161,15 +183,20 @@ void GuiImage::SetColor(GXColor c)
 			this->SetPixel(x, y, c);
 		}
   }
+  this->MarkDirty();
 }
 
 void GuiImage::SetStripe(int s)
 {
 	stripe = s;
+	this->MarkDirty();
 }
 
 void GuiImage::ColorStripe(int shift)
 {
+	if(!image || !IsRGBA8())
+		return;
+
 	int x, y;
 	GXColor color;
 	int alt = 0;
@@ -223,10 +250,15 @@ void GuiImage::ColorStripe(int shift)
 	int len = width*height*4;
 	if(len%32) len += (32-len%32);
 	DCFlushRange(image, len);
+	Menu_InvalidateTextures();
+	this->MarkDirty();
 }
 
 void GuiImage::Grayscale()
 {
+	if(!image || !IsRGBA8())
+		return;
+
 	GXColor color;
 	u32 offset, gray;
 
@@ -250,6 +282,8 @@ void GuiImage::Grayscale()
 	int len = width*height*4;
 	if(len%32) len += (32-len%32);
 	DCFlushRange(image, len);
+	Menu_InvalidateTextures();
+	this->MarkDirty();
 }
 
 /**
@@ -266,9 +300,16 @@ void GuiImage::Draw()
 	if(tile > 0)
 	{
 		for(int i=0; i<tile; i++)
-			Menu_DrawImg(currLeft+width*i, this->GetTop(), width, height, image, 
-                      imageangle, currScale, currScale, this->GetAlpha(),
-                      displayWidth, displayHeight);
+		{
+			if(texObj)
+				Menu_DrawTexObj(currLeft+width*i, this->GetTop(), width, height, texObj,
+                           imageangle, currScale, currScale, this->GetAlpha(),
+                           displayWidth, displayHeight);
+			else
+				Menu_DrawImg(currLeft+width*i, this->GetTop(), width, height, image, 
+                        imageangle, currScale, currScale, this->GetAlpha(),
+                        displayWidth, displayHeight);
+		}
 	}
 	else
 	{
@@ -276,9 +317,14 @@ void GuiImage::Draw()
 		if(scale != 1)
 			currLeft = currLeft - width/2 + (width*scale)/2;
 
-		Menu_DrawImg(currLeft, this->GetTop(), width, height, image, imageangle, 
-                   currScale, currScale, this->GetAlpha(),
-                   displayWidth, displayHeight);
+		if(texObj)
+			Menu_DrawTexObj(currLeft, this->GetTop(), width, height, texObj, imageangle, 
+                         currScale, currScale, this->GetAlpha(),
+                         displayWidth, displayHeight);
+		else
+			Menu_DrawImg(currLeft, this->GetTop(), width, height, image, imageangle, 
+                      currScale, currScale, this->GetAlpha(),
+                      displayWidth, displayHeight);
 	}
 
 	if(stripe > 0)
@@ -18,6 +18,24 @@ GuiImageData::GuiImageData(const u8 * img)
 	data = NULL;
 	width = 0;
 	height = 0;
+	format = GX_TF_RGBA8;
+	isBaked = false;
+
+	if(img && memcmp(img, "GXTX", 4) == 0)
+	{
+		// already tiled at build time - hand the embedded data straight to GX
+		if(((img[4] << 8) | img[5]) != TEXBAKE_VERSION)
+			return;
+
+		format = (img[6] << 8) | img[7];
+		width = (img[8] << 8) | img[9];
+		height = (img[10] << 8) | img[11];
+		data = (u8 *)img + TEXBAKE_HEADER;
+		isBaked = true;
+
+		GX_InitTexObj(&texObj, data, width, height, format, GX_CLAMP, GX_CLAMP, GX_FALSE);
+		return;
+	}
 
 	if(img)
 	{
@@ -33,7 +51,7 @@ GuiImageData::GuiImageData(const u8 * img)
 		{
 			int len = imgProp.imgWidth * imgProp.imgHeight * 4;
 			if(len%32) len += (32-len%32);
-			data = (u8 *)memalign (32, len);
+			data = (u8 *)MemTrack_Memalign(MEM_TAG_TEXTURE, 32, len);
 
 			if(data)
 			{
@@ -44,10 +62,15 @@ GuiImageData::GuiImageData(const u8 * img)
 					width = imgProp.imgWidth;
 					height = imgProp.imgHeight;
 					DCFlushRange(data, len);
+
+					// the data never changes after this point, so the texture
+					// object only needs to be set up once
+					GX_InitTexObj(&texObj, data, width, height, GX_TF_RGBA8, GX_CLAMP, GX_CLAMP, GX_FALSE);
+					Menu_InvalidateTextures();
 				}
 				else
 				{
-					free(data);
+					MemTrack_Free(data);
 					data = NULL;
 				}
 			}
@@ -61,9 +84,9 @@ GuiImageData::GuiImageData(const u8 * img)
  */
 GuiImageData::~GuiImageData()
 {
-	if(data)
+	if(data && !isBaked)
 	{
-		free(data);
+		MemTrack_Free(data);
 		data = NULL;
 	}
 }
@@ -73,6 +96,11 @@ u8 * GuiImageData::GetImage()
 	return data;
 }
 
+u8 GuiImageData::GetFormat()
+{
+	return format;
+}
+
 int GuiImageData::GetWidth()
 {
 	return width;
@@ -82,3 +110,10 @@ int GuiImageData::GetHeight()
 {
 	return height;
 }
+
+GXTexObj * GuiImageData::GetTexObj()
+{
+	if(!data)
+		return NULL;
+	return &texObj;
+}
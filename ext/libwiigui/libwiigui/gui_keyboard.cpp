@@ -122,6 +122,10 @@ GuiKeyboard::GuiKeyboard(char * t, u32 max)
 
 	keySoundOver = new GuiSound(button_over_pcm, button_over_pcm_size, SOUND_PCM);
 	keySoundClick = new GuiSound(button_click_pcm, button_click_pcm_size, SOUND_PCM);
+	keySoundOver->SetCategory(MIXER_UI);
+	keySoundOver->SetPriority(MIXER_PRIORITY_LOW);
+	keySoundClick->SetCategory(MIXER_UI);
+	keySoundClick->SetPriority(MIXER_PRIORITY_LOW);
 	trigA = new GuiTrigger;
 
 	trigA->SetSimpleTrigger(-1, WPAD_BUTTON_A | WPAD_CLASSIC_BUTTON_A, PAD_BUTTON_A);
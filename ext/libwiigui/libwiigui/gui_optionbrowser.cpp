@@ -29,6 +29,10 @@ GuiOptionBrowser::GuiOptionBrowser(int w, int h, OptionList * l)
 
 	btnSoundOver = new GuiSound(button_over_pcm, button_over_pcm_size, SOUND_PCM);
 	btnSoundClick = new GuiSound(button_click_pcm, button_click_pcm_size, SOUND_PCM);
+	btnSoundOver->SetCategory(MIXER_UI);
+	btnSoundOver->SetPriority(MIXER_PRIORITY_LOW);
+	btnSoundClick->SetCategory(MIXER_UI);
+	btnSoundClick->SetPriority(MIXER_PRIORITY_LOW);
 
 	bgOptions = new GuiImageData(bg_options_png);
 	bgOptionsImg = new GuiImage(bgOptions);
@@ -233,6 +237,9 @@ void GuiOptionBrowser::TriggerUpdate()
 
 void GuiOptionBrowser::Update(GuiTrigger * t)
 {
+	// the list and scrollbar follow the input every frame
+	this->MarkDirty();
+
 	if(state == STATE_DISABLED || !t)
 		return;
 
@@ -21,6 +21,9 @@ GuiSound::GuiSound(const u8 * snd, s32 len, int t)
 	voice = -1;
 	volume = 100;
 	loop = false;
+	stream = NULL;
+	category = MIXER_EFFECTS;
+	priority = MIXER_PRIORITY_NORMAL;
 }
 
 /**
@@ -31,30 +34,24 @@ GuiSound::~GuiSound()
 	#ifndef NO_SOUND
 	if(type == SOUND_OGG)
 		StopOgg();
+	else
+		Mixer_StopData(sound); // the mixer mustn't outlive the sound data
 	#endif
 }
 
 void GuiSound::Play()
 {
 	#ifndef NO_SOUND
-	int vol;
-
 	switch(type)
 	{
 		case SOUND_PCM:
-		vol = 255*(volume/100.0);
-		voice = ASND_GetFirstUnusedVoice();
-		if(voice >= 0)
-			ASND_SetVoice(voice, VOICE_STEREO_16BIT, 48000, 0,
-				(u8 *)sound, length, vol, vol, NULL);
+		voice = Mixer_Play(sound, length, category, priority, 255*(volume/100.0));
 		break;
 
 		case SOUND_OGG:
 		voice = 0;
-		if(loop)
-			PlayOgg((char *)sound, length, 0, OGG_INFINITE_TIME);
-		else
-			PlayOgg((char *)sound, length, 0, OGG_ONE_TIME);
+		if(!stream || PlayOggFile(stream, 0, loop ? OGG_INFINITE_TIME : OGG_ONE_TIME) < 0)
+			PlayOgg((char *)sound, length, 0, loop ? OGG_INFINITE_TIME : OGG_ONE_TIME);
 		SetVolumeOgg(255*(volume/100.0));
 		break;
 	}
@@ -64,17 +61,15 @@ void GuiSound::Play()
 void GuiSound::Stop()
 {
 	#ifndef NO_SOUND
-	if(voice < 0)
-		return;
-
 	switch(type)
 	{
 		case SOUND_PCM:
-		ASND_StopVoice(voice);
+		Mixer_StopData(sound); // every time it's playing, not just the last
 		break;
 
 		case SOUND_OGG:
-		StopOgg();
+		if(voice >= 0)
+			StopOgg();
 		break;
 	}
 	#endif
@@ -89,7 +84,7 @@ void GuiSound::Pause()
 	switch(type)
 	{
 		case SOUND_PCM:
-		ASND_PauseVoice(voice, 1);
+		Mixer_Pause(voice, true);
 		break;
 
 		case SOUND_OGG:
@@ -108,7 +103,7 @@ void GuiSound::Resume()
 	switch(type)
 	{
 		case SOUND_PCM:
-		ASND_PauseVoice(voice, 0);
+		Mixer_Pause(voice, false);
 		break;
 
 		case SOUND_OGG:
@@ -120,6 +115,9 @@ void GuiSound::Resume()
 
 bool GuiSound::IsPlaying()
 {
+	if(type == SOUND_PCM)
+		return Mixer_IsPlaying(voice);
+
 	if(ASND_StatusVoice(voice) == SND_WORKING || ASND_StatusVoice(voice) == SND_WAITING)
 		return true;
 	else
@@ -139,7 +137,7 @@ void GuiSound::SetVolume(int vol)
 	switch(type)
 	{
 		case SOUND_PCM:
-		ASND_ChangeVolumeVoice(voice, newvol, newvol);
+		Mixer_SetVolume(voice, newvol);
 		break;
 
 		case SOUND_OGG:
@@ -153,3 +151,18 @@ void GuiSound::SetLoop(bool l)
 {
 	loop = l;
 }
+
+void GuiSound::SetStream(const char * p)
+{
+	stream = p;
+}
+
+void GuiSound::SetCategory(int c)
+{
+	category = c;
+}
+
+void GuiSound::SetPriority(int p)
+{
+	priority = p;
+}
@@ -129,6 +129,7 @@ void GuiText::SetText(const char * t)
 		origText = strdup(t);
 		text = charToWideChar(t);
 	}
+	this->MarkDirty();
 }
 
 void GuiText::SetPresets(int sz, GXColor c, int w, u16 s, int h, int v)
@@ -144,17 +145,20 @@ void GuiText::SetPresets(int sz, GXColor c, int w, u16 s, int h, int v)
 void GuiText::SetFontSize(int s)
 {
 	size = s;
+	this->MarkDirty();
 }
 
 void GuiText::SetMaxWidth(int width)
 {
 	maxWidth = width;
+	this->MarkDirty();
 }
 
 void GuiText::SetWrap(bool w, int width)
 {
 	wrap = w;
 	maxWidth = width;
+	this->MarkDirty();
 }
 
 void GuiText::SetScroll(int s)
@@ -171,17 +175,20 @@ void GuiText::SetScroll(int s)
 	textScrollPos = 0;
 	textScrollInitialDelay = TEXT_SCROLL_INITIAL_DELAY;
 	textScrollDelay = TEXT_SCROLL_DELAY;
+	this->MarkDirty();
 }
 
 void GuiText::SetColor(GXColor c)
 {
 	color = c;
 	alpha = c.a;
+	this->MarkDirty();
 }
 
 void GuiText::SetStyle(u16 s)
 {
 	style = s;
+	this->MarkDirty();
 }
 
 void GuiText::SetAlignment(int hor, int vert)
@@ -215,6 +222,7 @@ void GuiText::SetAlignment(int hor, int vert)
 
 	alignmentHor = hor;
 	alignmentVert = vert;
+	this->MarkDirty();
 }
 
 /**
@@ -236,9 +244,9 @@ void GuiText::Draw()
 	if(newSize > MAX_FONT_SIZE)
 		newSize = MAX_FONT_SIZE;
 
+	// Each FreeTypeGX sets the shared font face to its own size when needed.
 	if(newSize != currentSize)
 	{
-		ChangeFontSize(newSize);
 		if(!fontSystem[newSize])
 			fontSystem[newSize] = new FreeTypeGX(newSize);
 		currentSize = newSize;
@@ -246,7 +254,7 @@ void GuiText::Draw()
 
 	if(maxWidth > 0)
 	{
-		char * tmpText = strdup(origText);
+		char * tmpText = FrameArena_StrDup(origText);
 		u8 maxChar = (maxWidth*2.0) / newSize;
 
 		if(!textDyn)
@@ -260,6 +268,10 @@ void GuiText::Draw()
 		{
 			int textlen = strlen(origText);
 
+			// scrolling text changes every few frames
+			if(textlen > maxChar)
+				this->MarkDirty();
+
 			if(textlen > maxChar && (FrameTimer % textScrollDelay == 0))
 			{
 				if(textScrollInitialDelay)
@@ -307,7 +319,7 @@ void GuiText::Draw()
 			while(ch < txtlen)
 			{
 				if(i == 0)
-					textrow[linenum] = new wchar_t[txtlen + 1];
+					textrow[linenum] = (wchar_t *)FrameArena_Alloc((txtlen + 1) * sizeof(wchar_t));
 
 				textrow[linenum][i] = text[ch];
 				textrow[linenum][i+1] = 0;
@@ -348,14 +360,14 @@ void GuiText::Draw()
 			for(i=0; i < linenum; i++)
 			{
 				fontSystem[currentSize]->drawText(this->GetLeft(), this->GetTop()+voffset+i*lineheight, textrow[i], c, style);
-				delete[] textrow[i];
+				FrameArena_Free(textrow[i]);
 			}
 		}
 		else
 		{
 			fontSystem[currentSize]->drawText(this->GetLeft(), this->GetTop(), textDyn, c, style);
 		}
-		free(tmpText);
+		FrameArena_Free(tmpText);
 	}
 	else
 	{
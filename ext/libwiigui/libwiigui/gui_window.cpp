@@ -15,6 +15,14 @@ GuiWindow::GuiWindow()
 	width = 0;
 	height = 0;
 	focus = 0; // allow focus
+	drawList = NULL;
+	drawListCapacity = DRAWLIST_INITIAL_SIZE;
+	drawListSize = 0;
+	drawListEpoch = 0;
+	drawListLeft = 0;
+	drawListTop = 0;
+	drawListAlpha = 0;
+	drawListScale = 0;
 }
 
 GuiWindow::GuiWindow(int w, int h)
@@ -22,10 +30,20 @@ GuiWindow::GuiWindow(int w, int h)
 	width = w;
 	height = h;
 	focus = 0; // allow focus
+	drawList = NULL;
+	drawListCapacity = DRAWLIST_INITIAL_SIZE;
+	drawListSize = 0;
+	drawListEpoch = 0;
+	drawListLeft = 0;
+	drawListTop = 0;
+	drawListAlpha = 0;
+	drawListScale = 0;
 }
 
 GuiWindow::~GuiWindow()
 {
+	if(drawList)
+		MemTrack_Free(drawList);
 }
 
 void GuiWindow::Append(GuiElement* e)
@@ -58,6 +76,7 @@ void GuiWindow::Remove(GuiElement* e)
 		if(e == _elements.at(i))
 		{
 			_elements.erase(_elements.begin()+i);
+			this->MarkDirty();
 			break;
 		}
 	}
@@ -66,6 +85,7 @@ void GuiWindow::Remove(GuiElement* e)
 void GuiWindow::RemoveAll()
 {
 	_elements.clear();
+	this->MarkDirty();
 }
 
 GuiElement* GuiWindow::GetGuiElementAt(u32 index) const
@@ -80,15 +100,92 @@ u32 GuiWindow::GetSize()
 	return _elements.size();
 }
 
+void GuiWindow::DrawElements()
+{
+	for (u8 i = 0; i < _elements.size(); i++)
+	{
+		try	{ _elements.at(i)->Draw(); }
+		catch (const std::exception& e) { }
+	}
+}
+
+/**
+ * The list holds absolute positions and alpha values, so it is only valid
+ * while the window itself hasn't moved, faded or been scaled by a parent.
+ */
+bool GuiWindow::IsDrawListValid()
+{
+	return drawListSize > 0 && !dirty
+		&& drawListEpoch == Menu_GetDrawListEpoch()
+		&& drawListLeft == this->GetLeft()
+		&& drawListTop == this->GetTop()
+		&& drawListAlpha == this->GetAlpha()
+		&& drawListScale == this->GetScale();
+}
+
+void GuiWindow::RecordDrawList()
+{
+	if(!drawList)
+		drawList = (u8 *)MemTrack_Memalign(MEM_TAG_GUI, 32, drawListCapacity);
+
+	if(!drawList || !Menu_BeginDrawList(drawList, drawListCapacity))
+	{
+		this->DrawElements();
+		return;
+	}
+
+	this->DrawElements();
+	drawListSize = Menu_EndDrawList();
+
+	if(drawListSize > 0)
+	{
+		drawListEpoch = Menu_GetDrawListEpoch();
+		drawListLeft = this->GetLeft();
+		drawListTop = this->GetTop();
+		drawListAlpha = this->GetAlpha();
+		drawListScale = this->GetScale();
+		Menu_CallDrawList(drawList, drawListSize);
+		return;
+	}
+
+	// overflowed - nothing was drawn, so draw directly and retry bigger
+	MemTrack_Free(drawList);
+	drawList = NULL;
+	drawListCapacity *= 2;
+
+	if(drawListCapacity > DRAWLIST_MAX_SIZE)
+		drawListCapacity = 0; // too big to be worth caching
+
+	this->DrawElements();
+}
+
 void GuiWindow::Draw()
 {
 	if(_elements.size() == 0 || !this->IsVisible())
 		return;
 
-	for (u8 i = 0; i < _elements.size(); i++)
+	if(Menu_IsRecordingDrawList())
 	{
-		try	{ _elements.at(i)->Draw(); }
-		catch (const std::exception& e) { }
+		// a parent window is recording, and lists can't be nested
+		this->DrawElements();
+	}
+	else if(this->IsDrawListValid())
+	{
+		Menu_CallDrawList(drawList, drawListSize);
+	}
+	else
+	{
+		// only record once nothing has changed for a whole frame, so
+		// animations and hovering don't re-record every frame
+		bool record = !dirty && drawListCapacity > 0;
+
+		dirty = false;
+		drawListSize = 0;
+
+		if(record)
+			this->RecordDrawList();
+		else
+			this->DrawElements();
 	}
 
 	this->UpdateEffects();
@@ -109,9 +206,21 @@ void GuiWindow::ResetState()
 	}
 }
 
+void GuiWindow::ResetEffects()
+{
+	GuiElement::ResetEffects();
+
+	for (u8 i = 0; i < _elements.size(); i++)
+	{
+		try { _elements.at(i)->ResetEffects(); }
+		catch (const std::exception& e) { }
+	}
+}
+
 void GuiWindow::SetState(int s)
 {
 	state = s;
+	this->MarkDirty();
 
 	for (u8 i = 0; i < _elements.size(); i++)
 	{
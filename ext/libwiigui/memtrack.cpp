@@ -0,0 +1,315 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * memtrack.cpp
+ * Heap accounting by subsystem
+ ***************************************************************************/
+
+#include <gccore.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <new>
+
+#include "memtrack.h"
+
+#define MEM_HEADER 32 // keeps the payload 32 byte aligned
+#define MEM_MAGIC 0x4D454D54 // 'MEMT'
+#define MEM2_START 0x90000000
+#define MEMTRACK_THREADS 8 // threads that can have a tag set at the same time
+
+typedef struct _memheader {
+	u32 magic;
+	u32 size; // bytes requested
+	u16 offset; // distance from the start of the block to the payload
+	u8 tag;
+	u8 pad;
+} MemHeader;
+
+typedef struct _memthreadtag {
+	lwp_t thread;
+	u8 tag; // MEM_TAG_OTHER marks a free entry
+} MemThreadTag;
+
+static MemTagStats stats[MEM_TAG_COUNT]; // frameAllocs counts the frame in progress
+static MemTagStats lastStats[MEM_TAG_COUNT];
+static MemThreadTag threadTags[MEMTRACK_THREADS]; // threads whose tag isn't MEM_TAG_OTHER
+
+static const char * tagNames[MEM_TAG_COUNT] = { "other", "texture", "glyph",
+	"sound", "music", "gui", "game" };
+
+static void AddBytes(u8 tag, s32 bytes, bool mem2)
+{
+	MemTagStats &s = stats[tag];
+
+	s.liveBytes += bytes;
+	if(mem2)
+		s.mem2Bytes += bytes;
+	if(s.liveBytes > s.peakBytes)
+		s.peakBytes = s.liveBytes;
+}
+
+static int FindThreadTag(lwp_t thread)
+{
+	for(int i=0; i < MEMTRACK_THREADS; i++)
+	{
+		if(threadTags[i].tag != MEM_TAG_OTHER && threadTags[i].thread == thread)
+			return i;
+	}
+	return -1;
+}
+
+#if MEMTRACK
+/****************************************************************************
+ * MemTrack_Memalign
+ *
+ * Allocates a buffer owned by the given subsystem. Must be released with
+ * MemTrack_Free.
+ ***************************************************************************/
+void * MemTrack_Memalign(u8 tag, u32 align, u32 size)
+{
+	if(align < MEM_HEADER)
+		align = MEM_HEADER;
+	if(tag >= MEM_TAG_COUNT)
+		tag = MEM_TAG_OTHER;
+
+	u8 * block = (u8 *)memalign(align, align + size);
+
+	if(!block)
+		return NULL;
+
+	u8 * ptr = block + align;
+	MemHeader * header = (MemHeader *)(ptr - sizeof(MemHeader));
+	header->magic = MEM_MAGIC;
+	header->size = size;
+	header->offset = align;
+	header->tag = tag;
+
+	u32 level;
+	_CPU_ISR_Disable(level);
+	AddBytes(tag, size, (u32)block >= MEM2_START);
+	stats[tag].liveAllocs++;
+	stats[tag].frameAllocs++;
+	_CPU_ISR_Restore(level);
+	return ptr;
+}
+
+void * MemTrack_Malloc(u8 tag, u32 size)
+{
+	return MemTrack_Memalign(tag, MEM_HEADER, size);
+}
+
+/****************************************************************************
+ * MemTrack_Free
+ ***************************************************************************/
+void MemTrack_Free(void * ptr)
+{
+	if(!ptr)
+		return;
+
+	MemHeader * header = (MemHeader *)((u8 *)ptr - sizeof(MemHeader));
+
+	if(header->magic != MEM_MAGIC)
+	{
+		printf("MemTrack: %p was not allocated by MemTrack\n", ptr);
+		return;
+	}
+
+	u8 * block = (u8 *)ptr - header->offset;
+	header->magic = 0;
+
+	u32 level;
+	_CPU_ISR_Disable(level);
+	AddBytes(header->tag, -(s32)header->size, (u32)block >= MEM2_START);
+	stats[header->tag].liveAllocs--;
+	_CPU_ISR_Restore(level);
+
+	free(block);
+}
+
+void * operator new(size_t size)
+{
+	void * ptr = MemTrack_Malloc(MemTrack_GetTag(), size);
+
+	if(!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void * operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void * operator new(size_t size, const std::nothrow_t &) throw()
+{
+	return MemTrack_Malloc(MemTrack_GetTag(), size);
+}
+
+void * operator new[](size_t size, const std::nothrow_t &) throw()
+{
+	return MemTrack_Malloc(MemTrack_GetTag(), size);
+}
+
+void operator delete(void * ptr) throw()
+{
+	MemTrack_Free(ptr);
+}
+
+void operator delete[](void * ptr) throw()
+{
+	MemTrack_Free(ptr);
+}
+#endif
+
+/****************************************************************************
+ * MemTrack_SetTag
+ *
+ * Sets the subsystem that operator new charges for the calling thread, and
+ * returns the previous one. Up to MEMTRACK_THREADS threads can have a tag
+ * other than MEM_TAG_OTHER at once; a thread past that keeps MEM_TAG_OTHER.
+ ***************************************************************************/
+u8 MemTrack_SetTag(u8 tag)
+{
+	if(tag >= MEM_TAG_COUNT)
+		tag = MEM_TAG_OTHER;
+
+	lwp_t self = LWP_GetSelf();
+	u32 level;
+	_CPU_ISR_Disable(level);
+
+	int i = FindThreadTag(self);
+	u8 prevTag = i < 0 ? MEM_TAG_OTHER : threadTags[i].tag;
+
+	if(i < 0 && tag != MEM_TAG_OTHER)
+	{
+		for(i=0; i < MEMTRACK_THREADS && threadTags[i].tag != MEM_TAG_OTHER; i++);
+		if(i == MEMTRACK_THREADS)
+			i = -1;
+	}
+	if(i >= 0)
+	{
+		threadTags[i].thread = self;
+		threadTags[i].tag = tag; // MEM_TAG_OTHER frees the entry again
+	}
+	_CPU_ISR_Restore(level);
+	return prevTag;
+}
+
+/****************************************************************************
+ * MemTrack_GetTag
+ *
+ * The subsystem that operator new charges for the calling thread
+ ***************************************************************************/
+u8 MemTrack_GetTag()
+{
+	int i = FindThreadTag(LWP_GetSelf());
+	return i < 0 ? MEM_TAG_OTHER : threadTags[i].tag;
+}
+
+/****************************************************************************
+ * MemTrack_HeapUsed
+ *
+ * Bytes currently allocated from the heap by anyone
+ ***************************************************************************/
+u32 MemTrack_HeapUsed()
+{
+	return mallinfo().uordblks;
+}
+
+/****************************************************************************
+ * MemTrack_GetArenaFree
+ *
+ * Bytes of MEM1 and MEM2 not yet handed to the heap or claimed otherwise
+ ***************************************************************************/
+void MemTrack_GetArenaFree(u32 * mem1, u32 * mem2)
+{
+	*mem1 = (u32)SYS_GetArena1Hi() - (u32)SYS_GetArena1Lo();
+	*mem2 = (u32)SYS_GetArena2Hi() - (u32)SYS_GetArena2Lo();
+}
+
+/****************************************************************************
+ * MemTrack_AddExternal
+ *
+ * Books memory allocated by a library on behalf of a subsystem; a negative
+ * count releases it again.
+ ***************************************************************************/
+void MemTrack_AddExternal(u8 tag, s32 bytes)
+{
+#if MEMTRACK
+	if(tag >= MEM_TAG_COUNT)
+		tag = MEM_TAG_OTHER;
+
+	u32 level;
+	_CPU_ISR_Disable(level);
+	if(bytes < 0 && (u32)-bytes > stats[tag].liveBytes)
+		bytes = -(s32)stats[tag].liveBytes; // the estimate was off
+	AddBytes(tag, bytes, false);
+	_CPU_ISR_Restore(level);
+#endif
+}
+
+/****************************************************************************
+ * MemTrack_EndFrame
+ *
+ * Called once a frame has been submitted. Takes a snapshot of the counters
+ * and starts counting the allocations of the next frame.
+ ***************************************************************************/
+void MemTrack_EndFrame()
+{
+#if MEMTRACK
+	u32 level;
+	_CPU_ISR_Disable(level);
+	for(int i=0; i < MEM_TAG_COUNT; i++)
+	{
+		if(stats[i].frameAllocs > stats[i].peakFrameAllocs)
+			stats[i].peakFrameAllocs = stats[i].frameAllocs;
+		lastStats[i] = stats[i];
+		stats[i].frameAllocs = 0;
+	}
+	_CPU_ISR_Restore(level);
+#endif
+}
+
+const MemTagStats * MemTrack_GetStats(u8 tag)
+{
+	return &lastStats[tag < MEM_TAG_COUNT ? tag : MEM_TAG_OTHER];
+}
+
+const char * MemTrack_GetTagName(u8 tag)
+{
+	return tagNames[tag < MEM_TAG_COUNT ? tag : MEM_TAG_OTHER];
+}
+
+/****************************************************************************
+ * MemTrack_Dump
+ *
+ * Writes the counters of every subsystem as text, one subsystem per line,
+ * followed by the state of the heap and both memory arenas
+ ***************************************************************************/
+bool MemTrack_Dump(const char * path)
+{
+	FILE * file = fopen(path, "w");
+
+	if(!file)
+		return false;
+
+	fprintf(file, "# tag live mem2 peak allocs frameallocs peakframeallocs\n");
+
+	for(int i=0; i < MEM_TAG_COUNT; i++)
+	{
+		const MemTagStats &s = lastStats[i];
+		fprintf(file, "%s %u %u %u %u %u %u\n", tagNames[i], s.liveBytes,
+			s.mem2Bytes, s.peakBytes, s.liveAllocs, s.frameAllocs,
+			s.peakFrameAllocs);
+	}
+
+	struct mallinfo info = mallinfo();
+	u32 mem1Free, mem2Free;
+	MemTrack_GetArenaFree(&mem1Free, &mem2Free);
+	fprintf(file, "# heap used %u, heap free %u, mem1 free %u, mem2 free %u\n",
+		info.uordblks, info.fordblks, mem1Free, mem2Free);
+
+	fclose(file);
+	return true;
+}
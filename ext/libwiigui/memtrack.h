@@ -0,0 +1,92 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * memtrack.h
+ * Heap accounting by subsystem
+ *
+ * Textures, glyphs, sounds and game state are allocated through the
+ * MemTrack_* wrappers below, each tagged with the subsystem that owns the
+ * memory. With MEMTRACK enabled, every tagged buffer carries a small
+ * header and the live bytes, peak bytes and allocations per frame of its
+ * subsystem are counted; operator new and delete are routed through the
+ * same counters, using the tag the calling thread set with MemTrack_SetTag
+ * (or a MemTagScope).
+ * With MEMTRACK disabled the wrappers are plain malloc, memalign and free.
+ *
+ * Libraries that allocate internally (Tremor, MODPlay) cannot be wrapped;
+ * their use is estimated from the heap size before and after they are set
+ * up, and booked with MemTrack_AddExternal.
+ ***************************************************************************/
+
+#ifndef _MEMTRACK_H_
+#define _MEMTRACK_H_
+
+#include <gccore.h>
+#include <malloc.h>
+
+// set to 1 to count heap use by subsystem
+#ifndef MEMTRACK
+#define MEMTRACK 0
+#endif
+
+enum
+{
+	MEM_TAG_OTHER,
+	MEM_TAG_TEXTURE, // decoded images
+	MEM_TAG_GLYPH, // font atlas and glyph textures
+	MEM_TAG_SOUND, // sound effect buffers
+	MEM_TAG_MUSIC, // music decoders and their buffers
+	MEM_TAG_GUI, // widgets, text and display lists
+	MEM_TAG_GAME, // players, pieces and powerups
+	MEM_TAG_COUNT
+};
+
+typedef struct _memtagstats {
+	u32 liveBytes; // bytes currently allocated
+	u32 mem2Bytes; // part of liveBytes that lives in MEM2
+	u32 peakBytes; // highest liveBytes seen
+	u32 liveAllocs; // buffers currently allocated
+	u32 frameAllocs; // allocations made during the last completed frame
+	u32 peakFrameAllocs; // highest frameAllocs seen
+} MemTagStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if MEMTRACK
+void * MemTrack_Malloc(u8 tag, u32 size);
+void * MemTrack_Memalign(u8 tag, u32 align, u32 size);
+void MemTrack_Free(void * ptr);
+#else
+static inline void * MemTrack_Malloc(u8 tag, u32 size) { (void)tag; return malloc(size); }
+static inline void * MemTrack_Memalign(u8 tag, u32 align, u32 size) { (void)tag; return memalign(align, size); }
+static inline void MemTrack_Free(void * ptr) { free(ptr); }
+#endif
+
+u8 MemTrack_SetTag(u8 tag);
+u8 MemTrack_GetTag();
+u32 MemTrack_HeapUsed();
+void MemTrack_GetArenaFree(u32 * mem1, u32 * mem2);
+void MemTrack_AddExternal(u8 tag, s32 bytes);
+void MemTrack_EndFrame();
+const MemTagStats * MemTrack_GetStats(u8 tag);
+const char * MemTrack_GetTagName(u8 tag);
+bool MemTrack_Dump(const char * path);
+
+#ifdef __cplusplus
+}
+
+/// Tags the operator new calls this thread makes while it is in scope.
+class MemTagScope
+{
+	public:
+		MemTagScope(u8 tag) { prevTag = MemTrack_SetTag(tag); }
+		~MemTagScope() { MemTrack_SetTag(prevTag); }
+	private:
+		u8 prevTag;
+};
+#endif
+
+#endif
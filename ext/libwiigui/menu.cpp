@@ -26,21 +26,29 @@ GuiImage * bgImg = NULL;
 GuiSound * bgMusic = NULL;
 GuiWindow * mainWindow = NULL;
 static lwp_t guithread = LWP_THREAD_NULL;
+static mutex_t guiMutex = LWP_MUTEX_NULL;
+static cond_t guiCond = LWP_COND_NULL;
 static bool guiHalt = true;
+static bool guiIdle = true; // GUI thread is parked and not touching any element
+static u32 guiFrame = 0; // frames completed by the GUI thread
+static bool guiButtonDown = false; // latched by the GUI thread, cleared by GuiButtonPressed
 int ExitRequested = 0;
 
 /****************************************************************************
  * ResumeGui
  *
- * Signals the GUI thread to start, and resumes the thread. This is called
+ * Signals the GUI thread to start, and wakes it up. This is called
  * after finishing the removal/insertion of new elements, and after initial
- * GUI setup.
+ * GUI setup. From here on the GUI thread owns rendering and is the only
+ * thread that scans the pads.
  ***************************************************************************/
 //static 
 void ResumeGui()
 {
+	LWP_MutexLock(guiMutex);
 	guiHalt = false;
-	LWP_ResumeThread (guithread);
+	LWP_CondBroadcast(guiCond);
+	LWP_MutexUnlock(guiMutex);
 }
 
 /****************************************************************************
@@ -50,15 +58,60 @@ void ResumeGui()
  * This is necessary whenever removing/inserting new elements into the GUI.
  * This eliminates the possibility that the GUI is in the middle of accessing
  * an element that is being changed.
+ * Once this returns, the caller owns rendering and input until ResumeGui.
  ***************************************************************************/
 //static 
 void HaltGui()
 {
+	LWP_MutexLock(guiMutex);
 	guiHalt = true;
+	LWP_CondBroadcast(guiCond); // release anyone in WaitGuiFrame
 
-	// wait for thread to finish
-	while(!LWP_ThreadIsSuspended(guithread))
+	// wait for thread to finish its frame and park
+	while(!guiIdle)
+		LWP_CondWait(guiCond, guiMutex);
+	LWP_MutexUnlock(guiMutex);
+}
+
+/****************************************************************************
+ * WaitGuiFrame
+ *
+ * Blocks until the GUI thread has finished drawing another frame, so menu
+ * loops polling button states wake once per frame instead of spinning.
+ * If the GUI is halted there is no frame to wait for, so just yield.
+ ***************************************************************************/
+void WaitGuiFrame()
+{
+	LWP_MutexLock(guiMutex);
+
+	if(guiHalt)
+	{
+		LWP_MutexUnlock(guiMutex);
 		usleep(THREAD_SLEEP);
+		return;
+	}
+
+	u32 frame = guiFrame;
+
+	while(guiFrame == frame && !guiHalt)
+		LWP_CondWait(guiCond, guiMutex);
+	LWP_MutexUnlock(guiMutex);
+}
+
+/****************************************************************************
+ * GuiButtonPressed
+ *
+ * Returns true if any button on any controller was pressed since the last
+ * call. The GUI thread latches presses as it scans the pads, so other
+ * threads never have to read WPAD/PAD state while it owns input.
+ ***************************************************************************/
+bool GuiButtonPressed()
+{
+	LWP_MutexLock(guiMutex);
+	bool pressed = guiButtonDown;
+	guiButtonDown = false;
+	LWP_MutexUnlock(guiMutex);
+	return pressed;
 }
 
 /****************************************************************************
@@ -151,7 +204,7 @@ WindowPrompt(const char *title, const char *msg, const char *btn1Label, const ch
 
 	while(choice == -1)
 	{
-		usleep(THREAD_SLEEP);
+		WaitGuiFrame();
 
 		if(btn1.GetState() == STATE_CLICKED)
 			choice = 1;
@@ -160,7 +213,7 @@ WindowPrompt(const char *title, const char *msg, const char *btn1Label, const ch
 	}
 
 	promptWindow.SetEffect(EFFECT_SLIDE_TOP | EFFECT_SLIDE_OUT, 50);
-	while(promptWindow.GetEffect() > 0) usleep(THREAD_SLEEP);
+	while(promptWindow.GetEffect() > 0) WaitGuiFrame();
 	HaltGui();
 	parentWindow->Remove(&promptWindow);
 	parentWindow->SetState(STATE_DEFAULT);
@@ -178,45 +231,70 @@ static void *
 UpdateGUI (void *arg)
 {
 	int i;
+	bool pressed;
 
 	while(1)
 	{
-		if(guiHalt)
+		// park until resumed; HaltGui is waiting for guiIdle
+		LWP_MutexLock(guiMutex);
+		while(guiHalt)
 		{
-			LWP_SuspendThread(guithread);
+			guiIdle = true;
+			LWP_CondBroadcast(guiCond);
+			LWP_CondWait(guiCond, guiMutex);
 		}
-		else
-		{
-			UpdatePads();
-			mainWindow->Draw();
+		guiIdle = false;
+		LWP_MutexUnlock(guiMutex);
+
+		UpdatePads();
+		mainWindow->Draw();
+
+		pressed = false;
 
+		for(i=3; i >= 0; i--)
+		{
+			if(userInput[i].pad.btns_d)
+				pressed = true;
 			#ifdef HW_RVL
-			for(i=3; i >= 0; i--) // so that player 1's cursor appears on top!
-			{
-				if(userInput[i].wpad->ir.valid)
-					Menu_DrawImg(userInput[i].wpad->ir.x-48, userInput[i].wpad->ir.y-48,
-						96, 96, pointer[i]->GetImage(), userInput[i].wpad->ir.angle, 1, 1, 255);
-				DoRumble(i);
-			}
+			if(userInput[i].wpad->btns_d)
+				pressed = true;
 			#endif
+		}
+
+		#ifdef HW_RVL
+		for(i=3; i >= 0; i--) // so that player 1's cursor appears on top!
+		{
+			if(userInput[i].wpad->ir.valid)
+				Menu_DrawTexObj(userInput[i].wpad->ir.x-48, userInput[i].wpad->ir.y-48,
+					96, 96, pointer[i]->GetTexObj(), userInput[i].wpad->ir.angle, 1, 1, 255);
+			DoRumble(i);
+		}
+		#endif
 
-			Menu_Render();
+		Menu_Render(); // waits for vsync, which paces this thread
 
-			for(i=0; i < 4; i++)
-				mainWindow->Update(&userInput[i]);
+		for(i=0; i < 4; i++)
+			mainWindow->Update(&userInput[i]);
 
-			if(ExitRequested)
+		if(ExitRequested)
+		{
+			for(i = 0; i < 255; i += 15)
 			{
-				for(i = 0; i < 255; i += 15)
-				{
-					mainWindow->Draw();
-					Menu_DrawRectangle(0,0,screenwidth,screenheight,(GXColor){0, 0, 0, i},1);
-					Menu_Render();
-				}
-				//ExitApp();
-				//return NULL;
+				mainWindow->Draw();
+				Menu_DrawRectangle(0,0,screenwidth,screenheight,(GXColor){0, 0, 0, i},1);
+				Menu_Render();
 			}
+			//ExitApp();
+			//return NULL;
 		}
+
+		// publish the frame to WaitGuiFrame/GuiButtonPressed
+		LWP_MutexLock(guiMutex);
+		guiFrame++;
+		if(pressed)
+			guiButtonDown = true;
+		LWP_CondBroadcast(guiCond);
+		LWP_MutexUnlock(guiMutex);
 	}
 	return NULL;
 }
@@ -229,6 +307,8 @@ UpdateGUI (void *arg)
 void
 InitGUIThreads()
 {
+	LWP_MutexInit(&guiMutex, false);
+	LWP_CondInit(&guiCond);
 	LWP_CreateThread (&guithread, UpdateGUI, NULL, NULL, 0, 70);
 }
 
@@ -289,7 +369,7 @@ InitGUIThreads()
 
 	while(save == -1)
 	{
-		usleep(THREAD_SLEEP);
+		WaitGuiFrame();
 
 		if(okBtn.GetState() == STATE_CLICKED)
 			save = 1;
@@ -373,7 +453,7 @@ InitGUIThreads()
 
 	while(menu == MENU_NONE)
 	{
-		usleep(THREAD_SLEEP);
+		WaitGuiFrame();
 
 		// update file browser based on arrow buttons
 		// set MENU_EXIT if A button pressed on a file
@@ -561,7 +641,7 @@ InitGUIThreads()
 
 	while(menu == MENU_NONE)
 	{
-		usleep(THREAD_SLEEP);
+		WaitGuiFrame();
 
 		if(fileBtn.GetState() == STATE_CLICKED)
 		{
@@ -666,7 +746,7 @@ InitGUIThreads()
 
 	while(menu == MENU_NONE)
 	{
-		usleep(THREAD_SLEEP);
+		WaitGuiFrame();
 
 		ret = optionBrowser.GetClickedOption();
 
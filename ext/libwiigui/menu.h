@@ -19,6 +19,8 @@ void InitGUIThreads();
 void MainMenu();
 void ResumeGui();
 void HaltGui();
+void WaitGuiFrame();
+bool GuiButtonPressed();
 int WindowPrompt(const char *title, const char *msg, const char *btn1Label, const char *btn2Label = NULL, GuiWindow *parentWindow = NULL);
 
 enum
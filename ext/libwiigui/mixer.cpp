@@ -0,0 +1,373 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * mixer.cpp
+ * Software mixer for the sound effects
+ *
+ * A sound is either raw PCM (16 bit, big endian, stereo, MIXER_PCM_RATE)
+ * or IMA ADPCM built by tools/adpcmenc, which is decoded frame by frame as
+ * it is mixed. Every voice steps through its sound in 16.16 fixed point
+ * and interpolates linearly between two frames, so sounds of any rate
+ * come out at MIXER_RATE.
+ *
+ * Mixer_Render runs in the ASND callback; everything else runs on game
+ * threads and keeps interrupts off while it touches the voices.
+ ***************************************************************************/
+
+#include <string.h>
+
+#include "mixer.h"
+#include "imaadpcm.h"
+
+#ifdef GEKKO
+#include <ogc/irq.h>
+#define MIXER_LOCK() u32 level = IRQ_Disable()
+#define MIXER_UNLOCK() IRQ_Restore(level)
+#else
+#define MIXER_LOCK()
+#define MIXER_UNLOCK()
+#endif
+
+struct MixerVoice
+{
+	const unsigned char * sound; // the sound as given to Mixer_Play
+	const unsigned char * data; // the frames, or the ADPCM blocks
+	unsigned frames;
+	unsigned pos; // next frame to fetch
+	unsigned frac; // position between prev and cur, 16.16
+	unsigned step; // frames per output frame, 16.16
+	int channels;
+	bool adpcm;
+	AdpcmState state[2]; // ADPCM decoder state at pos
+	int prev[2]; // the frames either side of the position
+	int cur[2];
+	int category;
+	int priority;
+	int volume; // 0-255
+	unsigned serial; // start order
+	unsigned generation; // bumped whenever the voice is (re)started
+	bool active;
+	bool paused;
+};
+
+static MixerVoice voices[MIXER_VOICES];
+static int categoryVolume[MIXER_CATEGORIES] = { 255, 255 };
+static unsigned serial = 0;
+static MixerStats stats;
+
+static unsigned ReadU16(const unsigned char * p)
+{
+	return (p[0] << 8) | p[1];
+}
+
+static unsigned ReadU32(const unsigned char * p)
+{
+	return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+/****************************************************************************
+ * NextFrame
+ *
+ * Fetches the frame at pos into cur (mono is copied to both sides);
+ * returns false once the sound is over
+ ***************************************************************************/
+static bool NextFrame(MixerVoice * v)
+{
+	if(v->pos >= v->frames)
+		return false;
+
+	if(!v->adpcm)
+	{
+		const unsigned char * p = v->data + v->pos * v->channels * 2;
+		v->cur[0] = (short)ReadU16(p);
+		v->cur[1] = v->channels == 2 ? (short)ReadU16(p + 2) : v->cur[0];
+	}
+	else
+	{
+		unsigned i = v->pos % ADPCM_BLOCK_FRAMES;
+		const unsigned char * codes = v->data +
+			(v->pos / ADPCM_BLOCK_FRAMES) * ADPCM_BLOCK_BYTES(v->channels) + 4 * v->channels;
+
+		if(i == 0)
+			AdpcmReadState(codes - 4 * v->channels, v->channels, v->state);
+
+		if(v->channels == 2)
+		{
+			v->cur[0] = AdpcmDecodeSample(&v->state[0], codes[i] >> 4);
+			v->cur[1] = AdpcmDecodeSample(&v->state[1], codes[i] & 0xF);
+		}
+		else
+		{
+			v->cur[0] = v->cur[1] = AdpcmDecodeSample(&v->state[0],
+				(i & 1) ? codes[i >> 1] & 0xF : codes[i >> 1] >> 4);
+		}
+	}
+
+	v->pos++;
+	return true;
+}
+
+static MixerVoice * FindVoice(int handle)
+{
+	if(handle < 0)
+		return NULL;
+
+	MixerVoice * v = &voices[handle % MIXER_VOICES];
+
+	if(!v->active || v->generation != (unsigned)handle / MIXER_VOICES)
+		return NULL;
+	return v;
+}
+
+/****************************************************************************
+ * Mixer_Play
+ *
+ * Starts a sound and returns its handle, or -1 if it can't be played
+ ***************************************************************************/
+int Mixer_Play(const unsigned char * snd, int len, int category, int priority, int volume)
+{
+	if(!snd || len <= 0 || category < 0 || category >= MIXER_CATEGORIES)
+		return -1;
+
+	int channels = 2;
+	int rate = MIXER_PCM_RATE;
+	unsigned frames = len / 4;
+	bool adpcm = false;
+
+	const unsigned char * data = snd;
+
+	if(len >= ADPCM_HEADER && memcmp(snd, "TADP", 4) == 0)
+	{
+		channels = ReadU16(snd + 6);
+		rate = ReadU32(snd + 8);
+		frames = ReadU32(snd + 12);
+		unsigned blocks = (frames + ADPCM_BLOCK_FRAMES - 1) / ADPCM_BLOCK_FRAMES;
+
+		if(ReadU16(snd + 4) != ADPCM_VERSION || (channels != 1 && channels != 2) ||
+			rate <= 0 || ADPCM_HEADER + blocks * ADPCM_BLOCK_BYTES(channels) > (unsigned)len)
+			return -1;
+
+		data += ADPCM_HEADER;
+		adpcm = true;
+	}
+
+	if(frames == 0)
+		return -1;
+
+	MIXER_LOCK();
+
+	// a free voice, or else the lowest priority one, oldest first
+	MixerVoice * v = NULL;
+
+	for(int i=0; i < MIXER_VOICES; i++)
+	{
+		MixerVoice * c = &voices[i];
+
+		if(!c->active)
+		{
+			v = c;
+			break;
+		}
+		if(c->priority <= priority && (!v || c->priority < v->priority ||
+			(c->priority == v->priority && (int)(c->serial - v->serial) < 0)))
+			v = c;
+	}
+
+	if(!v)
+	{
+		stats.dropped++;
+		MIXER_UNLOCK();
+		return -1;
+	}
+
+	if(v->active)
+		stats.stolen++;
+	else if(++stats.active > stats.peak)
+		stats.peak = stats.active;
+
+	stats.played++;
+
+	v->sound = snd;
+	v->data = data;
+	v->frames = frames;
+	v->pos = 0;
+	v->frac = 0;
+	v->step = ((unsigned)rate << 16) / MIXER_RATE;
+	v->channels = channels;
+	v->adpcm = adpcm;
+	v->prev[0] = v->prev[1] = 0;
+	NextFrame(v);
+	v->category = category;
+	v->priority = priority;
+	v->volume = volume;
+	v->serial = serial++;
+	v->generation = (v->generation + 1) % 0x1000000;
+	v->paused = false;
+	v->active = true;
+
+	int handle = v->generation * MIXER_VOICES + (v - voices);
+	MIXER_UNLOCK();
+	return handle;
+}
+
+/****************************************************************************
+ * Mixer_Stop
+ ***************************************************************************/
+void Mixer_Stop(int handle)
+{
+	MIXER_LOCK();
+	MixerVoice * v = FindVoice(handle);
+
+	if(v)
+	{
+		v->active = false;
+		stats.active--;
+	}
+	MIXER_UNLOCK();
+}
+
+/****************************************************************************
+ * Mixer_StopData
+ *
+ * Stops every voice playing the given sound, however many times it was
+ * started; call it before the sound is freed
+ ***************************************************************************/
+void Mixer_StopData(const unsigned char * snd)
+{
+	MIXER_LOCK();
+
+	for(int i=0; i < MIXER_VOICES; i++)
+	{
+		MixerVoice * v = &voices[i];
+
+		if(v->active && v->sound == snd)
+		{
+			v->active = false;
+			stats.active--;
+		}
+	}
+	MIXER_UNLOCK();
+}
+
+/****************************************************************************
+ * Mixer_Pause
+ ***************************************************************************/
+void Mixer_Pause(int handle, bool pause)
+{
+	MIXER_LOCK();
+	MixerVoice * v = FindVoice(handle);
+
+	if(v)
+		v->paused = pause;
+	MIXER_UNLOCK();
+}
+
+/****************************************************************************
+ * Mixer_SetVolume
+ *
+ * Sets the volume (0-255) of a playing sound
+ ***************************************************************************/
+void Mixer_SetVolume(int handle, int volume)
+{
+	MIXER_LOCK();
+	MixerVoice * v = FindVoice(handle);
+
+	if(v)
+		v->volume = volume;
+	MIXER_UNLOCK();
+}
+
+bool Mixer_IsPlaying(int handle)
+{
+	return FindVoice(handle) != NULL;
+}
+
+/****************************************************************************
+ * Mixer_SetCategoryVolume
+ *
+ * Scales the volume (0-255) of every sound in the category
+ ***************************************************************************/
+void Mixer_SetCategoryVolume(int category, int volume)
+{
+	if(category >= 0 && category < MIXER_CATEGORIES)
+		categoryVolume[category] = volume;
+}
+
+int Mixer_GetCategoryVolume(int category)
+{
+	if(category < 0 || category >= MIXER_CATEGORIES)
+		return 0;
+	return categoryVolume[category];
+}
+
+/****************************************************************************
+ * MixVoice
+ *
+ * Adds frames of the voice to the mix; returns false once it is over
+ ***************************************************************************/
+static bool MixVoice(MixerVoice * v, int * mix, int frames)
+{
+	// volume * category volume is at most 65025, so a sample times the
+	// gain still fits in an int
+	int gain = v->volume * categoryVolume[v->category];
+
+	for(int i=0; i < frames; i++, mix += 2)
+	{
+		int t = v->frac >> 1; // 15 bits, so the products fit too
+		mix[0] += ((v->prev[0] + (((v->cur[0] - v->prev[0]) * t) >> 15)) * gain) >> 16;
+		mix[1] += ((v->prev[1] + (((v->cur[1] - v->prev[1]) * t) >> 15)) * gain) >> 16;
+
+		for(v->frac += v->step; v->frac >= 0x10000; v->frac -= 0x10000)
+		{
+			v->prev[0] = v->cur[0];
+			v->prev[1] = v->cur[1];
+
+			if(!NextFrame(v))
+				return false;
+		}
+	}
+	return true;
+}
+
+/****************************************************************************
+ * Mixer_Render
+ *
+ * Mixes the next frames of every playing sound into out (interleaved
+ * stereo, native endian)
+ ***************************************************************************/
+void Mixer_Render(short * out, int frames)
+{
+	int mix[MIXER_CHUNK * 2];
+
+	while(frames > 0)
+	{
+		int count = frames < MIXER_CHUNK ? frames : MIXER_CHUNK;
+
+		memset(mix, 0, count * 2 * sizeof(int));
+
+		for(int i=0; i < MIXER_VOICES; i++)
+		{
+			MixerVoice * v = &voices[i];
+
+			if(!v->active || v->paused)
+				continue;
+
+			if(!MixVoice(v, mix, count))
+			{
+				v->active = false;
+				stats.active--;
+			}
+		}
+
+		for(int i=0; i < count * 2; i++)
+			*out++ = mix[i] > 32767 ? 32767 : (mix[i] < -32768 ? -32768 : mix[i]);
+
+		frames -= count;
+	}
+}
+
+void Mixer_GetStats(MixerStats * s)
+{
+	*s = stats;
+}
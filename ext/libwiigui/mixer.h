@@ -0,0 +1,59 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * mixer.h
+ * Software mixer for the sound effects
+ *
+ * Mixes up to MIXER_VOICES sounds into one stereo stream at MIXER_RATE,
+ * which audio.cpp plays on a single ASND voice. Plain C++ with no libogc
+ * types, so tools/mixrender can run the same mixer offline on the host.
+ ***************************************************************************/
+
+#ifndef _MIXER_H_
+#define _MIXER_H_
+
+#define MIXER_VOICES 16 // sounds that can play at once
+#define MIXER_RATE 48000 // output rate, the one ASND mixes at
+#define MIXER_PCM_RATE 44100 // rate of the raw .pcm sounds
+#define MIXER_CHUNK 256 // frames mixed in one pass
+
+// Sound categories, each with its own volume
+enum
+{
+	MIXER_UI, // menu and button sounds
+	MIXER_EFFECTS, // game sounds
+	MIXER_CATEGORIES
+};
+
+// When every voice is busy, a sound takes over the voice of the lowest
+// priority sound playing (the oldest of those) if that priority is no
+// higher than its own; otherwise it isn't played.
+enum
+{
+	MIXER_PRIORITY_LOW = 0,
+	MIXER_PRIORITY_NORMAL = 128,
+	MIXER_PRIORITY_HIGH = 255
+};
+
+typedef struct
+{
+	int active; // voices playing
+	int peak; // most voices playing at once
+	unsigned played; // sounds started
+	unsigned stolen; // sounds cut off by a sound of equal or higher priority
+	unsigned dropped; // sounds not played, every voice had a higher priority
+} MixerStats;
+
+int Mixer_Play(const unsigned char * snd, int len, int category, int priority, int volume);
+void Mixer_Stop(int handle);
+void Mixer_StopData(const unsigned char * snd);
+void Mixer_Pause(int handle, bool pause);
+void Mixer_SetVolume(int handle, int volume);
+bool Mixer_IsPlaying(int handle);
+void Mixer_SetCategoryVolume(int category, int volume);
+int Mixer_GetCategoryVolume(int category);
+void Mixer_Render(short * out, int frames);
+void Mixer_GetStats(MixerStats * stats);
+
+#endif
@@ -32,7 +32,9 @@
 #include "oggplayer.h"
 #include <gccore.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <string.h>
+#include "memtrack.h"
 
 /* functions to read the Ogg file from memory */
 
@@ -43,6 +45,199 @@ static struct
 	int pos;
 } file[4];
 
+/* functions to stream the Ogg file from a device
+
+ A read-ahead thread keeps up to OGG_READAHEAD_SIZE bytes of the file ahead
+ of the decoder, so the decoder rarely waits on the device and the file
+ never has to fit in memory. A seek within the buffered bytes just skips
+ ahead; any other seek empties the buffer and the thread starts over from
+ the new position. */
+
+#define STREAM_FD 0x670
+
+#define READAHEAD_STACKSIZE 8192
+
+static struct
+{
+	int fd;
+	u32 size; // file size
+	u32 pos; // file offset of the next byte the decoder reads
+	u32 end; // file offset just past the last byte buffered
+	u32 generation; // bumped by every seek that empties the buffer
+	int seek; // the thread must seek to end before reading
+	int running;
+	mutex_t mutex;
+	cond_t cond;
+	u8 data[OGG_READAHEAD_SIZE] ATTRIBUTE_ALIGN(32); // file offset x is at data[x % OGG_READAHEAD_SIZE]
+} stream;
+
+static u8 readahead_stack[READAHEAD_STACKSIZE];
+static lwp_t h_readahead = LWP_THREAD_NULL;
+
+static void * stream_thread(void * arg)
+{
+	u32 offset, generation;
+	int bytes;
+
+	LWP_MutexLock(stream.mutex);
+
+	while (stream.running)
+	{
+		// wait for room for a whole chunk, or for a seek
+		if (!stream.seek && (stream.end >= stream.size
+				|| OGG_READAHEAD_SIZE - (stream.end - stream.pos) < OGG_READ_CHUNK))
+		{
+			LWP_CondWait(stream.cond, stream.mutex);
+			continue;
+		}
+
+		if (stream.seek)
+		{
+			lseek(stream.fd, stream.end, SEEK_SET);
+			stream.seek = 0;
+		}
+
+		offset = stream.end;
+		generation = stream.generation;
+		bytes = OGG_READ_CHUNK;
+
+		if (bytes > (int) (OGG_READAHEAD_SIZE - offset % OGG_READAHEAD_SIZE))
+			bytes = OGG_READAHEAD_SIZE - offset % OGG_READAHEAD_SIZE;
+		if (bytes > (int) (stream.size - offset))
+			bytes = stream.size - offset;
+
+		// the decoder doesn't touch the free part of the buffer, so the
+		// read itself can run unlocked
+		LWP_MutexUnlock(stream.mutex);
+		bytes = read(stream.fd, &stream.data[offset % OGG_READAHEAD_SIZE], bytes);
+		LWP_MutexLock(stream.mutex);
+
+		if (generation != stream.generation)
+			continue; // a seek came in; these bytes are stale
+
+		if (bytes <= 0)
+			stream.size = stream.end; // read error, treat it as the end of the file
+		else
+			stream.end += bytes;
+
+		LWP_CondBroadcast(stream.cond);
+	}
+
+	LWP_MutexUnlock(stream.mutex);
+	return 0;
+}
+
+static int stream_read(u8 * dst, int bytes)
+{
+	int done = 0;
+	int n;
+
+	LWP_MutexLock(stream.mutex);
+
+	while (done < bytes)
+	{
+		if (stream.pos == stream.end)
+		{
+			if (stream.end >= stream.size)
+				break;
+			LWP_CondWait(stream.cond, stream.mutex);
+			continue;
+		}
+
+		n = stream.end - stream.pos;
+		if (n > bytes - done)
+			n = bytes - done;
+		if (n > (int) (OGG_READAHEAD_SIZE - stream.pos % OGG_READAHEAD_SIZE))
+			n = OGG_READAHEAD_SIZE - stream.pos % OGG_READAHEAD_SIZE;
+
+		memcpy(dst + done, &stream.data[stream.pos % OGG_READAHEAD_SIZE], n);
+		stream.pos += n;
+		done += n;
+		LWP_CondBroadcast(stream.cond); // there is room again
+	}
+
+	LWP_MutexUnlock(stream.mutex);
+	return done;
+}
+
+static int stream_seek(ogg_int64_t offset, int mode)
+{
+	ogg_int64_t target = offset;
+
+	if (mode == 1)
+		target += stream.pos;
+	else if (mode == 2)
+		target += stream.size;
+
+	if (target < 0 || target > stream.size)
+		return -1;
+
+	LWP_MutexLock(stream.mutex);
+
+	if (target < stream.pos || target > stream.end)
+	{
+		stream.end = target;
+		stream.seek = 1;
+		stream.generation++;
+	}
+	stream.pos = target;
+
+	LWP_CondBroadcast(stream.cond);
+	LWP_MutexUnlock(stream.mutex);
+	return 0;
+}
+
+static void stream_close()
+{
+	if (h_readahead == LWP_THREAD_NULL)
+		return;
+
+	LWP_MutexLock(stream.mutex);
+	stream.running = 0;
+	LWP_CondBroadcast(stream.cond);
+	LWP_MutexUnlock(stream.mutex);
+
+	LWP_JoinThread(h_readahead, NULL);
+	h_readahead = LWP_THREAD_NULL;
+
+	LWP_CondDestroy(stream.cond);
+	LWP_MutexDestroy(stream.mutex);
+	close(stream.fd);
+}
+
+static int stream_open(const char * path)
+{
+	stream_close();
+
+	stream.fd = open(path, O_RDONLY);
+
+	if (stream.fd < 0)
+		return -1;
+
+	stream.size = lseek(stream.fd, 0, SEEK_END);
+	lseek(stream.fd, 0, SEEK_SET);
+	stream.pos = 0;
+	stream.end = 0;
+	stream.generation = 0;
+	stream.seek = 0;
+	stream.running = 1;
+
+	LWP_MutexInit(&stream.mutex, false);
+	LWP_CondInit(&stream.cond);
+
+	// above the game threads, below the decoder it feeds
+	if (LWP_CreateThread(&h_readahead, stream_thread, NULL, readahead_stack,
+			READAHEAD_STACKSIZE, 75) == -1)
+	{
+		h_readahead = LWP_THREAD_NULL;
+		LWP_CondDestroy(stream.cond);
+		LWP_MutexDestroy(stream.mutex);
+		close(stream.fd);
+		return -1;
+	}
+	return STREAM_FD;
+}
+
 static int f_read(void * punt, int bytes, int blocks, int *f)
 {
 	int b;
@@ -52,6 +247,9 @@ static int f_read(void * punt, int bytes, int blocks, int *f)
 	if (bytes * blocks <= 0)
 		return 0;
 
+	if (*f == STREAM_FD)
+		return stream_read((u8 *) punt, bytes * blocks) / bytes;
+
 	blocks = bytes * blocks;
 	c = 0;
 
@@ -93,7 +291,9 @@ static int f_seek(int *f, ogg_int64_t offset, int mode)
 
 	int k, d;
 	mode &= 3;
-	if (*f >= 0x666 && *f <= 0x669)
+	if (*f == STREAM_FD)
+		k = stream_seek(offset, mode);
+	else if (*f >= 0x666 && *f <= 0x669)
 	{
 		d = (*f) - 0x666;
 		k = 0;
@@ -162,6 +362,11 @@ static int f_seek(int *f, ogg_int64_t offset, int mode)
 static int f_close(int *f)
 {
 	int d;
+	if (*f == STREAM_FD)
+	{
+		stream_close();
+		return 0;
+	}
 	if (*f >= 0x666 && *f <= 0x669)
 	{
 		d = (*f) - 0x666;
@@ -182,7 +387,9 @@ static long f_tell(int *f)
 {
 	int k, d;
 
-	if (*f >= 0x666 && *f <= 0x669)
+	if (*f == STREAM_FD)
+		k = stream.pos;
+	else if (*f >= 0x666 && *f <= 0x669)
 	{
 		d = (*f) - 0x666;
 		k = file[d].pos;
@@ -238,8 +445,11 @@ static ov_callbacks callbacks = {
 
 /* OGG control */
 
-#define READ_SAMPLES 4096 // samples that it must read before to send
-#define MAX_PCMOUT 4096 // minimum size to read ogg samples
+#define SLOT_MASK (OGG_RING_SLOTS - 1)
+
+/* single core, so keeping the compiler from reordering is all it takes */
+#define RING_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
 typedef struct
 {
 	OggVorbis_File vf;
@@ -254,10 +464,22 @@ typedef struct
 	int volume;
 	int seek_time;
 
-	/* OGG buffer control */
-	short pcmout[2][READ_SAMPLES + MAX_PCMOUT * 2]; /* take 4k out of the data segment, not the stack */
-	int pcmout_pos;
-	int pcm_indx;
+	/* OGG buffer control: a ring of decoded slots. The player thread is the
+	 only one to advance head and the ASND callback the only one to advance
+	 tail, so the ring needs no lock. The last two slots handed to ASND (the
+	 one playing and the one queued) can't be written yet, which is why no
+	 more than OGG_RING_HIGH_WATER slots are decoded ahead. */
+	short pcmout[OGG_RING_SLOTS][OGG_SLOT_SAMPLES] ATTRIBUTE_ALIGN(32); /* take it out of the data segment, not the stack */
+	int pcmout_len[OGG_RING_SLOTS]; // samples in each slot
+	volatile u32 head; // slots decoded
+	volatile u32 tail; // slots handed to ASND
+	int pcm_indx; // samples decoded into the slot at head
+
+	// statistics
+	volatile int min_fill;
+	volatile int starving;
+	volatile u32 starved;
+	volatile u32 underruns;
 
 } private_data_ogg;
 
@@ -271,9 +493,13 @@ static u8 oggplayer_stack[STACKSIZE];
 static lwpq_t oggplayer_queue = LWP_TQUEUE_NULL;
 static lwp_t h_oggplayer = LWP_THREAD_NULL;
 static int ogg_thread_running = 0;
+static int ogg_heap_bytes = 0; // heap taken by the decoder, booked as music
 
 static void ogg_add_callback(int voice)
 {
+	u32 tail;
+	int fill;
+
 	if (!ogg_thread_running)
 	{
 		ASND_StopVoice(0);
@@ -283,32 +509,44 @@ static void ogg_add_callback(int voice)
 	if (private_ogg.flag & 128)
 		return; // Ogg is paused
 
-	if (private_ogg.pcm_indx >= READ_SAMPLES)
-	{
-		if (ASND_AddVoice(0,
-				(void *) private_ogg.pcmout[private_ogg.pcmout_pos],
-				private_ogg.pcm_indx << 1) == 0)
-		{
-			private_ogg.pcmout_pos ^= 1;
-			private_ogg.pcm_indx = 0;
-			private_ogg.flag = 0;
-			LWP_ThreadSignal(oggplayer_queue);
-		}
-	}
-	else
+	if (!ASND_TestVoiceBufferReady(0))
+		return;
+
+	tail = private_ogg.tail;
+	fill = private_ogg.head - tail;
+
+	if (fill <= 0)
 	{
-		if (private_ogg.flag & 64)
+		// the voice is on its last buffer; count each dry spell once
+		if (!private_ogg.starving)
 		{
-			private_ogg.flag &= ~64;
-			LWP_ThreadSignal(oggplayer_queue);
+			private_ogg.starving = 1;
+			private_ogg.starved++;
 		}
+		LWP_ThreadSignal(oggplayer_queue);
+		return;
 	}
+
+	if (ASND_AddVoice(0, (void *) private_ogg.pcmout[tail & SLOT_MASK],
+			private_ogg.pcmout_len[tail & SLOT_MASK] << 1) != SND_OK)
+		return;
+
+	private_ogg.tail = tail + 1;
+	private_ogg.starving = 0;
+
+	if (--fill < private_ogg.min_fill)
+		private_ogg.min_fill = fill;
+
+	if (fill <= OGG_RING_LOW_WATER)
+		LWP_ThreadSignal(oggplayer_queue);
 }
 
 static void * ogg_player_thread(private_data_ogg * priv)
 {
 	int first_time = 1;
 	long ret;
+	u32 level;
+	short * slot;
 
 	//init
 	LWP_InitQueue(&oggplayer_queue);
@@ -318,103 +556,101 @@ static void * ogg_player_thread(private_data_ogg * priv)
 	ASND_Pause(0);
 
 	priv[0].pcm_indx = 0;
-	priv[0].pcmout_pos = 0;
+	priv[0].head = 0;
+	priv[0].tail = 0;
 	priv[0].eof = 0;
-	priv[0].flag = 0;
 	priv[0].current_section = 0;
 
 	ogg_thread_running = 1;
 
-	while (!priv[0].eof && ogg_thread_running)
+	while (ogg_thread_running)
 	{
-		if (priv[0].flag)
-			LWP_ThreadSleep(oggplayer_queue); // wait only when i have samples to send
-
-		if (priv[0].flag == 0) // wait to all samples are sent
+		// refill up to the high-water mark
+		while (!priv[0].eof && ogg_thread_running
+				&& (int) (priv[0].head - priv[0].tail) < OGG_RING_HIGH_WATER)
 		{
-			if (ASND_TestPointer(0, priv[0].pcmout[priv[0].pcmout_pos])
-					&& ASND_StatusVoice(0) != SND_UNUSED)
+			slot = priv[0].pcmout[priv[0].head & SLOT_MASK];
+
+			if (priv[0].seek_time >= 0)
 			{
-				priv[0].flag |= 64;
-				continue;
+				ov_time_seek(&priv[0].vf, priv[0].seek_time);
+				priv[0].seek_time = -1;
 			}
-			if (priv[0].pcm_indx < READ_SAMPLES)
-			{
-				priv[0].flag = 3;
 
-				if (priv[0].seek_time >= 0)
-				{
-					ov_time_seek(&priv[0].vf, priv[0].seek_time);
-					priv[0].seek_time = -1;
-				}
+			ret = ov_read(&priv[0].vf, (void *) &slot[priv[0].pcm_indx],
+					(OGG_SLOT_SAMPLES - priv[0].pcm_indx) << 1,
+					&priv[0].current_section);
 
-				ret
-						= ov_read(
-								&priv[0].vf,
-								(void *) &priv[0].pcmout[priv[0].pcmout_pos][priv[0].pcm_indx],
-								MAX_PCMOUT,/*0,2,1,*/&priv[0].current_section);
-				priv[0].flag &= 192;
-				if (ret == 0)
+			if (ret == 0)
+			{
+				/* EOF */
+				if (priv[0].mode & 1)
+					ov_time_seek(&priv[0].vf, 0); // repeat
+				else
+					priv[0].eof = 1; // stops
+			}
+			else if (ret < 0)
+			{
+				/* error in the stream.  Not a problem, just reporting it in
+				 case we (the app) cares.  In this case, we don't. */
+				if (ret != OV_HOLE)
 				{
-					/* EOF */
 					if (priv[0].mode & 1)
 						ov_time_seek(&priv[0].vf, 0); // repeat
 					else
 						priv[0].eof = 1; // stops
 				}
-				else if (ret < 0)
-				{
-					/* error in the stream.  Not a problem, just reporting it in
-					 case we (the app) cares.  In this case, we don't. */
-					if (ret != OV_HOLE)
-					{
-						if (priv[0].mode & 1)
-							ov_time_seek(&priv[0].vf, 0); // repeat
-						else
-							priv[0].eof = 1; // stops
-					}
-				}
-				else
-				{
-					/* we don't bother dealing with sample rate changes, etc, but
-					 you'll have to*/
-					priv[0].pcm_indx += ret >> 1; //get 16 bits samples
-				}
 			}
 			else
-				priv[0].flag = 1;
-		}
+			{
+				/* we don't bother dealing with sample rate changes, etc, but
+				 you'll have to*/
+				priv[0].pcm_indx += ret >> 1; //get 16 bits samples
+			}
 
-		if (priv[0].flag == 1)
-		{
-			if (ASND_StatusVoice(0) == SND_UNUSED || first_time)
+			// a slot is handed over once it is full, or at the end of the file
+			if (priv[0].pcm_indx >= OGG_SLOT_SAMPLES
+					|| (priv[0].eof && priv[0].pcm_indx > 0))
 			{
-				first_time = 0;
-				if (priv[0].vi->channels == 2)
-				{
-					ASND_SetVoice(0, VOICE_STEREO_16BIT, priv[0].vi->rate, 0,
-							(void *) priv[0].pcmout[priv[0].pcmout_pos],
-							priv[0].pcm_indx << 1, priv[0].volume,
-							priv[0].volume, ogg_add_callback);
-					priv[0].pcmout_pos ^= 1;
-					priv[0].pcm_indx = 0;
-					priv[0].flag = 0;
-				}
-				else
-				{
-					ASND_SetVoice(0, VOICE_MONO_16BIT, priv[0].vi->rate, 0,
-							(void *) priv[0].pcmout[priv[0].pcmout_pos],
-							priv[0].pcm_indx << 1, priv[0].volume,
-							priv[0].volume, ogg_add_callback);
-					priv[0].pcmout_pos ^= 1;
-					priv[0].pcm_indx = 0;
-					priv[0].flag = 0;
-				}
+				priv[0].pcmout_len[priv[0].head & SLOT_MASK] = priv[0].pcm_indx;
+				priv[0].pcm_indx = 0;
+				RING_BARRIER();
+				priv[0].head++;
 			}
 		}
-		usleep(100);
+
+		// (re)start the voice; it only stops on its own when it runs dry
+		if (!(priv[0].flag & 128) && priv[0].head != priv[0].tail
+				&& ASND_StatusVoice(0) == SND_UNUSED)
+		{
+			if (!first_time && !(priv[0].flag & 64))
+				priv[0].underruns++;
+
+			first_time = 0;
+			priv[0].flag &= ~64;
+			slot = priv[0].pcmout[priv[0].tail & SLOT_MASK];
+			ret = priv[0].pcmout_len[priv[0].tail & SLOT_MASK];
+			priv[0].tail++; // before the callback can run
+
+			ASND_SetVoice(0, priv[0].vi->channels == 2 ? VOICE_STEREO_16BIT
+					: VOICE_MONO_16BIT, priv[0].vi->rate, 0, (void *) slot,
+					ret << 1, priv[0].volume, priv[0].volume, ogg_add_callback);
+		}
+
+		if (priv[0].eof)
+			break; // what is left in the ring still plays
+
+		// sleep until the ring drains to the low-water mark; with interrupts
+		// off, the callback can't signal between the test and the sleep
+		level = IRQ_Disable();
+		if (ogg_thread_running && ((priv[0].flag & 128)
+				|| (int) (priv[0].head - priv[0].tail) >= OGG_RING_HIGH_WATER))
+			LWP_ThreadSleep(oggplayer_queue);
+		IRQ_Restore(level);
 	}
 	ov_clear(&priv[0].vf);
+	MemTrack_AddExternal(MEM_TAG_MUSIC, -ogg_heap_bytes);
+	ogg_heap_bytes = 0;
 	priv[0].fd = -1;
 	priv[0].pcm_indx = 0;
 
@@ -440,27 +676,26 @@ void StopOgg()
 	}
 }
 
-int PlayOgg(char * buf, int buflen, int time_pos, int mode)
+static int ogg_start(int time_pos, int mode)
 {
-	StopOgg();
+	u32 heap_used;
 
-	private_ogg.fd = mem_open(buf, buflen);
-	
-	if (private_ogg.fd < 0)
-	{
-		private_ogg.fd = -1;
-		return -1;
-	}
-	
 	private_ogg.mode = mode;
 	private_ogg.eof = 0;
 	private_ogg.volume = 127;
 	private_ogg.flag = 0;
 	private_ogg.seek_time = -1;
+	private_ogg.min_fill = OGG_RING_HIGH_WATER;
+	private_ogg.starving = 0;
+	private_ogg.starved = 0;
+	private_ogg.underruns = 0;
 
 	if (time_pos > 0)
 		private_ogg.seek_time = time_pos;
 
+	// Tremor allocates its decoder state with malloc; book what it took
+	heap_used = MemTrack_HeapUsed();
+
 	if (ov_open_callbacks((void *) &private_ogg.fd, &private_ogg.vf, NULL, 0, callbacks) < 0)
 	{
 		mem_close(private_ogg.fd); // mem_close() can too close files from devices
@@ -469,17 +704,52 @@ int PlayOgg(char * buf, int buflen, int time_pos, int mode)
 		return -1;
 	}
 
+	ogg_heap_bytes = MemTrack_HeapUsed() - heap_used;
+	MemTrack_AddExternal(MEM_TAG_MUSIC, ogg_heap_bytes);
+
 	if (LWP_CreateThread(&h_oggplayer, (void *) ogg_player_thread,
 			&private_ogg, oggplayer_stack, STACKSIZE, 80) == -1)
 	{
 		ogg_thread_running = 0;
 		ov_clear(&private_ogg.vf);
+		MemTrack_AddExternal(MEM_TAG_MUSIC, -ogg_heap_bytes);
+		ogg_heap_bytes = 0;
 		private_ogg.fd = -1;
 		return -1;
 	}
 	return 0;
 }
 
+int PlayOgg(char * buf, int buflen, int time_pos, int mode)
+{
+	StopOgg();
+
+	private_ogg.fd = mem_open(buf, buflen);
+	
+	if (private_ogg.fd < 0)
+	{
+		private_ogg.fd = -1;
+		return -1;
+	}
+
+	return ogg_start(time_pos, mode);
+}
+
+int PlayOggFile(const char * path, int time_pos, int mode)
+{
+	StopOgg();
+
+	private_ogg.fd = stream_open(path);
+
+	if (private_ogg.fd < 0)
+	{
+		private_ogg.fd = -1;
+		return -1;
+	}
+
+	return ogg_start(time_pos, mode);
+}
+
 void PauseOgg(int pause)
 {
 	if (pause)
@@ -536,4 +806,13 @@ void SetTimeOgg(s32 time_pos)
 		private_ogg.seek_time = time_pos;
 }
 
+void GetStatsOgg(OggStats * stats)
+{
+	stats->slots = OGG_RING_SLOTS;
+	stats->fill = ogg_thread_running ? (int) (private_ogg.head - private_ogg.tail) : 0;
+	stats->min_fill = private_ogg.min_fill;
+	stats->starved = private_ogg.starved;
+	stats->underruns = private_ogg.underruns;
+}
+
 #endif
@@ -46,6 +46,45 @@ extern "C"
 #define OGG_STATUS_PAUSED    2
 #define OGG_STATUS_EOF     255
 
+/* Decoded samples reach ASND through a ring of OGG_RING_SLOTS buffers (a power
+ of 2) of OGG_SLOT_SAMPLES 16 bit samples each. Two slots are always queued in
+ ASND; the player thread sleeps until no more than OGG_RING_LOW_WATER decoded
+ slots are left, then decodes up to OGG_RING_HIGH_WATER in one go. */
+
+#ifndef OGG_RING_SLOTS
+#define OGG_RING_SLOTS       8
+#endif
+
+#ifndef OGG_SLOT_SAMPLES
+#define OGG_SLOT_SAMPLES  2048
+#endif
+
+#define OGG_RING_HIGH_WATER (OGG_RING_SLOTS - 2)
+
+#ifndef OGG_RING_LOW_WATER
+#define OGG_RING_LOW_WATER  (OGG_RING_HIGH_WATER / 2)
+#endif
+
+/* PlayOggFile() reads the file OGG_READ_CHUNK bytes at a time on its own
+ thread, keeping up to OGG_READAHEAD_SIZE bytes ahead of the decoder. */
+
+#ifndef OGG_READAHEAD_SIZE
+#define OGG_READAHEAD_SIZE 65536
+#endif
+
+#ifndef OGG_READ_CHUNK
+#define OGG_READ_CHUNK     16384
+#endif
+
+typedef struct
+{
+	int slots;     // OGG_RING_SLOTS
+	int fill;      // decoded slots waiting for ASND
+	int min_fill;  // lowest fill since PlayOgg()
+	u32 starved;   // times ASND wanted a slot and the ring was empty
+	u32 underruns; // times the voice ran dry and had to be restarted
+} OggStats;
+
 /*------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Player OGG functions                                                                                                                                 */
 /*------------------------------------------------------------------------------------------------------------------------------------------------------*/
@@ -72,6 +111,28 @@ int PlayOgg(char * buf, int buflen, int time_pos, int mode);
 
 /*------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
+/* int PlayOggFile(const char * path, int time_pos, int mode);
+
+ Play an Ogg file from a device (e.g. "sd:/music.ogg"), streaming it instead of loading it.
+
+ NOTE: Only OGG_READAHEAD_SIZE bytes of the file are in memory at a time. The file is closed when the Ogg stops.
+
+ -- Params ---
+
+ path: the file to play
+
+ time_pos: initial time position in the file (in milliseconds)
+
+ mode: Use OGG_ONE_TIME or OGG_INFINITE_TIME
+
+ return: 0- Ok, -1 Error (the file can't be opened or isn't an Ogg)
+
+ */
+
+int PlayOggFile(const char * path, int time_pos, int mode);
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
 /* void StopOgg();
 
  Stop an Ogg file.
@@ -165,6 +226,20 @@ void SetTimeOgg(s32 time_pos);
 
 /*------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
+/* void GetStatsOgg(OggStats * stats);
+
+ Get the state of the decode ring, for the debug overlay
+
+ -- Params ---
+
+ stats: filled in with the ring statistics of the current (or last) Ogg
+
+ */
+
+void GetStatsOgg(OggStats * stats);
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
 #ifdef __cplusplus
 }
 #endif
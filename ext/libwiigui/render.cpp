@@ -0,0 +1,163 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * render.cpp
+ * Thin render command layer over GX
+ ***************************************************************************/
+
+#include <gccore.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "render.h"
+
+RenderStats renderStats; // counters of the frame in progress
+static RenderStats lastStats; // counters of the last completed frame
+static RenderStats peakStats; // highest per-frame value of every counter
+
+RenderCmd * renderCapture = NULL;
+int renderCaptureCount = 0;
+
+#if RENDER_STATS
+// position + color bytes per vertex for every vertex format
+// (GX_VTXFMT0 is used by the menu and game, GX_VTXFMT1 by FreeTypeGX)
+u8 renderVtxSize[8] = { 16, 8, 16, 16, 16, 16, 16, 16 };
+bool renderTexCoords = false;
+#endif
+
+enum
+{
+	CAPTURE_IDLE,
+	CAPTURE_REQUESTED,
+	CAPTURE_RECORDING,
+	CAPTURE_DONE
+};
+
+static int captureState = CAPTURE_IDLE;
+static RenderStats captureStats;
+#if RENDER_CAPTURE
+static RenderCmd captureBuffer[RENDER_CAPTURE_SIZE];
+#endif
+
+/****************************************************************************
+ * Render_EndFrame
+ *
+ * Called once the commands of a frame have been submitted. Publishes the
+ * frame's counters and advances a pending frame capture.
+ ***************************************************************************/
+void Render_EndFrame()
+{
+	lastStats = renderStats;
+
+	if(renderStats.drawCalls > peakStats.drawCalls) peakStats.drawCalls = renderStats.drawCalls;
+	if(renderStats.vertices > peakStats.vertices) peakStats.vertices = renderStats.vertices;
+	if(renderStats.stateChanges > peakStats.stateChanges) peakStats.stateChanges = renderStats.stateChanges;
+	if(renderStats.textureLoads > peakStats.textureLoads) peakStats.textureLoads = renderStats.textureLoads;
+	if(renderStats.invalidates > peakStats.invalidates) peakStats.invalidates = renderStats.invalidates;
+	if(renderStats.matrixLoads > peakStats.matrixLoads) peakStats.matrixLoads = renderStats.matrixLoads;
+	if(renderStats.dispLists > peakStats.dispLists) peakStats.dispLists = renderStats.dispLists;
+	if(renderStats.bytes > peakStats.bytes) peakStats.bytes = renderStats.bytes;
+
+	memset(&renderStats, 0, sizeof(RenderStats));
+
+#if RENDER_CAPTURE
+	if(captureState == CAPTURE_REQUESTED)
+	{
+		// start recording at a frame boundary
+		renderCaptureCount = 0;
+		renderCapture = captureBuffer;
+		captureState = CAPTURE_RECORDING;
+	}
+	else if(captureState == CAPTURE_RECORDING)
+	{
+		renderCapture = NULL;
+		captureStats = lastStats;
+		captureState = CAPTURE_DONE;
+	}
+#endif
+}
+
+/****************************************************************************
+ * Render_GetStats
+ *
+ * Returns the counters of the last completed frame
+ ***************************************************************************/
+const RenderStats * Render_GetStats()
+{
+	return &lastStats;
+}
+
+/****************************************************************************
+ * Render_GetPeakStats
+ *
+ * Returns the highest per-frame value of every counter since the last reset
+ ***************************************************************************/
+const RenderStats * Render_GetPeakStats()
+{
+	return &peakStats;
+}
+
+void Render_ResetStats()
+{
+	memset(&peakStats, 0, sizeof(RenderStats));
+}
+
+/****************************************************************************
+ * Render_CaptureFrame
+ *
+ * Records the commands of the next complete frame. Returns false if command
+ * capture is not compiled in.
+ ***************************************************************************/
+bool Render_CaptureFrame()
+{
+#if RENDER_CAPTURE
+	if(captureState == CAPTURE_RECORDING)
+		return true;
+
+	captureState = CAPTURE_REQUESTED;
+	return true;
+#else
+	return false;
+#endif
+}
+
+/****************************************************************************
+ * Render_DumpCapture
+ *
+ * Writes the last captured frame as text, one command per line, and
+ * forgets it. Returns false if no capture has completed since.
+ ***************************************************************************/
+bool Render_DumpCapture(const char * path)
+{
+	static const char * names[] = { "Begin", "LoadTexObj", "InvalidateTexAll",
+		"SetTevOp", "SetVtxDesc", "LoadPosMtx", "LoadProjectionMtx",
+		"SetViewport", "SetZMode", "CallDispList" };
+
+	if(captureState != CAPTURE_DONE)
+		return false;
+
+	FILE * file = fopen(path, "w");
+
+	if(!file)
+		return false;
+
+	fprintf(file, "# draws %u, vertices %u, state %u, textures %u, invalidates %u, matrices %u, lists %u, bytes %u\n",
+		captureStats.drawCalls, captureStats.vertices, captureStats.stateChanges,
+		captureStats.textureLoads, captureStats.invalidates, captureStats.matrixLoads,
+		captureStats.dispLists, captureStats.bytes);
+
+#if RENDER_CAPTURE
+	for(int i=0; i < renderCaptureCount; i++)
+	{
+		RenderCmd &cmd = captureBuffer[i];
+		fprintf(file, "%s %u %u %u\n", names[cmd.type], cmd.arg0, cmd.arg1, cmd.arg2);
+	}
+#else
+	(void)names;
+#endif
+
+	fclose(file);
+	captureState = CAPTURE_IDLE;
+	return true;
+}
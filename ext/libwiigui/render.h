@@ -0,0 +1,209 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * render.h
+ * Thin render command layer over GX
+ *
+ * All draw paths issue their GX state and primitive commands through the
+ * Render_* functions below. They forward straight to GX; when RENDER_STATS
+ * is enabled they also count what every frame sends to the GPU, and when
+ * RENDER_CAPTURE is enabled they record the commands of a single frame so
+ * it can be dumped and compared.
+ *
+ * Built for the host (without GEKKO) counting and recording are on by
+ * default, and GX comes from the no-op stand-in in tools/renderreplay, so
+ * a captured frame can be replayed on Linux and its counters checked.
+ ***************************************************************************/
+
+#ifndef _RENDER_H_
+#define _RENDER_H_
+
+#include <gccore.h>
+
+// what a recorded texture load refers to
+#ifdef GEKKO
+#define RENDER_TEXID(obj) ((u32)GX_GetTexObjData(obj))
+#else
+#define RENDER_TEXID(obj) ((u32)(size_t)(obj))
+#endif
+
+// set to 1 to count render commands every frame
+#ifndef RENDER_STATS
+#ifdef GEKKO
+#define RENDER_STATS 0
+#else
+#define RENDER_STATS 1
+#endif
+#endif
+
+// set to 1 to allow capturing the command stream of a frame
+#ifndef RENDER_CAPTURE
+#ifdef GEKKO
+#define RENDER_CAPTURE 0
+#else
+#define RENDER_CAPTURE 1
+#endif
+#endif
+
+#define RENDER_CAPTURE_SIZE 8192 // max commands recorded per captured frame
+
+typedef struct _renderstats {
+	u32 drawCalls; // GX_Begin calls
+	u32 vertices; // vertices submitted
+	u32 stateChanges; // TEV, vertex descriptor, viewport and z mode changes
+	u32 textureLoads; // GX_LoadTexObj calls
+	u32 invalidates; // texture cache invalidations
+	u32 matrixLoads; // position and projection matrix loads
+	u32 dispLists; // cached display lists replayed
+	u32 bytes; // approximate bytes written to the FIFO
+} RenderStats;
+
+enum
+{
+	RENDER_CMD_BEGIN,
+	RENDER_CMD_LOADTEXOBJ,
+	RENDER_CMD_INVALIDATETEXALL,
+	RENDER_CMD_SETTEVOP,
+	RENDER_CMD_SETVTXDESC,
+	RENDER_CMD_LOADPOSMTX,
+	RENDER_CMD_LOADPROJECTIONMTX,
+	RENDER_CMD_SETVIEWPORT,
+	RENDER_CMD_SETZMODE,
+	RENDER_CMD_CALLDISPLIST
+};
+
+typedef struct _rendercmd {
+	u8 type; // RENDER_CMD_*
+	u8 arg0;
+	u16 arg1;
+	u32 arg2;
+} RenderCmd;
+
+extern RenderStats renderStats; // counters of the frame in progress
+extern RenderCmd * renderCapture; // command buffer while a capture is in progress
+extern int renderCaptureCount;
+
+void Render_EndFrame();
+const RenderStats * Render_GetStats();
+const RenderStats * Render_GetPeakStats();
+void Render_ResetStats();
+bool Render_CaptureFrame();
+bool Render_DumpCapture(const char * path);
+
+#if RENDER_STATS
+extern u8 renderVtxSize[8];
+extern bool renderTexCoords;
+#define RENDER_COUNT(field, n) (renderStats.field += (n))
+#else
+#define RENDER_COUNT(field, n)
+#endif
+
+#if RENDER_CAPTURE
+static inline void Render_Record(u8 type, u8 arg0, u16 arg1, u32 arg2)
+{
+	if(renderCapture && renderCaptureCount < RENDER_CAPTURE_SIZE)
+	{
+		RenderCmd &cmd = renderCapture[renderCaptureCount++];
+		cmd.type = type;
+		cmd.arg0 = arg0;
+		cmd.arg1 = arg1;
+		cmd.arg2 = arg2;
+	}
+}
+#define RENDER_RECORD(type, arg0, arg1, arg2) Render_Record(type, arg0, arg1, arg2)
+#else
+#define RENDER_RECORD(type, arg0, arg1, arg2)
+#endif
+
+static inline void Render_Begin(u8 primitive, u8 vtxfmt, u16 vtxcnt)
+{
+	RENDER_COUNT(drawCalls, 1);
+	RENDER_COUNT(vertices, vtxcnt);
+	RENDER_COUNT(bytes, 3 + vtxcnt * (renderVtxSize[vtxfmt & 7] + (renderTexCoords ? 8 : 0)));
+	RENDER_RECORD(RENDER_CMD_BEGIN, primitive, vtxcnt, vtxfmt);
+	GX_Begin(primitive, vtxfmt, vtxcnt);
+}
+
+static inline void Render_End()
+{
+	GX_End();
+}
+
+static inline void Render_LoadTexObj(GXTexObj *obj, u8 mapid)
+{
+	RENDER_COUNT(textureLoads, 1);
+	RENDER_COUNT(bytes, 40);
+	RENDER_RECORD(RENDER_CMD_LOADTEXOBJ, mapid, 0, RENDER_TEXID(obj));
+	GX_LoadTexObj(obj, mapid);
+}
+
+static inline void Render_InvalidateTexAll()
+{
+	RENDER_COUNT(invalidates, 1);
+	RENDER_COUNT(bytes, 10);
+	RENDER_RECORD(RENDER_CMD_INVALIDATETEXALL, 0, 0, 0);
+	GX_InvalidateTexAll();
+}
+
+static inline void Render_SetTevOp(u8 tevstage, u8 mode)
+{
+	RENDER_COUNT(stateChanges, 1);
+	RENDER_COUNT(bytes, 20);
+	RENDER_RECORD(RENDER_CMD_SETTEVOP, tevstage, mode, 0);
+	GX_SetTevOp(tevstage, mode);
+}
+
+static inline void Render_SetVtxDesc(u8 attr, u8 type)
+{
+#if RENDER_STATS
+	if(attr == GX_VA_TEX0)
+		renderTexCoords = (type != GX_NONE);
+#endif
+	RENDER_COUNT(stateChanges, 1);
+	RENDER_COUNT(bytes, 6);
+	RENDER_RECORD(RENDER_CMD_SETVTXDESC, attr, type, 0);
+	GX_SetVtxDesc(attr, type);
+}
+
+static inline void Render_LoadPosMtxImm(Mtx mt, u32 pnidx)
+{
+	RENDER_COUNT(matrixLoads, 1);
+	RENDER_COUNT(bytes, 53);
+	RENDER_RECORD(RENDER_CMD_LOADPOSMTX, 0, 0, pnidx);
+	GX_LoadPosMtxImm(mt, pnidx);
+}
+
+static inline void Render_LoadProjectionMtx(Mtx44 mt, u8 type)
+{
+	RENDER_COUNT(matrixLoads, 1);
+	RENDER_COUNT(bytes, 33);
+	RENDER_RECORD(RENDER_CMD_LOADPROJECTIONMTX, type, 0, 0);
+	GX_LoadProjectionMtx(mt, type);
+}
+
+static inline void Render_SetViewport(f32 xOrig, f32 yOrig, f32 wd, f32 ht, f32 nearZ, f32 farZ)
+{
+	RENDER_COUNT(stateChanges, 1);
+	RENDER_COUNT(bytes, 29);
+	RENDER_RECORD(RENDER_CMD_SETVIEWPORT, 0, (u16)wd, (u32)(s32)xOrig);
+	GX_SetViewport(xOrig, yOrig, wd, ht, nearZ, farZ);
+}
+
+static inline void Render_SetZMode(u8 enable, u8 func, u8 update_enable)
+{
+	RENDER_COUNT(stateChanges, 1);
+	RENDER_COUNT(bytes, 5);
+	RENDER_RECORD(RENDER_CMD_SETZMODE, enable, func, update_enable);
+	GX_SetZMode(enable, func, update_enable);
+}
+
+static inline void Render_CallDispList(void *list, u32 nbytes)
+{
+	RENDER_COUNT(dispLists, 1);
+	RENDER_COUNT(bytes, 10);
+	RENDER_RECORD(RENDER_CMD_CALLDISPLIST, 0, 0, nbytes);
+	GX_CallDispList(list, nbytes);
+}
+
+#endif
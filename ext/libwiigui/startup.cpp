@@ -0,0 +1,234 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * startup.cpp
+ * Timeline of startup phases and asset loads, measured from process entry
+ *
+ * Process entry is taken in a constructor that runs ahead of every other
+ * static initializer, so the time spent constructing globals shows up as
+ * the "main" phase. A phase runs from the end of the previous one to its
+ * Startup_Mark. Asset loads are timed on their own, from whichever thread
+ * runs them, so they overlap the phases. The timeline stops taking events
+ * at Startup_End.
+ ***************************************************************************/
+
+#include <gccore.h>
+#include <stdio.h>
+#include <string.h>
+#include <ogc/lwp_watchdog.h>
+
+#include "startup.h"
+
+struct StartupEvent
+{
+	const char * name;
+	u32 start; // since process entry
+	u32 end;
+	bool isLoad;
+};
+
+static u64 entryTicks = 0;
+static StartupEvent events[STARTUP_MAX_EVENTS];
+static int eventCount = 0;
+static u32 lastMark = 0; // end of the last phase
+static u32 endTime = 0; // 0 until Startup_End
+static u32 firstFrame = 0; // 0 until a frame is presented
+
+__attribute__((constructor(101)))
+static void Startup_Entry()
+{
+	entryTicks = gettime();
+}
+
+/****************************************************************************
+ * Startup_Now
+ *
+ * Microseconds since process entry
+ ***************************************************************************/
+u32 Startup_Now()
+{
+	return ticks_to_microsecs(diff_ticks(entryTicks, gettime()));
+}
+
+/****************************************************************************
+ * AddEvent
+ *
+ * Loads come from the job threads too, so the slot is taken with
+ * interrupts off. Once the timeline is closed only loads that began
+ * before the end are kept, so decodes still running in the background
+ * are counted.
+ ***************************************************************************/
+static void AddEvent(const char * name, u32 start, u32 end, bool isLoad)
+{
+	u32 level = IRQ_Disable();
+
+	if((endTime && start >= endTime) || eventCount == STARTUP_MAX_EVENTS)
+	{
+		IRQ_Restore(level);
+		return;
+	}
+
+	StartupEvent * e = &events[eventCount++];
+	e->name = name;
+	e->start = start;
+	e->end = end;
+	e->isLoad = isLoad;
+	IRQ_Restore(level);
+}
+
+/****************************************************************************
+ * Startup_Mark
+ *
+ * Ends the current phase, which is given the name; the name must outlive
+ * the timeline
+ ***************************************************************************/
+void Startup_Mark(const char * name)
+{
+	u32 now = Startup_Now();
+	AddEvent(name, lastMark, now, false);
+	lastMark = now;
+}
+
+/****************************************************************************
+ * Startup_Load
+ *
+ * Records an asset load that began at start (a Startup_Now time) and has
+ * just finished
+ ***************************************************************************/
+void Startup_Load(const char * name, u32 start)
+{
+	AddEvent(name, start, Startup_Now(), true);
+}
+
+/****************************************************************************
+ * Startup_End
+ *
+ * Closes the timeline; startup ends with the last phase marked
+ ***************************************************************************/
+void Startup_End()
+{
+	endTime = lastMark;
+}
+
+/****************************************************************************
+ * Startup_FramePresented
+ *
+ * Called by Menu_Render once a frame is flushed to the video interface.
+ * Only the first call does anything.
+ ***************************************************************************/
+void Startup_FramePresented()
+{
+	if(firstFrame)
+		return;
+
+	firstFrame = Startup_Now();
+}
+
+/****************************************************************************
+ * Startup_GetFirstFrame
+ *
+ * Microseconds from process entry to the first presented frame, or 0 if
+ * no frame has been presented yet
+ ***************************************************************************/
+u32 Startup_GetFirstFrame()
+{
+	return firstFrame;
+}
+
+/****************************************************************************
+ * Startup_GetEndTime
+ *
+ * Microseconds from process entry to Startup_End, or 0 if it hasn't been
+ * called yet
+ ***************************************************************************/
+u32 Startup_GetEndTime()
+{
+	return endTime;
+}
+
+/****************************************************************************
+ * Startup_GetBreakdown
+ *
+ * Fills in the phases in order, then the loads added up by name in the
+ * order they first happened; returns the number of lines
+ ***************************************************************************/
+int Startup_GetBreakdown(StartupLine * lines, int max)
+{
+	int count = 0;
+
+	for(int pass=0; pass < 2; pass++)
+	{
+		for(int i=0; i < eventCount; i++)
+		{
+			StartupEvent * e = &events[i];
+
+			if(e->isLoad != (pass == 1))
+				continue;
+
+			int j = count;
+
+			if(e->isLoad)
+				for(j=0; j < count; j++)
+					if(lines[j].count && strcmp(lines[j].name, e->name) == 0)
+						break;
+
+			if(j == count)
+			{
+				if(count == max)
+					return count;
+
+				lines[count].name = e->name;
+				lines[count].us = 0;
+				lines[count].count = 0;
+				count++;
+			}
+
+			lines[j].us += e->end - e->start;
+
+			if(e->isLoad)
+				lines[j].count++;
+		}
+	}
+	return count;
+}
+
+/****************************************************************************
+ * Startup_Dump
+ *
+ * Writes the timeline as text, one event per line in the order they
+ * ended: start and end in milliseconds since process entry, the kind
+ * (phase, load, frame or total) and the name. tools/startupcmp compares
+ * two dumps.
+ ***************************************************************************/
+bool Startup_Dump(const char * path)
+{
+	FILE * file = fopen(path, "w");
+
+	if(!file)
+		return false;
+
+	fprintf(file, "# start_ms end_ms kind name\n");
+
+	bool isFramePrinted = !firstFrame;
+
+	for(int i=0; i < eventCount; i++)
+	{
+		StartupEvent * e = &events[i];
+
+		if(!isFramePrinted && firstFrame <= e->end)
+		{
+			fprintf(file, "0.000 %u.%03u frame first frame\n", firstFrame / 1000, firstFrame % 1000);
+			isFramePrinted = true;
+		}
+		fprintf(file, "%u.%03u %u.%03u %s %s\n", e->start / 1000, e->start % 1000,
+			e->end / 1000, e->end % 1000, e->isLoad ? "load" : "phase", e->name);
+	}
+
+	if(!isFramePrinted)
+		fprintf(file, "0.000 %u.%03u frame first frame\n", firstFrame / 1000, firstFrame % 1000);
+	if(endTime)
+		fprintf(file, "0.000 %u.%03u total startup\n", endTime / 1000, endTime % 1000);
+	fclose(file);
+	return true;
+}
@@ -0,0 +1,35 @@
+/****************************************************************************
+ * TetriCycle additions to libwiigui
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * startup.h
+ * Timeline of startup phases and asset loads, measured from process entry
+ ***************************************************************************/
+
+#ifndef _STARTUP_H_
+#define _STARTUP_H_
+
+#include <gccore.h>
+
+#define STARTUP_MAX_EVENTS 128
+
+// One line of the breakdown: a phase, or every load of the same asset
+// name added up
+typedef struct
+{
+	const char * name;
+	u32 us; // time spent
+	int count; // loads added up; 0 for a phase
+} StartupLine;
+
+u32 Startup_Now();
+void Startup_Mark(const char * name);
+void Startup_Load(const char * name, u32 start);
+void Startup_End();
+void Startup_FramePresented();
+u32 Startup_GetFirstFrame();
+u32 Startup_GetEndTime();
+int Startup_GetBreakdown(StartupLine * lines, int max);
+bool Startup_Dump(const char * path);
+
+#endif
@@ -15,6 +15,10 @@
 #include <wiiuse/wpad.h>
 
 #include "input.h"
+#include "framedump.h"
+#include "framearena.h"
+#include "memtrack.h"
+#include "startup.h"
 #include "libwiigui/gui.h"
 
 #define DEFAULT_FIFO_SIZE 256 * 1024
@@ -27,6 +31,9 @@ Mtx44 orthographic;
 int screenheight;
 int screenwidth;
 u32 FrameTimer = 0;
+static bool texturesDirty = true; // texture memory changed since last invalidate
+static bool drawListActive = false; // GX is recording into a display list
+static u32 drawListEpoch = 0; // bumped whenever recorded display lists become stale
 
 /**
  * Reset the modelview and projection matrices for the menu.
@@ -104,6 +111,9 @@ void ResetVideo_Menu()
 
    // Reset the modelview and projection matrices.
    ResetModelviewProjection_Menu();
+
+	// recorded lists may depend on the state replaced above
+	Menu_InvalidateDrawLists();
 }
 
 /****************************************************************************
@@ -181,16 +191,137 @@ void StopGX()
 void Menu_Render()
 {
 	whichfb ^= 1; // flip framebuffer
-	GX_SetZMode(GX_TRUE, GX_LEQUAL, GX_TRUE);
+	Render_SetZMode(GX_TRUE, GX_LEQUAL, GX_TRUE);
 	GX_SetColorUpdate(GX_TRUE);
 	GX_CopyDisp(g_xfb[whichfb],GX_TRUE);
 	GX_DrawDone();
+	Render_EndFrame();
+	FrameDump_Frame(g_xfb[whichfb]);
+	FrameArena_Reset();
+	MemTrack_EndFrame();
 	VIDEO_SetNextFramebuffer(g_xfb[whichfb]);
 	VIDEO_Flush();
+	Startup_FramePresented();
 	VIDEO_WaitVSync();
 	FrameTimer++;
 }
 
+/****************************************************************************
+ * Menu_InvalidateTextures
+ *
+ * Marks the texture cache as stale. Must be called whenever texture memory
+ * that may already be cached is written or reused.
+ ***************************************************************************/
+void Menu_InvalidateTextures()
+{
+	texturesDirty = true;
+}
+
+/****************************************************************************
+ * Menu_LoadTexObj
+ *
+ * Loads a texture object into TEXMAP0. The texture cache is only invalidated
+ * if texture memory has changed since the last invalidate.
+ ***************************************************************************/
+void Menu_LoadTexObj(GXTexObj *texObj)
+{
+	Render_LoadTexObj(texObj, GX_TEXMAP0);
+
+	if(texturesDirty)
+	{
+		Render_InvalidateTexAll();
+		texturesDirty = false;
+	}
+}
+
+/****************************************************************************
+ * SetDefaultDrawState
+ *
+ * Restates the vertex descriptor, TEV and matrix every menu draw returns to.
+ * GX only resends the vertex descriptor when it has changed, so this also
+ * forces it out with the next draw.
+ ***************************************************************************/
+static void SetDefaultDrawState()
+{
+	Render_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+	Render_SetVtxDesc(GX_VA_TEX0, GX_NONE);
+	Render_SetVtxDesc(GX_VA_POS, GX_DIRECT);
+	Render_SetVtxDesc(GX_VA_CLR0, GX_DIRECT);
+	Render_LoadPosMtxImm(GXmodelView2D, GX_PNMTX0);
+}
+
+/****************************************************************************
+ * Menu_BeginDrawList
+ *
+ * Redirects the following draws into a display list. The list starts from
+ * the default draw state, so it can be replayed after anything else.
+ * Display lists cannot be nested, so this fails while one is recording.
+ * The list must be 32 byte aligned and its size a multiple of 32.
+ ***************************************************************************/
+bool Menu_BeginDrawList(u8 * list, u32 size)
+{
+	if(drawListActive)
+		return false;
+
+	GX_BeginDispList(list, size);
+	drawListActive = true;
+	SetDefaultDrawState();
+	return true;
+}
+
+/****************************************************************************
+ * Menu_EndDrawList
+ *
+ * Stops recording. Returns the size of the list, or 0 if it overflowed, in
+ * which case nothing that was drawn since Menu_BeginDrawList reached GX.
+ ***************************************************************************/
+u32 Menu_EndDrawList()
+{
+	drawListActive = false;
+	return GX_EndDispList();
+}
+
+/****************************************************************************
+ * Menu_CallDrawList
+ *
+ * Replays a recorded display list
+ ***************************************************************************/
+void Menu_CallDrawList(u8 * list, u32 size)
+{
+	// textures referenced by the list may have been rewritten since
+	if(texturesDirty)
+	{
+		Render_InvalidateTexAll();
+		texturesDirty = false;
+	}
+
+	Render_CallDispList(list, size);
+
+	// GX doesn't know the list changed its state
+	SetDefaultDrawState();
+}
+
+bool Menu_IsRecordingDrawList()
+{
+	return drawListActive;
+}
+
+/****************************************************************************
+ * Menu_InvalidateDrawLists
+ *
+ * Makes every recorded display list stale, e.g. after the GX setup they
+ * were recorded with has changed
+ ***************************************************************************/
+void Menu_InvalidateDrawLists()
+{
+	drawListEpoch++;
+}
+
+u32 Menu_GetDrawListEpoch()
+{
+	return drawListEpoch;
+}
+
 /****************************************************************************
  * Menu_DrawImg
  *
@@ -203,14 +334,31 @@ void Menu_DrawImg(f32 xpos, f32 ypos, u16 width, u16 height, u8 data[],
 	if(data == NULL)
 		return;
 
+	// raw image data may have been modified since it was last drawn
 	GXTexObj texObj;
-
 	GX_InitTexObj(&texObj, data, width, height, GX_TF_RGBA8, GX_CLAMP, GX_CLAMP, GX_FALSE);
-	GX_LoadTexObj(&texObj, GX_TEXMAP0);
-	GX_InvalidateTexAll();
+	Menu_InvalidateTextures();
+
+	Menu_DrawTexObj(xpos, ypos, width, height, &texObj, degrees, scaleX, scaleY,
+		alpha, displayWidth, displayHeight);
+}
+
+/****************************************************************************
+ * Menu_DrawTexObj
+ *
+ * Draws the specified pre-initialized texture object on screen using GX
+ ***************************************************************************/
+void Menu_DrawTexObj(f32 xpos, f32 ypos, u16 width, u16 height, GXTexObj *texObj,
+	f32 degrees, f32 scaleX, f32 scaleY, u8 alpha,
+	u16 displayWidth, u16 displayHeight)
+{
+	if(texObj == NULL)
+		return;
+
+	Menu_LoadTexObj(texObj);
 
-	GX_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
-	GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
+	Render_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
+	Render_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
 
    if (displayWidth)
      width = displayWidth;
@@ -228,9 +376,9 @@ void Menu_DrawImg(f32 xpos, f32 ypos, u16 width, u16 height, u8 data[],
 
 	guMtxTransApply(m,m, xpos+width,ypos+height,0);
 	guMtxConcat (GXmodelView2D, m, mv);
-	GX_LoadPosMtxImm (mv, GX_PNMTX0);
+	Render_LoadPosMtxImm (mv, GX_PNMTX0);
 
-	GX_Begin(GX_QUADS, GX_VTXFMT0,4);
+	Render_Begin(GX_QUADS, GX_VTXFMT0,4);
 	GX_Position3f32(-width, -height,  0);
 	GX_Color4u8(0xFF,0xFF,0xFF,alpha);
 	GX_TexCoord2f32(0, 0);
@@ -246,11 +394,11 @@ void Menu_DrawImg(f32 xpos, f32 ypos, u16 width, u16 height, u8 data[],
 	GX_Position3f32(-width, height,  0);
 	GX_Color4u8(0xFF,0xFF,0xFF,alpha);
 	GX_TexCoord2f32(0, 1);
-	GX_End();
-	GX_LoadPosMtxImm (GXmodelView2D, GX_PNMTX0);
+	Render_End();
+	Render_LoadPosMtxImm (GXmodelView2D, GX_PNMTX0);
 
-	GX_SetTevOp (GX_TEVSTAGE0, GX_PASSCLR);
-	GX_SetVtxDesc (GX_VA_TEX0, GX_NONE);
+	Render_SetTevOp (GX_TEVSTAGE0, GX_PASSCLR);
+	Render_SetVtxDesc (GX_VA_TEX0, GX_NONE);
 }
 
 /****************************************************************************
@@ -278,11 +426,11 @@ void Menu_DrawRectangle(f32 x, f32 y, f32 width, f32 height, GXColor color, u8 f
 		n = 4;
 	}
 
-	GX_Begin(fmt, GX_VTXFMT0, n);
+	Render_Begin(fmt, GX_VTXFMT0, n);
 	for(i=0; i<n; i++)
 	{
 		GX_Position3f32(v[i].x, v[i].y,  v[i].z);
 		GX_Color4u8(color.r, color.g, color.b, color.a);
 	}
-	GX_End();
+	Render_End();
 }
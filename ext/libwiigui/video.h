@@ -15,8 +15,17 @@ void InitVideo ();
 void StopGX();
 void ResetVideo_Menu();
 void Menu_Render();
+void Menu_InvalidateTextures();
+void Menu_LoadTexObj(GXTexObj *texObj);
 void Menu_DrawImg(f32 xpos, f32 ypos, u16 width, u16 height, u8 data[], f32 degrees, f32 scaleX, f32 scaleY, u8 alpha, u16 displayWidth = 0, u16 displayHeight = 0);
+void Menu_DrawTexObj(f32 xpos, f32 ypos, u16 width, u16 height, GXTexObj *texObj, f32 degrees, f32 scaleX, f32 scaleY, u8 alpha, u16 displayWidth = 0, u16 displayHeight = 0);
 void Menu_DrawRectangle(f32 x, f32 y, f32 width, f32 height, GXColor color, u8 filled);
+bool Menu_BeginDrawList(u8 * list, u32 size);
+u32 Menu_EndDrawList();
+void Menu_CallDrawList(u8 * list, u32 size);
+bool Menu_IsRecordingDrawList();
+void Menu_InvalidateDrawLists();
+u32 Menu_GetDrawListEpoch();
 
 extern int screenheight;
 extern int screenwidth;
@@ -0,0 +1,215 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file adpcmenc.cpp
+ * @brief Host tool that encodes raw PCM sound effects as IMA ADPCM.
+ * @author TetriCycle contributors
+ *
+ * Usage: adpcmenc [-c channels] [-r rate] [-s min_snr] in.pcm out
+ *
+ * The input is the raw format the sound effects are kept in: signed 
+ * 16 bit, big endian, interleaved (stereo by default, at 44100 Hz). 
+ * Every sample is coded with whichever of the 16 codes lands closest to 
+ * it, so the output takes a quarter of the memory of the input.
+ *
+ * The output is then decoded again with the decoder the game runs 
+ * (ext/libwiigui/imaadpcm.h) and compared against the input; the SNR is 
+ * printed, and the tool fails if it is below min_snr (default 
+ * ADPCMENC_MIN_SNR dB), so neither a broken encoder or decoder nor a 
+ * sound that would audibly lose too much gets into the build.
+ * See mixer.cpp for the player. All values are big-endian.
+ *
+ * File layout:
+ * - header: "TADP", u16 version, u16 channels, u32 sample rate, 
+ *   u32 frames, zero padding up to ADPCM_HEADER bytes
+ * - the blocks, as described in imaadpcm.h; the last one is zero-padded
+ */
+
+#include <cstdio>    // for FILE, fprintf, printf
+#include <cstdlib>   // for atoi, atof
+#include <cstring>   // for strcmp, strrchr
+#include <cmath>     // for log10
+#include <vector>    // for vector
+
+#include "../ext/libwiigui/imaadpcm.h"
+
+using std::vector;
+
+#define ADPCMENC_MIN_SNR 35.0
+
+static void PutU16(vector<unsigned char> &out, unsigned int value)
+{
+  out.push_back((value >> 8) & 0xFF);
+  out.push_back(value & 0xFF);
+}
+
+static void PutU32(vector<unsigned char> &out, unsigned int value)
+{
+  PutU16(out, value >> 16);
+  PutU16(out, value & 0xFFFF);
+}
+
+/// Pick the code that lands closest to the sample, and apply it.
+static int EncodeSample(AdpcmState &state, int sample)
+{
+  int bestCode = 0;
+  int bestError = 0x7FFFFFFF;
+
+  for (int code = 0; code < 16; ++code)
+  {
+    AdpcmState trial = state;
+    int error = abs(AdpcmDecodeSample(&trial, code) - sample);
+    if (error < bestError)
+    {
+      bestError = error;
+      bestCode = code;
+    }
+  }
+
+  AdpcmDecodeSample(&state, bestCode);
+  return bestCode;
+}
+
+/// Encode one block; frames past the end of the input repeat silence.
+static void EncodeBlock(const vector<short> &pcm, size_t first, int channels, 
+                        AdpcmState state[2], vector<unsigned char> &out)
+{
+  for (int c = 0; c < channels; ++c)
+  {
+    PutU16(out, state[c].predictor & 0xFFFF);
+    out.push_back(state[c].index);
+    out.push_back(0);
+  }
+
+  int codes[2][ADPCM_BLOCK_FRAMES];
+  for (int i = 0; i < ADPCM_BLOCK_FRAMES; ++i)
+  {
+    for (int c = 0; c < channels; ++c)
+    {
+      size_t at = (first + i) * channels + c;
+      codes[c][i] = EncodeSample(state[c], at < pcm.size() ? pcm[at] : 0);
+    }
+  }
+
+  if (channels == 2)
+  {
+    for (int i = 0; i < ADPCM_BLOCK_FRAMES; ++i)
+      out.push_back((codes[0][i] << 4) | codes[1][i]);
+  }
+  else
+  {
+    for (int i = 0; i < ADPCM_BLOCK_FRAMES; i += 2)
+      out.push_back((codes[0][i] << 4) | codes[0][i + 1]);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int channels = 2;
+  int rate = 44100;
+  double minSnr = ADPCMENC_MIN_SNR;
+  int arg = 1;
+
+  for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+  {
+    if (strcmp(argv[arg], "-c") == 0)
+      channels = atoi(argv[arg + 1]);
+    else if (strcmp(argv[arg], "-r") == 0)
+      rate = atoi(argv[arg + 1]);
+    else if (strcmp(argv[arg], "-s") == 0)
+      minSnr = atof(argv[arg + 1]);
+    else
+      break;
+  }
+
+  if (argc - arg != 2 || channels < 1 || channels > 2)
+  {
+    fprintf(stderr, "usage: adpcmenc [-c channels] [-r rate] [-s min_snr] in.pcm out\n");
+    return 1;
+  }
+
+  FILE *f = fopen(argv[arg], "rb");
+  if (!f)
+  {
+    fprintf(stderr, "adpcmenc: can't load %s\n", argv[arg]);
+    return 1;
+  }
+
+  vector<short> pcm;
+  int hi, lo;
+  while ((hi = fgetc(f)) != EOF && (lo = fgetc(f)) != EOF)
+    pcm.push_back((short)((hi << 8) | lo));
+  fclose(f);
+
+  size_t frames = pcm.size() / channels;
+  pcm.resize(frames * channels);
+
+  vector<unsigned char> out;
+  out.insert(out.end(), "TADP", "TADP" + 4);
+  PutU16(out, ADPCM_VERSION);
+  PutU16(out, channels);
+  PutU32(out, rate);
+  PutU32(out, frames);
+  out.resize(ADPCM_HEADER, 0);
+
+  AdpcmState state[2] = {{0, 0}, {0, 0}};
+  for (size_t first = 0; first < frames; first += ADPCM_BLOCK_FRAMES)
+    EncodeBlock(pcm, first, channels, state, out);
+
+  // Decode it the way the game does and measure how close it came.
+  double signal = 0, noise = 0;
+  vector<short> decoded(ADPCM_BLOCK_FRAMES * channels);
+  for (size_t first = 0; first < frames; first += ADPCM_BLOCK_FRAMES)
+  {
+    const unsigned char *block = &out[ADPCM_HEADER] + 
+      first / ADPCM_BLOCK_FRAMES * ADPCM_BLOCK_BYTES(channels);
+    AdpcmDecodeBlock(block, channels, ADPCM_BLOCK_FRAMES, &decoded[0]);
+
+    for (size_t i = 0; i < decoded.size() && first * channels + i < pcm.size(); ++i)
+    {
+      double s = pcm[first * channels + i], d = decoded[i] - s;
+      signal += s * s;
+      noise += d * d;
+    }
+  }
+
+  double snr = noise > 0 ? 10 * log10(signal / noise) : INFINITY;
+  const char *name = strrchr(argv[arg], '/');
+  name = name ? name + 1 : argv[arg];
+
+  if (snr < minSnr)
+  {
+    fprintf(stderr, "adpcmenc: %s decodes at %.1f dB SNR, below %.1f dB\n", name, snr, minSnr);
+    return 1;
+  }
+
+  f = fopen(argv[arg + 1], "wb");
+  if (!f)
+  {
+    fprintf(stderr, "adpcmenc: can't create %s\n", argv[arg + 1]);
+    return 1;
+  }
+  fwrite(&out[0], 1, out.size(), f);
+  fclose(f);
+
+  printf("  %s: %u -> %u bytes, SNR %.1f dB\n", name, (unsigned)(pcm.size() * 2), 
+    (unsigned)out.size(), snr);
+  return 0;
+}
@@ -0,0 +1,313 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file assetpack.cpp
+ * @brief Host tool that packs assets into one archive with LZ4 entries.
+ * @author TetriCycle contributors
+ *
+ * Usage: assetpack out.pak file [file ...]
+ *
+ * Every file becomes an entry named after the file (without directories). 
+ * An entry is stored LZ4-compressed (block format) when that saves at 
+ * least ASSETPACK_MIN_SAVING of its size, and as-is otherwise, so it can 
+ * be used in place. Entry data starts on 32 byte boundaries so ASND and 
+ * GX can use stored entries directly. See assets.cpp for the loader. 
+ * All values are big-endian.
+ *
+ * File layout:
+ * - header: "TCPK", u16 version, u16 entry count, u32 data offset, 
+ *   zero padding up to ASSETPACK_HEADER bytes
+ * - per entry: char name[ASSETPACK_NAME] (NUL-padded), u32 offset, 
+ *   u32 packed size, u32 size, u32 flags
+ * - the entry data
+ */
+
+#include <cstdio>    // for FILE, fprintf, printf
+#include <cstring>   // for strrchr, strlen, strncpy
+#include <vector>    // for vector
+
+using std::vector;
+
+// These must match assets.h.
+#define ASSETPACK_VERSION 1
+#define ASSETPACK_HEADER 16
+#define ASSETPACK_NAME 32
+#define ASSETPACK_ALIGN 32
+#define ASSETPACK_LZ4 0x1
+#define ASSETPACK_MIN_SAVING 0.05
+
+// LZ4 block format limits
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5  // the block ends with at least this many literals
+#define LZ4_MATCH_LIMIT 12   // no match may start this close to the end
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_BITS 16
+#define LZ4_MAX_CHAIN 256    // match candidates tried per position
+
+typedef vector<unsigned char> Bytes;
+
+static bool ReadFile(const char *path, Bytes &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+
+  fseek(f, 0, SEEK_END);
+  data.resize(ftell(f));
+  fseek(f, 0, SEEK_SET);
+  bool isRead = data.empty() || fread(&data[0], 1, data.size(), f) == data.size();
+  fclose(f);
+  return isRead;
+}
+
+static void PutU16(Bytes &out, unsigned int value)
+{
+  out.push_back((value >> 8) & 0xFF);
+  out.push_back(value & 0xFF);
+}
+
+static void PutU32(Bytes &out, unsigned int value)
+{
+  PutU16(out, value >> 16);
+  PutU16(out, value & 0xFFFF);
+}
+
+static unsigned int Hash(const unsigned char *p)
+{
+  unsigned int v = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+  return (v * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+/// Write an LZ4 length continuation: runs of 255, then the remainder.
+static void PutLength(Bytes &out, size_t length)
+{
+  for (; length >= 255; length -= 255)
+    out.push_back(255);
+  out.push_back((unsigned char)length);
+}
+
+/// Emit one sequence: the literals, then a match (none for the last one).
+static void PutSequence(Bytes &out, const unsigned char *literals, size_t literalLength, 
+                        size_t offset, size_t matchLength)
+{
+  size_t matchCode = matchLength ? matchLength - LZ4_MIN_MATCH : 0;
+  unsigned char token = (literalLength < 15 ? literalLength : 15) << 4;
+  token |= matchCode < 15 ? matchCode : 15;
+  out.push_back(token);
+
+  if (literalLength >= 15)
+    PutLength(out, literalLength - 15);
+  out.insert(out.end(), literals, literals + literalLength);
+
+  if (!matchLength)
+    return;
+
+  out.push_back(offset & 0xFF);
+  out.push_back(offset >> 8);
+  if (matchCode >= 15)
+    PutLength(out, matchCode - 15);
+}
+
+/// Compress into one LZ4 block, searching hash chains for the longest match.
+static void CompressLZ4(const Bytes &src, Bytes &out)
+{
+  size_t size = src.size();
+  const unsigned char *data = size ? &src[0] : NULL;
+  vector<int> head(1 << LZ4_HASH_BITS, -1);
+  vector<int> chain(size, -1);
+  size_t anchor = 0;
+  size_t pos = 0;
+
+  out.clear();
+
+  if (size > LZ4_MATCH_LIMIT)
+  {
+    size_t matchLimit = size - LZ4_MATCH_LIMIT;
+    size_t endLimit = size - LZ4_LAST_LITERALS;
+
+    while (pos < matchLimit)
+    {
+      size_t bestLength = 0, bestOffset = 0;
+      unsigned int h = Hash(data + pos);
+
+      int tries = LZ4_MAX_CHAIN;
+      for (int cand = head[h]; cand >= 0 && tries--; cand = chain[cand])
+      {
+        if (pos - cand > LZ4_MAX_OFFSET)
+          break;
+
+        size_t length = 0;
+        while (pos + length < endLimit && data[cand + length] == data[pos + length])
+          ++length;
+
+        if (length > bestLength)
+        {
+          bestLength = length;
+          bestOffset = pos - cand;
+        }
+      }
+
+      chain[pos] = head[h];
+      head[h] = pos;
+
+      if (bestLength < LZ4_MIN_MATCH)
+      {
+        ++pos;
+        continue;
+      }
+
+      PutSequence(out, data + anchor, pos - anchor, bestOffset, bestLength);
+
+      // index the positions the match covers so later matches can find them
+      size_t end = pos + bestLength;
+      for (++pos; pos < end && pos < matchLimit; ++pos)
+      {
+        h = Hash(data + pos);
+        chain[pos] = head[h];
+        head[h] = pos;
+      }
+      pos = anchor = end;
+    }
+  }
+
+  PutSequence(out, data + anchor, size - anchor, 0, 0);
+}
+
+/// Decompress an LZ4 block; used to check every entry before it is written.
+static bool DecompressLZ4(const Bytes &src, Bytes &out, size_t size)
+{
+  size_t in = 0;
+  out.clear();
+
+  while (in < src.size())
+  {
+    unsigned char token = src[in++];
+    size_t length = token >> 4;
+    if (length == 15)
+      while (in < src.size() && (length += src[in], src[in++] == 255));
+
+    if (in + length > src.size())
+      return false;
+    out.insert(out.end(), &src[in], &src[in] + length);
+    in += length;
+
+    if (in == src.size())
+      break; // the last sequence has no match
+
+    if (in + 2 > src.size())
+      return false;
+    size_t offset = src[in] | (src[in + 1] << 8);
+    in += 2;
+    length = (token & 0xF) + LZ4_MIN_MATCH;
+    if ((token & 0xF) == 15)
+      while (in < src.size() && (length += src[in], src[in++] == 255));
+
+    if (!offset || offset > out.size())
+      return false;
+    for (size_t i = 0; i < length; ++i)
+      out.push_back(out[out.size() - offset]);
+  }
+  return out.size() == size;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 3)
+  {
+    fprintf(stderr, "usage: assetpack out.pak file [file ...]\n");
+    return 1;
+  }
+
+  int count = argc - 2;
+  size_t dataOffset = ASSETPACK_HEADER + count * (ASSETPACK_NAME + 16);
+  dataOffset = (dataOffset + ASSETPACK_ALIGN - 1) / ASSETPACK_ALIGN * ASSETPACK_ALIGN;
+
+  Bytes header, index, data;
+  header.insert(header.end(), "TCPK", "TCPK" + 4);
+  PutU16(header, ASSETPACK_VERSION);
+  PutU16(header, count);
+  PutU32(header, dataOffset);
+  header.resize(ASSETPACK_HEADER, 0);
+
+  for (int i = 0; i < count; ++i)
+  {
+    const char *path = argv[i + 2];
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+
+    if (strlen(name) >= ASSETPACK_NAME)
+    {
+      fprintf(stderr, "assetpack: name too long: %s\n", name);
+      return 1;
+    }
+
+    Bytes file, packed, check;
+    if (!ReadFile(path, file))
+    {
+      fprintf(stderr, "assetpack: can't load %s\n", path);
+      return 1;
+    }
+
+    CompressLZ4(file, packed);
+    unsigned int flags = 0;
+
+    if (packed.size() <= file.size() * (1 - ASSETPACK_MIN_SAVING))
+    {
+      if (!DecompressLZ4(packed, check, file.size()) || check != file)
+      {
+        fprintf(stderr, "assetpack: LZ4 round trip failed for %s\n", name);
+        return 1;
+      }
+      flags |= ASSETPACK_LZ4;
+    }
+    else
+      packed = file;
+
+    data.resize((data.size() + ASSETPACK_ALIGN - 1) / ASSETPACK_ALIGN * ASSETPACK_ALIGN, 0);
+
+    char paddedName[ASSETPACK_NAME] = {0};
+    strncpy(paddedName, name, ASSETPACK_NAME - 1);
+    index.insert(index.end(), paddedName, paddedName + ASSETPACK_NAME);
+    PutU32(index, dataOffset + data.size());
+    PutU32(index, packed.size());
+    PutU32(index, file.size());
+    PutU32(index, flags);
+    data.insert(data.end(), packed.begin(), packed.end());
+
+    printf("  %s: %u -> %u bytes%s\n", name, (unsigned)file.size(), 
+      (unsigned)packed.size(), (flags & ASSETPACK_LZ4) ? " (LZ4)" : " (stored)");
+  }
+
+  index.resize(dataOffset - header.size(), 0);
+
+  FILE *f = fopen(argv[1], "wb");
+  if (!f)
+  {
+    fprintf(stderr, "assetpack: can't create %s\n", argv[1]);
+    return 1;
+  }
+
+  fwrite(&header[0], 1, header.size(), f);
+  fwrite(&index[0], 1, index.size(), f);
+  if (!data.empty())
+    fwrite(&data[0], 1, data.size(), f);
+  fclose(f);
+  return 0;
+}
@@ -0,0 +1,486 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file cubebench.cpp
+ * @brief Host benchmark of GX_CubeBatch against drawing cubes one by one.
+ * @author TetriCycle contributors
+ *
+ * Usage: cubebench [seconds]
+ *
+ * Builds the real cube code (code/source/cube.cpp) and render layer 
+ * against the stand-ins in tools/cubebench, and draws the playfields and 
+ * bases of 1 to 4 players at playfield widths 10 to 30, with the bottom 
+ * half of every playfield filled, two ways:
+ *   - per block, as DrawPlayfield and DrawBase did with DrawBlockAsCube: 
+ *     the block's matrix is built from the center out, loaded, and GX_Cube 
+ *     draws it;
+ *   - batched, as they do now: the column matrices are built once, offset 
+ *     per row, and GX_CubeBatch draws every cube of a player.
+ * The matrix code of both is copied from code/source/Player.cpp.
+ *
+ * First every vertex of both is transformed by its position matrix and 
+ * compared: the batch must put the same corners with the same colors in 
+ * the same order. Then each is timed for about the given time (default 
+ * 0.2 s), alternating between the two and taking the fastest of many 
+ * batches, and the CPU time per frame and the render counters of one 
+ * frame are printed. The exit status is 1 if the vertices differ.
+ *
+ * The times are of the host CPU, not of the Wii; the counters (draw calls, 
+ * matrix loads, FIFO bytes) are the same on both.
+ *
+ * Build: g++ -O2 -Itools/cubebench -Icode/include -Icode/include/defines 
+ *   -Iext/libwiigui tools/cubebench.cpp code/source/cube.cpp 
+ *   ext/libwiigui/render.cpp -o cubebench
+ */
+
+#include <cmath>   // for fabsf
+#include <cstdio>  // for printf
+#include <cstdlib> // for strtod
+#include <ctime>   // for clock
+#include <vector>  // for vector
+
+#include "cube.h"
+#include "Color.h"
+#include "defines_Player.h"
+#include "render.h"
+
+using std::vector;
+
+volatile u32 gxPipe;
+Mtx gxPosMtx;
+vector<GXTraceVertex> *gxTrace = NULL;
+
+ColorGradient g_cubeGradients[COLOR_ID_MAX];
+
+static Mtx view; // guLookAt from the origin down -z, as in main.cpp
+
+static const int HEIGHT = DEFAULT_PLAYFIELD_HEIGHT;
+
+/// What the benchmark needs of a Player.
+struct BenchPlayer
+{
+  int id;
+  int players;
+  int playfieldWidth;
+  int playfieldHeight;
+  float cubeAngle;
+  int cycleIdx;
+  ColorId playfield[MAX_PLAYFIELD_WIDTH][MAX_PLAYFIELD_HEIGHT]; ///< COLOR_ID_MAX if empty
+
+  float _GetBlockScale() { return 1.0f; } // default scale, not classic mode
+  void _SetViewport();
+  void _SetBaseColor(int x);
+  void _GetBlockMatrix(float x, float y, Mtx modelview);
+  void _GetColumnMatrices(Mtx columnMtx[], guVector &rowStep);
+  void _GetRowMatrix(Mtx columnMtx, guVector &rowStep, float rowOffset, Mtx modelview);
+  float _GetRowOffset(int y);
+
+  void DrawBlockAsCube(float x, float y, ColorId colorIdx);
+  void DrawPerBlock();
+  void DrawBatched();
+};
+
+// The viewport offsets of Player::_SetViewport.
+void BenchPlayer::_SetViewport()
+{
+  static const float vx[4][4] =
+  {
+    {0}, {-106.6f, 213.4f}, {-210, 0, 210}, {-240, -80, 80, 240}
+  };
+  Render_SetViewport(vx[players - 1][id], 0, 640, 480, 0, 1);
+}
+
+void BenchPlayer::_SetBaseColor(int x)
+{
+  u8 c = ((x + cycleIdx) % playfieldWidth) * 8; // black to white
+  GXColor color = {c, c, c, 255};
+  g_cubeGradients[COLOR_ID_BASE].SetColor(color);
+}
+
+// Player::_GetBlockMatrix without the guide dot.
+void BenchPlayer::_GetBlockMatrix(float x, float y, Mtx modelview)
+{
+  float scale = _GetBlockScale();
+
+  int centerRight = playfieldWidth >> 1;
+  int centerLeft  = centerRight - 1;
+  int offsetFromCenter = (x > centerLeft) ? x - centerLeft : x - centerRight;
+
+  y = ((playfieldHeight >> 1) - 1 - y) * scale;
+
+  float hz = scale / 2;
+
+  static Mtx mscale;
+  guMtxIdentity(mscale);
+  guMtxScale(mscale, scale, scale, scale);
+
+  float cubeRotation = cubeAngle;
+
+  if (offsetFromCenter < 0)
+  {
+    scale *= -1;
+    cubeRotation *= -1;
+    offsetFromCenter *= -1;
+  }
+
+  static Mtx mtrans;
+  guMtxIdentity(mtrans);
+  guMtxTransApply(mtrans, mtrans, scale, 0.f, 0.f);
+
+  static guVector cubeAxis = {0, 1, 0};
+  static Mtx mrot;
+  guMtxIdentity(mrot);
+  guMtxRotAxisDeg(mrot, &cubeAxis, cubeRotation);
+
+  static Mtx mrottrans;
+  guMtxIdentity(mrottrans);
+  guMtxConcat(mrot, mtrans, mrottrans);
+
+  static Mtx model;
+  guMtxIdentity(model);
+
+  for (int i = 0; i < offsetFromCenter - 1; ++i)
+    guMtxConcat(model, mrottrans, model);
+
+  guMtxConcat(model, mrot, model);
+
+  static Mtx halfcubetrans;
+  guMtxIdentity(halfcubetrans);
+  guMtxTransApply(halfcubetrans, halfcubetrans, scale / 2, 0.f, -hz);
+
+  guMtxConcat(model, halfcubetrans, model);
+  guMtxConcat(model, mscale, model);
+
+  static Mtx trans;
+  guMtxIdentity(trans);
+  guMtxTransApply(trans, trans, 0, y, -32);
+
+  guMtxConcat(trans, model, model);
+  guMtxConcat(view, model, modelview);
+}
+
+// Player::_GetColumnMatrices.
+void BenchPlayer::_GetColumnMatrices(Mtx columnMtx[], guVector &rowStep)
+{
+  float scale = _GetBlockScale();
+  float cubeRotation = cubeAngle;
+  float hz = scale / 2;
+
+  static guVector cubeAxis = {0, 1, 0};
+
+  Mtx mscale;
+  guMtxScale(mscale, scale, scale, scale);
+
+  Mtx trans;
+  Mtx viewtrans;
+  guMtxTrans(trans, 0, 0, -32);
+  guMtxConcat(view, trans, viewtrans);
+
+  int centerRight = playfieldWidth >> 1;
+  int centerLeft  = centerRight - 1;
+
+  for (int side = 0; side < 2; ++side)
+  {
+    float sideScale = !side ? scale : -scale;
+    float sideRotation = !side ? cubeRotation : -cubeRotation;
+    int x  = !side ? centerRight : centerLeft;
+    int dx = !side ? 1 : -1;
+
+    Mtx mtrans, mrot, mrottrans, halfcubetrans, tail, chain, model;
+
+    guMtxTrans(mtrans, sideScale, 0, 0);
+    guMtxRotAxisDeg(mrot, &cubeAxis, sideRotation);
+    guMtxConcat(mrot, mtrans, mrottrans);
+    guMtxTrans(halfcubetrans, sideScale / 2, 0, -hz);
+
+    guMtxConcat(mrot, halfcubetrans, tail);
+    guMtxConcat(tail, mscale, tail);
+
+    guMtxIdentity(chain);
+
+    for (; x >= 0 && x < playfieldWidth; x += dx)
+    {
+      guMtxConcat(chain, tail, model);
+      guMtxConcat(viewtrans, model, columnMtx[x]);
+      guMtxConcat(chain, mrottrans, chain);
+    }
+  }
+
+  rowStep.x = view[0][1];
+  rowStep.y = view[1][1];
+  rowStep.z = view[2][1];
+}
+
+// Player::_GetRowMatrix.
+void BenchPlayer::_GetRowMatrix(Mtx columnMtx, guVector &rowStep, float rowOffset, Mtx modelview)
+{
+  guMtxCopy(columnMtx, modelview);
+  modelview[0][3] += rowStep.x * rowOffset;
+  modelview[1][3] += rowStep.y * rowOffset;
+  modelview[2][3] += rowStep.z * rowOffset;
+}
+
+// Player::_GetRowOffset.
+float BenchPlayer::_GetRowOffset(int y)
+{
+  return ((playfieldHeight >> 1) - 1 - y) * _GetBlockScale();
+}
+
+// Player::DrawBlockAsCube without the guide dot and textures.
+void BenchPlayer::DrawBlockAsCube(float x, float y, ColorId colorIdx)
+{
+  Mtx modelview;
+
+  _SetViewport();
+  _GetBlockMatrix(x, y, modelview);
+  Render_LoadPosMtxImm(modelview, GX_PNMTX0);
+  GX_Cube(colorIdx);
+  Render_SetViewport(0, 0, 640, 480, 0, 1);
+}
+
+/// The playfield and base as drawn before GX_CubeBatch.
+void BenchPlayer::DrawPerBlock()
+{
+  Mtx modelview;
+
+  _SetViewport();
+
+  for (int y = 0; y < playfieldHeight; ++y)
+  {
+    for (int x = 0; x < playfieldWidth; ++x)
+    {
+      if (playfield[x][y] == COLOR_ID_MAX)
+        continue;
+
+      _GetBlockMatrix(x, y, modelview);
+      Render_LoadPosMtxImm(modelview, GX_PNMTX0);
+      GX_Cube(playfield[x][y]);
+    }
+  }
+
+  Render_SetViewport(0, 0, 640, 480, 0, 1);
+
+  for (int x = 0; x < playfieldWidth; ++x)
+  {
+    _SetBaseColor(x);
+    DrawBlockAsCube(x, playfieldHeight, COLOR_ID_BASE);
+  }
+}
+
+/// The playfield and base as DrawPlayfield and DrawBase draw them now.
+void BenchPlayer::DrawBatched()
+{
+  static Mtx blockMtx[MAX_PLAYFIELD_WIDTH * MAX_PLAYFIELD_HEIGHT];
+  static ColorGradient blockGradient[MAX_PLAYFIELD_WIDTH * MAX_PLAYFIELD_HEIGHT];
+  int blocks = 0;
+
+  Mtx columnMtx[MAX_PLAYFIELD_WIDTH];
+  guVector rowStep;
+  _GetColumnMatrices(columnMtx, rowStep);
+
+  for (int y = 0; y < playfieldHeight; ++y)
+  {
+    float rowOffset = _GetRowOffset(y);
+
+    for (int x = 0; x < playfieldWidth; ++x)
+    {
+      if (playfield[x][y] == COLOR_ID_MAX)
+        continue;
+
+      _GetRowMatrix(columnMtx[x], rowStep, rowOffset, blockMtx[blocks]);
+      blockGradient[blocks++] = g_cubeGradients[playfield[x][y]];
+    }
+  }
+
+  _SetViewport();
+  GX_CubeBatch(blockMtx, blockGradient, blocks);
+  Render_SetViewport(0, 0, 640, 480, 0, 1);
+
+  // DrawBase computes the column matrices again
+  Mtx baseMtx[MAX_PLAYFIELD_WIDTH];
+  ColorGradient baseGradient[MAX_PLAYFIELD_WIDTH];
+  _GetColumnMatrices(columnMtx, rowStep);
+  float rowOffset = _GetRowOffset(playfieldHeight);
+
+  for (int x = 0; x < playfieldWidth; ++x)
+  {
+    _SetBaseColor(x);
+    baseGradient[x] = g_cubeGradients[COLOR_ID_BASE];
+    _GetRowMatrix(columnMtx[x], rowStep, rowOffset, baseMtx[x]);
+  }
+
+  _SetViewport();
+  GX_CubeBatch(baseMtx, baseGradient, playfieldWidth);
+  Render_SetViewport(0, 0, 640, 480, 0, 1);
+}
+
+/// Sets up players with the bottom half of the playfield filled, one gap 
+/// per row as in a game.
+static void SetUp(BenchPlayer *players, int count, int width)
+{
+  for (int p = 0; p < count; ++p)
+  {
+    BenchPlayer &player = players[p];
+    player.id = p;
+    player.players = count;
+    player.playfieldWidth = width;
+    player.playfieldHeight = HEIGHT;
+    player.cubeAngle = DEFAULT_CUBE_ANGLE;
+    player.cycleIdx = p;
+
+    for (int x = 0; x < width; ++x)
+    {
+      for (int y = 0; y < HEIGHT; ++y)
+      {
+        bool isFilled = y >= HEIGHT / 2 && x != (y * 7 + p) % width;
+        player.playfield[x][y] = isFilled ? (ColorId)((x + y) % COLOR_ID_DEAD) : COLOR_ID_MAX;
+      }
+    }
+  }
+}
+
+typedef void (BenchPlayer::*DrawFunc)();
+
+static void DrawFrame(BenchPlayer *players, int count, DrawFunc draw)
+{
+  for (int p = 0; p < count; ++p)
+    (players[p].*draw)();
+  Render_EndFrame();
+}
+
+/// Draws frames in batches for about the given time; returns us per frame 
+/// of the fastest batch, which is the least disturbed by other processes.
+static double Time(BenchPlayer *players, int count, DrawFunc draw, double seconds)
+{
+  double best = 0;
+  clock_t end = clock() + (clock_t)(seconds * CLOCKS_PER_SEC);
+  clock_t now;
+
+  do
+  {
+    clock_t start = clock();
+    for (int i = 0; i < 8; ++i)
+      DrawFrame(players, count, draw);
+    now = clock();
+
+    double us = (double)(now - start) * 1000000 / CLOCKS_PER_SEC / 8;
+    if (best == 0 || (us > 0 && us < best))
+      best = us;
+  } while (now < end);
+
+  return best;
+}
+
+/// Checks that both ways put out the same vertices.
+static bool IsSame(BenchPlayer *players, int count)
+{
+  vector<GXTraceVertex> perBlock, batched;
+
+  gxTrace = &perBlock;
+  DrawFrame(players, count, &BenchPlayer::DrawPerBlock);
+  gxTrace = &batched;
+  DrawFrame(players, count, &BenchPlayer::DrawBatched);
+  gxTrace = NULL;
+
+  if (perBlock.size() != batched.size())
+    return false;
+
+  for (size_t i = 0; i < perBlock.size(); ++i)
+  {
+    const GXTraceVertex &a = perBlock[i];
+    const GXTraceVertex &b = batched[i];
+    if (fabsf(a.x - b.x) > 1e-3f || fabsf(a.y - b.y) > 1e-3f || fabsf(a.z - b.z) > 1e-3f ||
+      a.r != b.r || a.g != b.g || a.b != b.b || a.a != b.a)
+      return false;
+  }
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  double seconds = argc > 1 ? strtod(argv[1], NULL) : 0.2;
+  int failures = 0;
+
+  guMtxIdentity(view);
+  for (int c = 0; c < COLOR_ID_MAX; ++c)
+  {
+    u8 v = 40 + c * 20;
+    g_cubeGradients[c].light = (GXColor){v, (u8)(v / 2), (u8)(255 - v), 255};
+    g_cubeGradients[c].medium = (GXColor){(u8)(v - 20), (u8)(v / 3), (u8)(235 - v), 255};
+    g_cubeGradients[c].dark = (GXColor){(u8)(v - 40), (u8)(v / 4), (u8)(215 - v), 255};
+  }
+
+  static BenchPlayer players[4];
+
+  printf("%-7s %5s %6s | %9s %6s %6s %7s | %9s %6s %6s %7s | %7s\n", 
+    "players", "width", "blocks", "per block", "draws", "mtx", "bytes", 
+    "batched", "draws", "mtx", "bytes", "speedup");
+
+  for (int count = 1; count <= 4; ++count)
+  {
+    for (int width = MIN_PLAYFIELD_WIDTH; width <= MAX_PLAYFIELD_WIDTH; width += 5)
+    {
+      SetUp(players, count, width);
+
+      if (!IsSame(players, count))
+      {
+        printf("%-7d %5d  vertices differ\n", count, width);
+        ++failures;
+        continue;
+      }
+
+      int blocks = 0;
+      for (int p = 0; p < count; ++p)
+        for (int x = 0; x < width; ++x)
+          for (int y = 0; y <= HEIGHT; ++y)
+            blocks += y == HEIGHT || players[p].playfield[x][y] != COLOR_ID_MAX;
+
+      DrawFrame(players, count, &BenchPlayer::DrawPerBlock);
+      RenderStats perBlock = *Render_GetStats();
+      DrawFrame(players, count, &BenchPlayer::DrawBatched);
+      RenderStats batched = *Render_GetStats();
+
+      // alternate the two so a slow spell on the machine hits both
+      double perBlockUs = 0, batchedUs = 0;
+      for (int round = 0; round < 4; ++round)
+      {
+        double p = Time(players, count, &BenchPlayer::DrawPerBlock, seconds / 4);
+        double b = Time(players, count, &BenchPlayer::DrawBatched, seconds / 4);
+        if (round == 0 || p < perBlockUs)
+          perBlockUs = p;
+        if (round == 0 || b < batchedUs)
+          batchedUs = b;
+      }
+
+      printf("%-7d %5d %6d | %7.1fus %6u %6u %7u | %7.1fus %6u %6u %7u | %6.2fx\n", 
+        count, width, blocks, 
+        perBlockUs, perBlock.drawCalls, perBlock.matrixLoads, perBlock.bytes, 
+        batchedUs, batched.drawCalls, batched.matrixLoads, batched.bytes, 
+        perBlockUs / batchedUs);
+    }
+  }
+
+  if (failures)
+  {
+    printf("%d configuration%s drew different vertices\n", failures, failures == 1 ? "" : "s");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,34 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file gccore.h
+ * @brief Host stand-in for libogc's gccore.h, used by tools/cubebench.
+ * @author TetriCycle contributors
+ */
+
+#pragma once
+#ifndef __CUBEBENCH_GCCORE_H__
+#define __CUBEBENCH_GCCORE_H__
+
+#include "gctypes.h"
+#include "ogc/gu.h"
+#include "ogc/gx.h"
+
+#endif // __CUBEBENCH_GCCORE_H__
@@ -0,0 +1,49 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file gui.h
+ * @brief Host stand-in for libwiigui's gui.h, used by tools/cubebench.
+ * @author TetriCycle contributors
+ *
+ * Just the render layer and the texture calls of the textured cube faces.
+ */
+
+#pragma once
+#ifndef __CUBEBENCH_GUI_H__
+#define __CUBEBENCH_GUI_H__
+
+#include <gccore.h>
+#include "render.h"
+
+class GuiImageData
+{
+public:
+  GXTexObj *GetTexObj() { return &texObj; }
+
+private:
+  GXTexObj texObj;
+};
+
+static inline void Menu_LoadTexObj(GXTexObj *texObj)
+{
+  Render_LoadTexObj(texObj, GX_TEXMAP0);
+}
+
+#endif // __CUBEBENCH_GUI_H__
@@ -0,0 +1,128 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file gu.h
+ * @brief Host stand-in for libogc's ogc/gu.h, used by tools/cubebench.
+ * @author TetriCycle contributors
+ *
+ * The matrix and vector routines the cube code uses, written after the C 
+ * versions in libogc (the Wii build uses their paired-single versions).
+ */
+
+#pragma once
+#ifndef __CUBEBENCH_GU_H__
+#define __CUBEBENCH_GU_H__
+
+#include <math.h>
+#include <string.h>
+#include <gctypes.h>
+
+typedef f32 Mtx[3][4];
+typedef f32 Mtx44[4][4];
+
+typedef struct _vecf {
+	f32 x, y, z;
+} guVector;
+
+static inline void guMtxIdentity(Mtx mt)
+{
+	for(int i=0; i < 3; i++)
+		for(int j=0; j < 4; j++)
+			mt[i][j] = i == j ? 1.0f : 0.0f;
+}
+
+static inline void guMtxCopy(Mtx src, Mtx dst)
+{
+	memcpy(dst, src, sizeof(Mtx));
+}
+
+static inline void guMtxConcat(Mtx a, Mtx b, Mtx ab)
+{
+	Mtx tmp;
+
+	for(int i=0; i < 3; i++)
+	{
+		for(int j=0; j < 4; j++)
+			tmp[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j];
+		tmp[i][3] += a[i][3];
+	}
+	guMtxCopy(tmp, ab);
+}
+
+static inline void guMtxScale(Mtx mt, f32 xS, f32 yS, f32 zS)
+{
+	guMtxIdentity(mt);
+	mt[0][0] = xS;
+	mt[1][1] = yS;
+	mt[2][2] = zS;
+}
+
+static inline void guMtxTrans(Mtx mt, f32 xT, f32 yT, f32 zT)
+{
+	guMtxIdentity(mt);
+	mt[0][3] = xT;
+	mt[1][3] = yT;
+	mt[2][3] = zT;
+}
+
+static inline void guMtxTransApply(Mtx src, Mtx dst, f32 xT, f32 yT, f32 zT)
+{
+	if(src != dst)
+		guMtxCopy(src, dst);
+	dst[0][3] += xT;
+	dst[1][3] += yT;
+	dst[2][3] += zT;
+}
+
+static inline void guMtxRotAxisRad(Mtx mt, guVector *axis, f32 rad)
+{
+	f32 s = sinf(rad), c = cosf(rad), t = 1.0f - c;
+	f32 len = sqrtf(axis->x * axis->x + axis->y * axis->y + axis->z * axis->z);
+	f32 x = axis->x / len, y = axis->y / len, z = axis->z / len;
+
+	mt[0][0] = t * x * x + c;     mt[0][1] = t * x * y - s * z; mt[0][2] = t * x * z + s * y; mt[0][3] = 0;
+	mt[1][0] = t * x * y + s * z; mt[1][1] = t * y * y + c;     mt[1][2] = t * y * z - s * x; mt[1][3] = 0;
+	mt[2][0] = t * x * z - s * y; mt[2][1] = t * y * z + s * x; mt[2][2] = t * z * z + c;     mt[2][3] = 0;
+}
+
+#define guMtxRotAxisDeg(mt, axis, deg) guMtxRotAxisRad(mt, axis, (deg) * (f32)M_PI / 180.0f)
+
+static inline void guVecScale(guVector *src, guVector *dst, f32 scale)
+{
+	dst->x = src->x * scale;
+	dst->y = src->y * scale;
+	dst->z = src->z * scale;
+}
+
+static inline void guVecAdd(guVector *a, guVector *b, guVector *ab)
+{
+	ab->x = a->x + b->x;
+	ab->y = a->y + b->y;
+	ab->z = a->z + b->z;
+}
+
+static inline void guVecSub(guVector *a, guVector *b, guVector *ab)
+{
+	ab->x = a->x - b->x;
+	ab->y = a->y - b->y;
+	ab->z = a->z - b->z;
+}
+
+#endif // __CUBEBENCH_GU_H__
@@ -0,0 +1,133 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file gx.h
+ * @brief Host stand-in for libogc's ogc/gx.h, used by tools/cubebench.
+ * @author TetriCycle contributors
+ *
+ * The GX calls the cube code and render.h use. Vertex data goes to a 
+ * volatile word, like the write gather pipe on the Wii, so it isn't 
+ * optimized away. When gxTrace is set, every vertex is also transformed 
+ * by the loaded position matrix and appended to it, so two ways of 
+ * drawing the same cubes can be compared.
+ */
+
+#pragma once
+#ifndef __CUBEBENCH_GX_H__
+#define __CUBEBENCH_GX_H__
+
+#include <string.h>
+#include <vector>
+#include <gctypes.h>
+#include <ogc/gu.h>
+
+typedef struct _gxcolor {
+	u8 r, g, b, a;
+} GXColor;
+
+typedef struct _gx_texobj {
+	u32 val[8];
+} GXTexObj;
+
+#define GX_NONE          0
+#define GX_DIRECT        1
+#define GX_VA_POS        9
+#define GX_VA_CLR0       11
+#define GX_VA_TEX0       13
+#define GX_QUADS         0x80
+#define GX_VTXFMT0       0
+#define GX_PNMTX0        0
+#define GX_TEVSTAGE0     0
+#define GX_MODULATE      0
+#define GX_PASSCLR       4
+#define GX_TEXMAP0       0
+
+/// A vertex as the GPU would see it after the position matrix.
+struct GXTraceVertex
+{
+	f32 x, y, z;
+	u8 r, g, b, a;
+};
+
+extern volatile u32 gxPipe; // stands in for the write gather pipe
+extern Mtx gxPosMtx; // the loaded GX_PNMTX0
+extern std::vector<GXTraceVertex> *gxTrace; // where vertices go, if set
+
+static inline void GX_Begin(u8, u8, u16) { gxPipe = 0; }
+static inline void GX_End() { }
+static inline void GX_LoadTexObj(GXTexObj *, u8) { }
+static inline void GX_InvalidateTexAll() { }
+static inline void GX_SetTevOp(u8, u8) { }
+static inline void GX_SetVtxDesc(u8, u8) { }
+static inline void GX_LoadProjectionMtx(Mtx44, u8) { }
+static inline void GX_SetViewport(f32, f32, f32, f32, f32, f32) { }
+static inline void GX_SetZMode(u8, u8, u8) { }
+static inline void GX_CallDispList(void *, u32) { }
+
+static inline void GX_LoadPosMtxImm(Mtx mt, u32)
+{
+	guMtxCopy(mt, gxPosMtx);
+}
+
+static inline u32 GX_FloatBits(f32 f)
+{
+	u32 u;
+	memcpy(&u, &f, sizeof(u));
+	return u;
+}
+
+static inline void GX_Position3f32(f32 x, f32 y, f32 z)
+{
+	gxPipe = GX_FloatBits(x);
+	gxPipe = GX_FloatBits(y);
+	gxPipe = GX_FloatBits(z);
+
+	if(gxTrace)
+	{
+		GXTraceVertex v;
+		v.x = gxPosMtx[0][0] * x + gxPosMtx[0][1] * y + gxPosMtx[0][2] * z + gxPosMtx[0][3];
+		v.y = gxPosMtx[1][0] * x + gxPosMtx[1][1] * y + gxPosMtx[1][2] * z + gxPosMtx[1][3];
+		v.z = gxPosMtx[2][0] * x + gxPosMtx[2][1] * y + gxPosMtx[2][2] * z + gxPosMtx[2][3];
+		v.r = v.g = v.b = v.a = 0;
+		gxTrace->push_back(v);
+	}
+}
+
+static inline void GX_Color4u8(u8 r, u8 g, u8 b, u8 a)
+{
+	gxPipe = (r << 24) | (g << 16) | (b << 8) | a;
+
+	if(gxTrace && !gxTrace->empty())
+	{
+		GXTraceVertex &v = gxTrace->back();
+		v.r = r;
+		v.g = g;
+		v.b = b;
+		v.a = a;
+	}
+}
+
+static inline void GX_TexCoord2f32(f32 s, f32 t)
+{
+	gxPipe = GX_FloatBits(s);
+	gxPipe = GX_FloatBits(t);
+}
+
+#endif // __CUBEBENCH_GX_H__
@@ -0,0 +1,308 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file fontbake.cpp
+ * @brief Host tool that pre-renders a font into GX texture atlases.
+ * @author TetriCycle contributors
+ *
+ * Usage: fontbake font.ttf out.bin size [size ...]
+ *
+ * For every pixel size, the Latin-1 glyphs are rendered exactly as 
+ * FreeTypeGX::cacheGlyphData renders them at runtime, packed onto shelves 
+ * in an I8 atlas (8x4 tiles), and written out already tiled, together with 
+ * the glyph metrics and kerning pairs. See InitBakedFonts in FreeTypeGX.cpp 
+ * for the loader. All values are big-endian.
+ *
+ * File layout:
+ * - header: "FTGX", u16 version, u16 font count
+ * - per font: u16 pixel size, u16 texture format, s16 ascender, 
+ *   s16 descender, u16 atlas width, u16 atlas height, u16 used height, 
+ *   u16 pen x, u16 pen y, u16 shelf height, u16 glyph count, 
+ *   u16 kerning count, u32 atlas data size
+ * - per glyph: u16 char code, s16 offset x, u16 advance x, u16 glyph index, 
+ *   u16 texture width, u16 texture height, s16 offset y, s16 offset max, 
+ *   s16 offset min, u16 atlas x, u16 atlas y
+ * - per kerning pair: u16 left glyph index, u16 right glyph index, s16 delta
+ * - the atlas data (used height only)
+ */
+
+#include <cstdio>    // for FILE, fprintf
+#include <cstdlib>   // for atoi
+#include <vector>    // for vector
+#include <algorithm> // for sort
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+using std::vector;
+
+// These must match FreeTypeGX.h.
+#define BAKE_VERSION 1
+#define BAKE_FIRST_CHAR 32
+#define BAKE_TABLE_SIZE 256
+#define BAKE_ATLAS_WIDTH 512
+#define BAKE_ATLAS_MAX_HEIGHT 1024
+#define BAKE_ATLAS_GLYPHS 128
+#define BAKE_TEXTURE_FORMAT 0x1 // GX_TF_I8
+#define BAKE_TILE_WIDTH 8
+#define BAKE_TILE_HEIGHT 4
+
+/// A rendered glyph.
+struct BakedGlyph
+{
+  unsigned short charCode;
+  short renderOffsetX;
+  unsigned short glyphAdvanceX;
+  unsigned short glyphIndex;
+  unsigned short textureWidth;
+  unsigned short textureHeight;
+  short renderOffsetY;
+  short renderOffsetMax;
+  short renderOffsetMin;
+  unsigned short atlasX;
+  unsigned short atlasY;
+};
+
+/// A kerning pair.
+struct BakedKerning
+{
+  unsigned short left;
+  unsigned short right;
+  short delta;
+};
+
+static bool KerningLess(const BakedKerning &a, const BakedKerning &b)
+{
+  return a.left != b.left ? a.left < b.left : a.right < b.right;
+}
+
+static void WriteU16(FILE *f, int value)
+{
+  fputc((value >> 8) & 0xFF, f);
+  fputc(value & 0xFF, f);
+}
+
+static void WriteU32(FILE *f, unsigned int value)
+{
+  WriteU16(f, value >> 16);
+  WriteU16(f, value & 0xFFFF);
+}
+
+static int Align(int value, int alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/// Copy a rendered bitmap into the I8 atlas at a tile-aligned position.
+static void CopyToAtlas(vector<unsigned char> &atlas, int atlasWidth, 
+                        const FT_Bitmap &bmp, int atlasX, int atlasY)
+{
+  int tilesPerRow = atlasWidth / BAKE_TILE_WIDTH;
+  int tileSize = BAKE_TILE_WIDTH * BAKE_TILE_HEIGHT;
+
+  for (int y = 0; y < (int)bmp.rows; ++y)
+  {
+    for (int x = 0; x < (int)bmp.width; ++x)
+    {
+      int px = atlasX + x;
+      int py = atlasY + y;
+      int tile = (py / BAKE_TILE_HEIGHT) * tilesPerRow + px / BAKE_TILE_WIDTH;
+      int offset = (py % BAKE_TILE_HEIGHT) * BAKE_TILE_WIDTH + px % BAKE_TILE_WIDTH;
+      atlas[tile * tileSize + offset] = bmp.buffer[y * bmp.pitch + x];
+    }
+  }
+}
+
+/// Render and write one pixel size.
+static bool BakeFont(FILE *f, FT_Face face, int pixelSize)
+{
+  if (FT_Set_Pixel_Sizes(face, 0, pixelSize))
+    return false;
+
+  // Same atlas size as FreeTypeGX::createAtlas, so runtime glyphs still fit.
+  int cell = pixelSize + 8;
+  int atlasWidth = BAKE_ATLAS_WIDTH;
+  int atlasHeight = (BAKE_ATLAS_GLYPHS * cell * cell) / atlasWidth;
+  if (atlasHeight > BAKE_ATLAS_MAX_HEIGHT)
+    atlasHeight = BAKE_ATLAS_MAX_HEIGHT;
+  atlasHeight = Align(atlasHeight, BAKE_TILE_HEIGHT);
+
+  vector<unsigned char> atlas(atlasWidth * atlasHeight, 0);
+  vector<BakedGlyph> glyphs;
+  int penX = 0, penY = 0, shelfHeight = 0;
+
+  for (int charCode = BAKE_FIRST_CHAR; charCode < BAKE_TABLE_SIZE; ++charCode)
+  {
+    FT_UInt gIndex = FT_Get_Char_Index(face, charCode);
+    if (!gIndex || FT_Load_Glyph(face, gIndex, FT_LOAD_DEFAULT))
+      continue;
+
+    FT_GlyphSlot slot = face->glyph;
+    FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL);
+    if (slot->format != FT_GLYPH_FORMAT_BITMAP)
+      continue;
+
+    const FT_Bitmap &bmp = slot->bitmap;
+    BakedGlyph g;
+    g.charCode = charCode;
+    g.renderOffsetX = slot->bitmap_left;
+    g.glyphAdvanceX = slot->advance.x >> 6;
+    g.glyphIndex = gIndex;
+    g.textureWidth = Align(bmp.width, BAKE_TILE_WIDTH);
+    g.textureHeight = Align(bmp.rows, BAKE_TILE_HEIGHT);
+    g.renderOffsetY = slot->bitmap_top;
+    g.renderOffsetMax = slot->bitmap_top;
+    g.renderOffsetMin = bmp.rows - slot->bitmap_top;
+    g.atlasX = 0;
+    g.atlasY = 0;
+
+    if (g.textureWidth && g.textureHeight)
+    {
+      if (penX + g.textureWidth > atlasWidth)
+      {
+        penX = 0;
+        penY += shelfHeight;
+        shelfHeight = 0;
+      }
+
+      if (penY + g.textureHeight > atlasHeight)
+      {
+        fprintf(stderr, "fontbake: atlas full at size %d\n", pixelSize);
+        return false;
+      }
+
+      g.atlasX = penX;
+      g.atlasY = penY;
+      CopyToAtlas(atlas, atlasWidth, bmp, penX, penY);
+
+      penX += g.textureWidth;
+      if (g.textureHeight > shelfHeight)
+        shelfHeight = g.textureHeight;
+    }
+
+    glyphs.push_back(g);
+  }
+
+  vector<BakedKerning> kerning;
+  if (FT_HAS_KERNING(face))
+  {
+    for (size_t l = 0; l < glyphs.size(); ++l)
+    {
+      for (size_t r = 0; r < glyphs.size(); ++r)
+      {
+        FT_Vector delta;
+        FT_Get_Kerning(face, glyphs[l].glyphIndex, glyphs[r].glyphIndex, FT_KERNING_DEFAULT, &delta);
+        if (delta.x >> 6)
+        {
+          BakedKerning k = {glyphs[l].glyphIndex, glyphs[r].glyphIndex, (short)(delta.x >> 6)};
+          kerning.push_back(k);
+        }
+      }
+    }
+  }
+
+  // The pairs are looked up with a binary search, so sort them.
+  std::sort(kerning.begin(), kerning.end(), KerningLess);
+
+  int usedHeight = penY + shelfHeight;
+
+  WriteU16(f, pixelSize);
+  WriteU16(f, BAKE_TEXTURE_FORMAT);
+  WriteU16(f, face->size->metrics.ascender >> 6);
+  WriteU16(f, face->size->metrics.descender >> 6);
+  WriteU16(f, atlasWidth);
+  WriteU16(f, atlasHeight);
+  WriteU16(f, usedHeight);
+  WriteU16(f, penX);
+  WriteU16(f, penY);
+  WriteU16(f, shelfHeight);
+  WriteU16(f, glyphs.size());
+  WriteU16(f, kerning.size());
+  WriteU32(f, atlasWidth * usedHeight);
+
+  for (size_t i = 0; i < glyphs.size(); ++i)
+  {
+    const BakedGlyph &g = glyphs[i];
+    WriteU16(f, g.charCode);
+    WriteU16(f, g.renderOffsetX);
+    WriteU16(f, g.glyphAdvanceX);
+    WriteU16(f, g.glyphIndex);
+    WriteU16(f, g.textureWidth);
+    WriteU16(f, g.textureHeight);
+    WriteU16(f, g.renderOffsetY);
+    WriteU16(f, g.renderOffsetMax);
+    WriteU16(f, g.renderOffsetMin);
+    WriteU16(f, g.atlasX);
+    WriteU16(f, g.atlasY);
+  }
+
+  for (size_t i = 0; i < kerning.size(); ++i)
+  {
+    WriteU16(f, kerning[i].left);
+    WriteU16(f, kerning[i].right);
+    WriteU16(f, kerning[i].delta);
+  }
+
+  fwrite(&atlas[0], 1, atlasWidth * usedHeight, f);
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 4)
+  {
+    fprintf(stderr, "usage: fontbake font.ttf out.bin size [size ...]\n");
+    return 1;
+  }
+
+  FT_Library library;
+  FT_Face face;
+  if (FT_Init_FreeType(&library) || FT_New_Face(library, argv[1], 0, &face))
+  {
+    fprintf(stderr, "fontbake: can't load %s\n", argv[1]);
+    return 1;
+  }
+
+  FILE *f = fopen(argv[2], "wb");
+  if (!f)
+  {
+    fprintf(stderr, "fontbake: can't create %s\n", argv[2]);
+    return 1;
+  }
+
+  int fonts = argc - 3;
+  fwrite("FTGX", 1, 4, f);
+  WriteU16(f, BAKE_VERSION);
+  WriteU16(f, fonts);
+
+  for (int i = 0; i < fonts; ++i)
+  {
+    if (!BakeFont(f, face, atoi(argv[3 + i])))
+    {
+      fclose(f);
+      remove(argv[2]);
+      return 1;
+    }
+  }
+
+  fclose(f);
+  FT_Done_Face(face);
+  FT_Done_FreeType(library);
+  return 0;
+}
@@ -0,0 +1,160 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file hudalloc.cpp
+ * @brief Host test that counts the heap allocations made drawing the HUD.
+ * @author TetriCycle contributors
+ *
+ * Usage: hudalloc [frames]
+ *
+ * Builds the real HudText (code/source/HudText.cpp) against the stand-ins 
+ * in tools/hudalloc, whose GuiText allocates in SetText the way the real 
+ * one does, and counts every malloc while it draws a four player HUD:
+ *   - a steady HUD (default 1000 frames) must make no allocations at all;
+ *   - a changed number must only cost the text of that one number.
+ * The same is counted for the old TCYC_DrawText, which set every string 
+ * every frame, for comparison. The exit status is 1 if a check fails.
+ *
+ * Build (glibc): g++ -O2 -Itools/hudalloc -Icode/include -Icode/include/defines 
+ *   tools/hudalloc.cpp code/source/HudText.cpp -o hudalloc
+ */
+
+#include <cstdio>  // for printf, sprintf
+#include <cstdlib> // for strtol
+#include <ctime>   // for clock
+
+#include "HudText.h"
+#include "Options.h"
+#include "Player.h"
+
+int screenwidth = 640;
+Options *g_options;
+Player *g_players;
+
+static unsigned allocations = 0;
+
+// Every allocation on the host goes through malloc (operator new and 
+// strdup included), so counting here catches all of them.
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+
+extern "C" void *malloc(size_t size)
+{
+  ++allocations;
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+  ++allocations;
+  return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+  ++allocations;
+  return __libc_realloc(ptr, size);
+}
+
+/// What TCYC_DrawText did before HudText: new text for every string, every frame.
+static void OldDrawText()
+{
+  GuiText txt(NULL, 28, (GXColor){255, 255, 255, 64});
+  txt.SetAlignment(ALIGN_LEFT, ALIGN_TOP);
+  char buf[12];
+
+  for (int i = 0; i < g_options->players; ++i)
+  {
+    txt.SetText("lines:");
+    txt.Draw();
+    sprintf(buf, "%d", g_players[i].gameData.lines);
+    txt.SetText(buf);
+    txt.Draw();
+    txt.SetText("score:");
+    txt.Draw();
+    sprintf(buf, "%d", g_players[i].gameData.score);
+    txt.SetText(buf);
+    txt.Draw();
+    txt.SetText("level:");
+    txt.Draw();
+    sprintf(buf, "%d", g_players[i].gameData.level);
+    txt.SetText(buf);
+    txt.Draw();
+  }
+}
+
+static bool Check(const char *what, unsigned count, unsigned expected)
+{
+  printf("  %-40s %6u allocations%s\n", what, count, 
+    count == expected ? "" : "  FAILED");
+  return count == expected;
+}
+
+int main(int argc, char *argv[])
+{
+  int frames = argc > 1 ? strtol(argv[1], NULL, 10) : 1000;
+  bool isOk = true;
+
+  Options options;
+  options.players = 4;
+  options.isPaused = false;
+  g_options = &options;
+
+  Player players[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    players[i].gameData.score = 1000 * (i + 1);
+    players[i].gameData.lines = 10 * (i + 1);
+    players[i].gameData.level = i;
+  }
+  g_players = players;
+
+  HudText *hud = new HudText();
+  hud->Draw(); // the first frame sets every number
+
+  allocations = 0;
+  clock_t start = clock();
+  for (int f = 0; f < frames; ++f)
+    hud->Draw();
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  isOk &= Check("steady HUD", allocations, 0);
+
+  // One number changes: its narrow and wide copies, nothing else.
+  players[2].gameData.score += 40;
+  allocations = 0;
+  hud->Draw();
+  isOk &= Check("one number changed", allocations, 2);
+
+  allocations = 0;
+  for (int f = 0; f < frames; ++f)
+    hud->Draw();
+  isOk &= Check("steady HUD after the change", allocations, 0);
+
+  allocations = 0;
+  for (int f = 0; f < frames; ++f)
+    OldDrawText();
+  printf("  %-40s %6u allocations (%.1f per frame)\n", "old TCYC_DrawText", 
+    allocations, frames ? (double)allocations / frames : 0.0);
+
+  printf("  %d steady frames drawn in %.3f ms\n", frames, seconds * 1000);
+  delete hud;
+  return isOk ? 0 : 1;
+}
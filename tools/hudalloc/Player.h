@@ -0,0 +1,49 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file Player.h
+ * @brief Host stand-in for Player.h, used by tools/hudalloc.
+ * @author TetriCycle contributors
+ */
+
+#pragma once
+#ifndef __HUDALLOC_PLAYER_H__
+#define __HUDALLOC_PLAYER_H__
+
+#include "libwiigui/gui.h" // for u8, u16
+
+/// The player data HudText reads.
+class Player
+{
+  struct PlayerGameData
+  {
+    PlayerGameData() : score(0), lines(0), level(0), isDead(false) { }
+
+    u16 score;
+    u16 lines;
+    u8 level;
+    bool isDead;
+  };
+
+public:
+  PlayerGameData gameData; ///< the player game data
+};
+
+#endif // __HUDALLOC_PLAYER_H__
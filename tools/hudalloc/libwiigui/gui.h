@@ -0,0 +1,82 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file gui.h
+ * @brief Host stand-in for libwiigui's gui.h, used by tools/hudalloc.
+ * @author TetriCycle contributors
+ *
+ * Only the parts of GuiText that HudText uses. SetText makes the same heap 
+ * allocations as the real one (a narrow and a wide copy of the string), 
+ * and Draw makes none, like the real one once the glyphs are cached.
+ */
+
+#pragma once
+#ifndef __HUDALLOC_GUI_H__
+#define __HUDALLOC_GUI_H__
+
+#include <cstdlib> // for free
+#include <cstring> // for strdup, strlen
+
+typedef unsigned char u8;
+typedef unsigned short u16;
+
+typedef struct _gxcolor { u8 r, g, b, a; } GXColor;
+
+enum { ALIGN_LEFT, ALIGN_RIGHT, ALIGN_CENTRE, ALIGN_TOP, ALIGN_BOTTOM, ALIGN_MIDDLE };
+
+extern int screenwidth;
+
+class GuiText
+{
+public:
+  GuiText() : origText(NULL), text(NULL), size(0) { }
+  GuiText(const char *t, int s, GXColor c) : origText(NULL), text(NULL), size(s), color(c) { SetText(t); }
+  ~GuiText() { free(origText); delete[] text; }
+
+  void SetText(const char *t)
+  {
+    free(origText);
+    delete[] text;
+    origText = NULL;
+    text = NULL;
+
+    if (t)
+    {
+      origText = strdup(t);
+      text = new wchar_t[strlen(t) + 1];
+      for (size_t i = 0; (text[i] = t[i]); ++i) { }
+    }
+  }
+  void SetFontSize(int s) { size = s; }
+  void SetAlignment(int hor, int vert) { alignment = hor | (vert << 8); }
+  void SetColor(GXColor c) { color = c; }
+  void SetPosition(int x, int y) { left = x; top = y; }
+  void Draw() { }
+
+private:
+  char *origText;
+  wchar_t *text;
+  int size;
+  int alignment;
+  int left, top;
+  GXColor color;
+};
+
+#endif // __HUDALLOC_GUI_H__
@@ -0,0 +1,385 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file metabench.cpp
+ * @brief Host test and benchmark for the Metaphrasis texture converters.
+ * @author TetriCycle contributors
+ *
+ * Usage: metabench [seconds]
+ *
+ * Runs every converter in ext/libwiigui/Metaphrasis.cpp against the 
+ * per-pixel loops it replaced, over glyph sized and image 
+ * sized buffers of random pixels, and checks that the output is identical 
+ * byte for byte. Each pair is then timed for about the given time (default 
+ * 0.2 s), alternating between the two and taking the fastest of many 
+ * batches, and the speedup is printed. The exit status is 1 if any output 
+ * differs.
+ *
+ * Build: g++ -O2 -Itools/metabench -Iext/libwiigui tools/metabench.cpp 
+ *   ext/libwiigui/Metaphrasis.cpp -o metabench
+ */
+
+#include <cstdio>   // for printf
+#include <cstdlib>  // for rand, strtod
+#include <cstring>  // for memcmp
+#include <ctime>    // for clock
+#include <malloc.h> // for memalign
+
+#include "Metaphrasis.h"
+
+typedef uint32_t *(*Converter)(uint32_t *, uint16_t, uint16_t);
+
+// The converters as they were before they walked the tiles row by row, 
+// copied unchanged (apart from the names and the cache flush) so the new 
+// ones can be checked against them.
+
+static uint32_t* RefI4(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
+	uint32_t bufferSize = bufferWidth * bufferHeight >> 1;
+	uint32_t* dataBufferI4 = (uint32_t *)memalign(32, bufferSize);
+	memset(dataBufferI4, 0x00, bufferSize);
+
+	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint8_t *dst = (uint8_t *)dataBufferI4;
+
+	for(uint16_t y = 0; y < bufferHeight; y += 8) {
+		for(uint16_t x = 0; x < bufferWidth; x += 8) {
+			for(uint16_t rows = 0; rows < 8; rows++) {
+				*dst++ = (src[((y + rows) * bufferWidth) + (x + 0)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 1)] & 0xf0) >> 4);
+				*dst++ = (src[((y + rows) * bufferWidth) + (x + 2)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 3)] & 0xf0) >> 4);
+				*dst++ = (src[((y + rows) * bufferWidth) + (x + 4)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 5)] & 0xf0) >> 4);
+				*dst++ = (src[((y + rows) * bufferWidth) + (x + 5)] & 0xf0) | ((src[((y + rows) * bufferWidth) + (x + 7)] & 0xf0) >> 4);
+			}
+		}
+	}
+
+	return dataBufferI4;
+}
+
+static uint32_t* RefI8(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
+	uint32_t bufferSize = bufferWidth * bufferHeight;
+	uint32_t* dataBufferI8 = (uint32_t *)memalign(32, bufferSize);
+	memset(dataBufferI8, 0x00, bufferSize);
+
+	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint8_t *dst = (uint8_t *)dataBufferI8;
+
+	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		for(uint16_t x = 0; x < bufferWidth; x += 8) {
+			for(uint16_t rows = 0; rows < 4; rows++) {
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 0)] & 0xff;
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 1)] & 0xff;
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 2)] & 0xff;
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 3)] & 0xff;
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 4)] & 0xff;
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 5)] & 0xff;
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 6)] & 0xff;
+				*dst++ = src[((y + rows) * bufferWidth) + (x + 7)] & 0xff;
+			}
+		}
+	}
+
+	return dataBufferI8;
+}
+
+static inline uint8_t RefPixelIA4(uint32_t rgba) {
+	uint8_t i, a;
+	
+	i = (rgba >> 8) & 0xf0;
+	a = (rgba     ) & 0xff;
+
+	return i | (a >> 4);
+}
+
+static uint32_t* RefIA4(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
+	uint32_t bufferSize = bufferWidth * bufferHeight;
+	uint32_t* dataBufferIA4 = (uint32_t *)memalign(32, bufferSize);
+	memset(dataBufferIA4, 0x00, bufferSize);
+
+	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint8_t *dst = (uint8_t *)dataBufferIA4;
+
+	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		for(uint16_t x = 0; x < bufferWidth; x += 8) {
+			for(uint16_t rows = 0; rows < 4; rows++) {
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 0)]);
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 1)]);
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 2)]);
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 3)]);
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 4)]);
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 5)]);
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 6)]);
+				*dst++ = RefPixelIA4(src[((y + rows) * bufferWidth) + (x + 7)]);
+			}
+		}
+	}
+
+	return dataBufferIA4;
+}
+
+static inline uint16_t RefPixelIA8(uint32_t rgba) {
+	uint8_t i, a;
+	
+	i = (rgba >> 8) & 0xff;
+	a = (rgba     ) & 0xff;
+
+	return (i << 8) | a;
+}
+
+static uint32_t* RefIA8(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
+	uint32_t bufferSize = (bufferWidth * bufferHeight) << 1;
+	uint32_t* dataBufferIA8 = (uint32_t *)memalign(32, bufferSize);
+	memset(dataBufferIA8, 0x00, bufferSize);
+
+	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint16_t *dst = (uint16_t *)dataBufferIA8;
+
+	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		for(uint16_t x = 0; x < bufferWidth; x += 4) {
+			for(uint16_t rows = 0; rows < 4; rows++) {
+				*dst++ = RefPixelIA8(src[((y + rows) * bufferWidth) + (x + 0)]);
+				*dst++ = RefPixelIA8(src[((y + rows) * bufferWidth) + (x + 1)]);
+				*dst++ = RefPixelIA8(src[((y + rows) * bufferWidth) + (x + 2)]);
+				*dst++ = RefPixelIA8(src[((y + rows) * bufferWidth) + (x + 3)]);
+			}
+		}
+	}
+
+	return dataBufferIA8;
+}
+
+static uint32_t* RefRGBA8(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
+	uint32_t bufferSize = (bufferWidth * bufferHeight) << 2;
+	uint32_t* dataBufferRGBA8 = (uint32_t *)memalign(32, bufferSize);
+	memset(dataBufferRGBA8, 0x00, bufferSize);
+
+	uint8_t *src = (uint8_t *)rgbaBuffer;
+	uint8_t *dst = (uint8_t *)dataBufferRGBA8;
+
+	for(uint16_t block = 0; block < bufferHeight; block += 4) {
+		for(uint16_t i = 0; i < bufferWidth; i += 4) {
+			for (uint16_t c = 0; c < 4; c++) {
+				for (uint16_t ar = 0; ar < 4; ar++) {
+					*dst++ = src[(((i + ar) + ((block + c) * bufferWidth)) * 4) + 3];
+					*dst++ = src[((i + ar) + ((block + c) * bufferWidth)) * 4];
+				}
+			}
+			for (uint16_t c = 0; c < 4; c++) {
+				for (uint16_t gb = 0; gb < 4; gb++) {
+					*dst++ = src[(((i + gb) + ((block + c) * bufferWidth)) * 4) + 1];
+					*dst++ = src[(((i + gb) + ((block + c) * bufferWidth)) * 4) + 2];
+				}
+			}
+		}
+	}
+
+	return dataBufferRGBA8;
+}
+
+static inline uint16_t RefPixelRGB565(uint32_t rgba) {
+	uint8_t r, g, b;
+	
+	r = (((rgba >> 24) & 0xff) * 31) / 255;
+	g = (((rgba >> 16) & 0xff) * 63) / 255;
+	b = (((rgba >>  8) & 0xff) * 31) / 255;
+
+	return (((r << 6) | g ) << 5 ) | b;
+}
+
+static uint32_t* RefRGB565(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
+	uint32_t bufferSize = (bufferWidth * bufferHeight) << 1;
+	uint32_t* dataBufferRGB565 = (uint32_t *)memalign(32, bufferSize);
+	memset(dataBufferRGB565, 0x00, bufferSize);
+
+	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint16_t *dst = (uint16_t *)dataBufferRGB565;
+
+	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		for(uint16_t x = 0; x < bufferWidth; x += 4) {
+			for(uint16_t rows = 0; rows < 4; rows++) {
+				*dst++ = RefPixelRGB565(src[((y + rows) * bufferWidth) + (x + 0)]);
+				*dst++ = RefPixelRGB565(src[((y + rows) * bufferWidth) + (x + 1)]);
+				*dst++ = RefPixelRGB565(src[((y + rows) * bufferWidth) + (x + 2)]);
+				*dst++ = RefPixelRGB565(src[((y + rows) * bufferWidth) + (x + 3)]);
+			}
+		}
+	}
+
+	return dataBufferRGB565;
+}
+
+static inline uint16_t RefPixelRGB5A3(uint32_t rgba) {
+	uint32_t r, g, b, a;
+	uint16_t color;
+
+	r = (rgba >> 24) & 0xff;
+	g = (rgba >> 16) & 0xff;
+	b = (rgba >>  8) & 0xff;
+	a = (rgba      ) & 0xff;
+
+	if (a > 0xe0) {
+		r = r >> 3;
+		g = g >> 3;
+		b = b >> 3;
+	
+		color = (r << 10) | (g << 5) | b;
+		color |= 0x8000;
+	}
+	else {
+		r = r >> 4;
+		g = g >> 4;
+		b = b >> 4;
+		a = a >> 5;
+	
+		color = (a << 12) | (r << 8) | (g << 4) | b;
+	}
+
+	return color;
+}
+
+static uint32_t* RefRGB5A3(uint32_t* rgbaBuffer, uint16_t bufferWidth, uint16_t bufferHeight) {
+	uint32_t bufferSize = (bufferWidth * bufferHeight) << 1;
+	uint32_t* dataBufferRGB5A3 = (uint32_t *)memalign(32, bufferSize);
+	memset(dataBufferRGB5A3, 0x00, bufferSize);
+
+	uint32_t *src = (uint32_t *)rgbaBuffer;
+	uint16_t *dst = (uint16_t *)dataBufferRGB5A3;
+
+	for(uint16_t y = 0; y < bufferHeight; y += 4) {
+		for(uint16_t x = 0; x < bufferWidth; x += 4) {
+			for(uint16_t rows = 0; rows < 4; rows++) {
+				*dst++ = RefPixelRGB5A3(src[((y + rows) * bufferWidth) + (x + 0)]);
+				*dst++ = RefPixelRGB5A3(src[((y + rows) * bufferWidth) + (x + 1)]);
+				*dst++ = RefPixelRGB5A3(src[((y + rows) * bufferWidth) + (x + 2)]);
+				*dst++ = RefPixelRGB5A3(src[((y + rows) * bufferWidth) + (x + 3)]);
+			}
+		}
+	}
+
+	return dataBufferRGB5A3;
+}
+
+/// A converter and the loop it must match.
+struct Format
+{
+  const char *name;
+  Converter convert;
+  Converter reference;
+  int bitsPerPixel;
+};
+
+static const Format formats[] = 
+{
+  {"I4",     Metaphrasis::convertBufferToI4,     RefI4,     4},
+  {"I8",     Metaphrasis::convertBufferToI8,     RefI8,     8},
+  {"IA4",    Metaphrasis::convertBufferToIA4,    RefIA4,    8},
+  {"IA8",    Metaphrasis::convertBufferToIA8,    RefIA8,    16},
+  {"RGB565", Metaphrasis::convertBufferToRGB565, RefRGB565, 16},
+  {"RGB5A3", Metaphrasis::convertBufferToRGB5A3, RefRGB5A3, 16},
+  {"RGBA8",  Metaphrasis::convertBufferToRGBA8,  RefRGBA8,  32}
+};
+
+/// Glyphs at the font sizes the game uses, then menu and screen sized images.
+static const int sizes[][2] = 
+{
+  {16, 16}, {24, 32}, {40, 48}, {64, 64}, {256, 256}, {640, 480}
+};
+
+/// Calls convert on the buffer in batches for about the given time; returns 
+/// us per call of the fastest batch, which is the least disturbed by page 
+/// faults and other processes.
+static double Time(Converter convert, uint32_t *src, uint16_t w, uint16_t h, double seconds)
+{
+  int calls = 1048576 / (w * h) + 4; // per batch, about a megapixel
+  double best = 0;
+  clock_t end = clock() + (clock_t)(seconds * CLOCKS_PER_SEC);
+  clock_t now;
+
+  do
+  {
+    clock_t start = clock();
+    for (int i = 0; i < calls; ++i)
+      free(convert(src, w, h));
+    now = clock();
+
+    double us = (double)(now - start) * 1000000 / CLOCKS_PER_SEC / calls;
+    if (best == 0 || (us > 0 && us < best))
+      best = us;
+  } while (now < end);
+
+  return best;
+}
+
+int main(int argc, char *argv[])
+{
+  double seconds = argc > 1 ? strtod(argv[1], NULL) : 0.2;
+  int failures = 0;
+
+  printf("%-7s %9s %12s %12s %8s\n", "format", "size", "reference", "converter", "speedup");
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+  {
+    uint16_t w = sizes[s][0];
+    uint16_t h = sizes[s][1];
+    uint32_t *src = (uint32_t *)memalign(32, w * h * 4);
+    for (int i = 0; i < w * h; ++i)
+      src[i] = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+
+    for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f)
+    {
+      const Format &format = formats[f];
+      uint32_t *expected = format.reference(src, w, h);
+      uint32_t *actual = format.convert(src, w, h);
+      bool isSame = memcmp(expected, actual, w * h * format.bitsPerPixel / 8) == 0;
+      free(expected);
+      free(actual);
+
+      char size[16];
+      sprintf(size, "%dx%d", w, h);
+
+      if (!isSame)
+      {
+        printf("%-7s %9s  output differs\n", format.name, size);
+        ++failures;
+        continue;
+      }
+
+      // alternate the two so a slow spell on the machine hits both
+      double ref = 0, us = 0;
+      for (int round = 0; round < 4; ++round)
+      {
+        double r = Time(format.reference, src, w, h, seconds / 4);
+        double u = Time(format.convert, src, w, h, seconds / 4);
+        if (round == 0 || r < ref)
+          ref = r;
+        if (round == 0 || u < us)
+          us = u;
+      }
+      printf("%-7s %9s %10.2fus %10.2fus %7.2fx\n", format.name, size, ref, us, ref / us);
+    }
+    free(src);
+  }
+
+  if (failures)
+  {
+    printf("%d converter%s differ from the reference\n", failures, failures == 1 ? "" : "s");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,41 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file gccore.h
+ * @brief Host stand-in for libogc's gccore.h, used by tools/metabench.
+ * @author TetriCycle contributors
+ *
+ * Just the types and the cache call that Metaphrasis and memtrack.h use.
+ */
+
+#pragma once
+#ifndef __METABENCH_GCCORE_H__
+#define __METABENCH_GCCORE_H__
+
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int32_t s32;
+
+static inline void DCFlushRange(void *startaddress, u32 len) { }
+
+#endif // __METABENCH_GCCORE_H__
@@ -0,0 +1,393 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file mixrender.cpp
+ * @brief Host tool that runs the sound effects mixer offline.
+ * @author TetriCycle contributors
+ *
+ * Usage: mixrender out.wav sound[@ms[:priority[:category]]] ...
+ *        mixrender -check [-s min_snr] sound.pcm [encoded]
+ *
+ * Starts every sound at its time (in ms, default 0) with the given 
+ * priority (default MIXER_PRIORITY_NORMAL) and category (0 for MIXER_UI, 
+ * 1 for MIXER_EFFECTS, the default), and mixes them with the mixer the 
+ * game runs (ext/libwiigui/mixer.cpp) until the last one is over. The 
+ * result is written as a 16 bit stereo WAV at MIXER_RATE, so it can be 
+ * listened to or compared against a reference, and the time the mixing 
+ * took is printed along with the mixer statistics. Sounds are either raw 
+ * PCM or the output of adpcmenc, like the ones the game plays.
+ *
+ * With -check, nothing is written; the sound is played alone at a few 
+ * volumes and every output sample has to match a plain reference of the 
+ * resampler (16.16 position, linear interpolation, gain, clamp) exactly. 
+ * If the same sound encoded by adpcmenc is given too, it is checked the 
+ * same way against the block decoder of imaadpcm.h, and the two mixes 
+ * have to agree to within min_snr dB (default MIXRENDER_MIN_SNR). The 
+ * tool exits with 1 if a check fails and with 2 if a sound can't be read.
+ *
+ * Build: g++ -O2 -Iext/libwiigui tools/mixrender.cpp ext/libwiigui/mixer.cpp -o mixrender
+ */
+
+#include <cstdio>    // for FILE, fprintf, printf
+#include <cstdlib>   // for strtol, atof
+#include <cstring>   // for strchr, strlen, strcmp, memcmp
+#include <ctime>     // for clock
+#include <cmath>     // for log10
+#include <algorithm> // for sort
+#include <vector>    // for vector
+
+#include "../ext/libwiigui/mixer.h"
+#include "../ext/libwiigui/imaadpcm.h"
+
+using std::vector;
+
+/// Stop after this much audio, in case a sound never ends.
+#define MIXRENDER_MAX_SECONDS 600
+
+/// Lowest SNR an encoded sound may mix at, against the PCM it came from.
+#define MIXRENDER_MIN_SNR 38.0
+
+/// A sound to start.
+struct MixEvent
+{
+  unsigned frame; ///< the output frame to start at
+  int priority;
+  int category;
+  vector<unsigned char> data;
+
+  bool operator<(const MixEvent &other) const { return frame < other.frame; }
+};
+
+static void PutU16(FILE *f, unsigned int value)
+{
+  fputc(value & 0xFF, f);
+  fputc((value >> 8) & 0xFF, f);
+}
+
+static void PutU32(FILE *f, unsigned int value)
+{
+  PutU16(f, value & 0xFFFF);
+  PutU16(f, value >> 16);
+}
+
+static unsigned int GetU16(const unsigned char *p)
+{
+  return (p[0] << 8) | p[1];
+}
+
+static unsigned int GetU32(const unsigned char *p)
+{
+  return (GetU16(p) << 16) | GetU16(p + 2);
+}
+
+static bool LoadFile(const char *path, vector<unsigned char> &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+
+  int c;
+  while ((c = fgetc(f)) != EOF)
+    data.push_back((unsigned char)c);
+  fclose(f);
+  return true;
+}
+
+/// Decode a sound to interleaved stereo frames, mono copied to both sides, 
+/// the way the mixer reads it; returns the rate, or 0 if it isn't valid.
+static int DecodeSound(const vector<unsigned char> &data, vector<int> &frames)
+{
+  if (data.size() < ADPCM_HEADER || memcmp(&data[0], "TADP", 4) != 0)
+  {
+    for (size_t i = 0; i + 4 <= data.size(); i += 4)
+    {
+      frames.push_back((short)GetU16(&data[i]));
+      frames.push_back((short)GetU16(&data[i + 2]));
+    }
+    return MIXER_PCM_RATE;
+  }
+
+  int channels = GetU16(&data[6]);
+  int rate = GetU32(&data[8]);
+  size_t count = GetU32(&data[12]);
+  size_t blocks = (count + ADPCM_BLOCK_FRAMES - 1) / ADPCM_BLOCK_FRAMES;
+  if (GetU16(&data[4]) != ADPCM_VERSION || (channels != 1 && channels != 2) ||
+      rate <= 0 || ADPCM_HEADER + blocks * ADPCM_BLOCK_BYTES(channels) > data.size())
+    return 0;
+
+  vector<short> block(ADPCM_BLOCK_FRAMES * channels);
+  for (size_t b = 0; b < blocks; ++b)
+  {
+    AdpcmDecodeBlock(&data[ADPCM_HEADER + b * ADPCM_BLOCK_BYTES(channels)], 
+                     channels, ADPCM_BLOCK_FRAMES, &block[0]);
+    for (size_t i = 0; i < ADPCM_BLOCK_FRAMES && b * ADPCM_BLOCK_FRAMES + i < count; ++i)
+    {
+      frames.push_back(block[i * channels]);
+      frames.push_back(block[i * channels + channels - 1]);
+    }
+  }
+  return rate;
+}
+
+/// The resampler, written out plainly: output frame n sits n * step into 
+/// the sound, between the frame before that position and the one at it 
+/// (the first one comes after silence), and ends with the last frame.
+static void ReferenceRender(const vector<int> &frames, int rate, int gain, 
+                            vector<short> &out)
+{
+  unsigned step = ((unsigned)rate << 16) / MIXER_RATE;
+  size_t count = frames.size() / 2;
+
+  for (unsigned long long at = 0; (at >> 16) < count; at += step)
+  {
+    size_t k = (size_t)(at >> 16);
+    int t = (int)(at & 0xFFFF) >> 1;
+    for (int c = 0; c < 2; ++c)
+    {
+      int a = k > 0 ? frames[(k - 1) * 2 + c] : 0, b = frames[k * 2 + c];
+      int s = ((a + (((b - a) * t) >> 15)) * gain) >> 16;
+      out.push_back(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+    }
+  }
+}
+
+/// Play the sound alone and mix it until it is over.
+static bool MixerRender(const vector<unsigned char> &data, int volume, 
+                        int categoryVolume, vector<short> &out)
+{
+  Mixer_SetCategoryVolume(MIXER_EFFECTS, categoryVolume);
+  if (Mixer_Play(&data[0], (int)data.size(), MIXER_EFFECTS, 
+                 MIXER_PRIORITY_NORMAL, volume) < 0)
+    return false;
+
+  MixerStats stats;
+  for (Mixer_GetStats(&stats); stats.active > 0; Mixer_GetStats(&stats))
+  {
+    out.resize(out.size() + MIXER_CHUNK * 2);
+    Mixer_Render(&out[out.size() - MIXER_CHUNK * 2], MIXER_CHUNK);
+  }
+  return true;
+}
+
+/// The volume and category volume of every exact comparison.
+static const int checkGains[][2] = {{255, 255}, {255, 128}, {100, 200}, {1, 255}};
+
+/// Compare the mixer against ReferenceRender; the mixer may only add 
+/// silence at the end of its last chunk.
+static bool CheckExact(const char *name, const vector<unsigned char> &data)
+{
+  vector<int> frames;
+  int rate = DecodeSound(data, frames);
+  if (rate == 0 || frames.empty())
+  {
+    fprintf(stderr, "mixrender: %s isn't a sound the mixer plays\n", name);
+    return false;
+  }
+
+  for (size_t g = 0; g < sizeof(checkGains) / sizeof(checkGains[0]); ++g)
+  {
+    vector<short> mixed, expected;
+    if (!MixerRender(data, checkGains[g][0], checkGains[g][1], mixed))
+    {
+      fprintf(stderr, "mixrender: %s wasn't played\n", name);
+      return false;
+    }
+    ReferenceRender(frames, rate, checkGains[g][0] * checkGains[g][1], expected);
+
+    for (size_t i = 0; i < mixed.size() || i < expected.size(); ++i)
+    {
+      int m = i < mixed.size() ? mixed[i] : 0;
+      int e = i < expected.size() ? expected[i] : 0;
+      if (m != e)
+      {
+        fprintf(stderr, "mixrender: %s at volume %d/%d, frame %u %s: mixed %d, "
+          "expected %d\n", name, checkGains[g][0], checkGains[g][1], 
+          (unsigned)(i / 2), i % 2 ? "right" : "left", m, e);
+        return false;
+      }
+    }
+  }
+
+  printf("  %s: matches the reference resampler at %u volumes\n", name, 
+    (unsigned)(sizeof(checkGains) / sizeof(checkGains[0])));
+  return true;
+}
+
+/// Check the sounds given to -check; returns the exit code.
+static int Check(int argc, char *argv[])
+{
+  double minSnr = MIXRENDER_MIN_SNR;
+  int arg = 0;
+  if (arg + 1 < argc && strcmp(argv[arg], "-s") == 0)
+  {
+    minSnr = atof(argv[arg + 1]);
+    arg += 2;
+  }
+
+  if (argc - arg < 1 || argc - arg > 2)
+  {
+    fprintf(stderr, "usage: mixrender -check [-s min_snr] sound.pcm [encoded]\n");
+    return 1;
+  }
+
+  vector<unsigned char> data[2];
+  const char *name[2];
+  for (int i = 0; i < argc - arg; ++i)
+  {
+    if (!LoadFile(argv[arg + i], data[i]) || data[i].empty())
+    {
+      fprintf(stderr, "mixrender: can't load %s\n", argv[arg + i]);
+      return 2;
+    }
+    name[i] = strrchr(argv[arg + i], '/');
+    name[i] = name[i] ? name[i] + 1 : argv[arg + i];
+  }
+
+  bool ok = CheckExact(name[0], data[0]);
+  if (argc - arg == 1)
+    return ok ? 0 : 1;
+  ok = CheckExact(name[1], data[1]) && ok;
+
+  // How close the encoded sound comes to the PCM, once both are mixed.
+  vector<short> pcm, encoded;
+  if (!MixerRender(data[0], 255, 255, pcm) || !MixerRender(data[1], 255, 255, encoded))
+    return 1;
+
+  double signal = 0, noise = 0;
+  for (size_t i = 0; i < pcm.size() && i < encoded.size(); ++i)
+  {
+    double s = pcm[i], d = encoded[i] - s;
+    signal += s * s;
+    noise += d * d;
+  }
+  double snr = noise > 0 ? 10 * log10(signal / noise) : INFINITY;
+
+  if (snr < minSnr)
+  {
+    fprintf(stderr, "mixrender: %s mixes at %.1f dB SNR against %s, below %.1f dB\n", 
+      name[1], snr, name[0], minSnr);
+    return 1;
+  }
+  printf("  %s: mixes at %.1f dB SNR against %s\n", name[1], snr, name[0]);
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc >= 2 && strcmp(argv[1], "-check") == 0)
+    return Check(argc - 2, argv + 2);
+
+  if (argc < 3)
+  {
+    fprintf(stderr, "usage: mixrender out.wav sound[@ms[:priority[:category]]] ...\n"
+      "       mixrender -check [-s min_snr] sound.pcm [encoded]\n");
+    return 1;
+  }
+
+  vector<MixEvent> events(argc - 2);
+  for (int i = 2; i < argc; ++i)
+  {
+    MixEvent &e = events[i - 2];
+    vector<char> path(argv[i], argv[i] + strlen(argv[i]) + 1);
+    char *at = strchr(&path[0], '@');
+    long ms = 0;
+
+    e.priority = MIXER_PRIORITY_NORMAL;
+    e.category = MIXER_EFFECTS;
+
+    if (at)
+    {
+      *at = 0;
+      char *end;
+      ms = strtol(at + 1, &end, 10);
+      if (*end == ':')
+        e.priority = strtol(end + 1, &end, 10);
+      if (*end == ':')
+        e.category = strtol(end + 1, &end, 10);
+    }
+    e.frame = (unsigned)(ms * MIXER_RATE / 1000);
+
+    if (!LoadFile(&path[0], e.data))
+    {
+      fprintf(stderr, "mixrender: can't load %s\n", &path[0]);
+      return 1;
+    }
+  }
+  std::stable_sort(events.begin(), events.end());
+
+  // Mix up to the next start time, start the sound, and so on.
+  vector<short> out;
+  unsigned frame = 0;
+  size_t next = 0;
+  MixerStats stats;
+  clock_t start = clock();
+
+  for (;;)
+  {
+    while (next < events.size() && events[next].frame <= frame)
+    {
+      MixEvent &e = events[next++];
+      Mixer_Play(&e.data[0], (int)e.data.size(), e.category, e.priority, 255);
+    }
+
+    Mixer_GetStats(&stats);
+    if ((next == events.size() && stats.active == 0) || 
+        frame >= (unsigned)MIXRENDER_MAX_SECONDS * MIXER_RATE)
+      break;
+
+    unsigned count = MIXER_CHUNK;
+    if (next < events.size() && events[next].frame - frame < count)
+      count = events[next].frame - frame;
+
+    out.resize((frame + count) * 2);
+    Mixer_Render(&out[frame * 2], count);
+    frame += count;
+  }
+
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  FILE *f = fopen(argv[1], "wb");
+  if (!f)
+  {
+    fprintf(stderr, "mixrender: can't create %s\n", argv[1]);
+    return 1;
+  }
+  fwrite("RIFF", 1, 4, f);
+  PutU32(f, 36 + frame * 4);
+  fwrite("WAVEfmt ", 1, 8, f);
+  PutU32(f, 16);
+  PutU16(f, 1); // PCM
+  PutU16(f, 2);
+  PutU32(f, MIXER_RATE);
+  PutU32(f, MIXER_RATE * 4);
+  PutU16(f, 4);
+  PutU16(f, 16);
+  fwrite("data", 1, 4, f);
+  PutU32(f, frame * 4);
+  for (size_t i = 0; i < out.size(); ++i)
+    PutU16(f, (unsigned short)out[i]);
+  fclose(f);
+
+  printf("  %.2f s of audio mixed in %.1f ms (%.0fx real time), "
+    "peak %d voices, %u stolen, %u dropped\n", (double)frame / MIXER_RATE, 
+    seconds * 1000, seconds > 0 ? frame / (MIXER_RATE * seconds) : 0.0, 
+    stats.peak, stats.stolen, stats.dropped);
+  return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file ppmdiff.cpp
+ * @brief Host tool that compares a screenshot against a golden image.
+ * @author TetriCycle contributors
+ *
+ * Usage: ppmdiff [-t tolerance] [-n pixels] golden.ppm shot.ppm [diff.ppm]
+ *
+ * Reads two binary PPM images, such as the sd:/tetricycle.ppm a debug 
+ * build saves when a recording starts, and compares them channel by 
+ * channel. A pixel differs if any channel is off by more than tolerance 
+ * (default 0). It prints the number of differing pixels, the largest 
+ * difference and the PSNR, and optionally writes diff.ppm: the golden 
+ * image dimmed to gray with the differing pixels in red.
+ *
+ * The exit status is 1 if the sizes differ or more than pixels (default 
+ * 0) pixels differ, so a script can fail on a visual change, and 2 if an 
+ * image can't be read.
+ *
+ * Build: g++ -O2 tools/ppmdiff.cpp -o ppmdiff
+ */
+
+#include <cmath>   // for log10
+#include <cstdio>  // for FILE, fopen, fread, fwrite, printf
+#include <cstdlib> // for strtol
+#include <cstring> // for strcmp
+#include <vector>  // for vector
+
+using std::vector;
+
+/// An RGB image, 3 bytes per pixel.
+struct Image
+{
+  int width;
+  int height;
+  vector<unsigned char> rgb;
+};
+
+/// Skips whitespace and # comments in a PPM header.
+static void SkipSpace(FILE *f)
+{
+  int c;
+  while ((c = fgetc(f)) != EOF)
+  {
+    if (c == '#')
+    {
+      while ((c = fgetc(f)) != EOF && c != '\n')
+        ;
+    }
+    else if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+    {
+      ungetc(c, f);
+      break;
+    }
+  }
+}
+
+/// Reads a binary (P6) PPM with 8-bit channels.
+static bool LoadPPM(const char *path, Image &image)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+  {
+    fprintf(stderr, "ppmdiff: can't load %s\n", path);
+    return false;
+  }
+
+  int maxval = 0;
+  bool ok = fgetc(f) == 'P' && fgetc(f) == '6';
+  if (ok)
+  {
+    SkipSpace(f);
+    ok = fscanf(f, "%d", &image.width) == 1;
+    SkipSpace(f);
+    ok = ok && fscanf(f, "%d", &image.height) == 1;
+    SkipSpace(f);
+    ok = ok && fscanf(f, "%d", &maxval) == 1 && maxval == 255;
+    ok = ok && fgetc(f) != EOF; // the single whitespace before the pixels
+    ok = ok && image.width > 0 && image.height > 0;
+  }
+
+  if (ok)
+  {
+    image.rgb.resize((size_t)image.width * image.height * 3);
+    ok = fread(&image.rgb[0], 1, image.rgb.size(), f) == image.rgb.size();
+  }
+  fclose(f);
+
+  if (!ok)
+    fprintf(stderr, "ppmdiff: %s is not an 8-bit binary PPM\n", path);
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  int tolerance = 0;
+  long maxPixels = 0;
+  int arg = 1;
+  while (arg + 1 < argc && argv[arg][0] == '-')
+  {
+    if (strcmp(argv[arg], "-t") == 0)
+      tolerance = strtol(argv[arg + 1], NULL, 10);
+    else if (strcmp(argv[arg], "-n") == 0)
+      maxPixels = strtol(argv[arg + 1], NULL, 10);
+    else
+      break;
+    arg += 2;
+  }
+
+  if (argc - arg < 2 || argc - arg > 3)
+  {
+    fprintf(stderr, "usage: ppmdiff [-t tolerance] [-n pixels] golden.ppm shot.ppm [diff.ppm]\n");
+    return 2;
+  }
+
+  Image golden, shot;
+  if (!LoadPPM(argv[arg], golden) || !LoadPPM(argv[arg + 1], shot))
+    return 2;
+
+  if (golden.width != shot.width || golden.height != shot.height)
+  {
+    printf("size differs: %dx%d golden, %dx%d shot\n", golden.width, 
+      golden.height, shot.width, shot.height);
+    return 1;
+  }
+
+  long pixels = (long)golden.width * golden.height;
+  long differing = 0;
+  int maxDiff = 0;
+  double squares = 0;
+  vector<unsigned char> diff(golden.rgb.size());
+
+  for (long i = 0; i < pixels; i++)
+  {
+    const unsigned char *a = &golden.rgb[i * 3];
+    const unsigned char *b = &shot.rgb[i * 3];
+    int pixelDiff = 0;
+    for (int c = 0; c < 3; c++)
+    {
+      int d = a[c] > b[c] ? a[c] - b[c] : b[c] - a[c];
+      squares += d * d;
+      if (d > pixelDiff)
+        pixelDiff = d;
+    }
+    if (pixelDiff > maxDiff)
+      maxDiff = pixelDiff;
+
+    unsigned char *out = &diff[i * 3];
+    if (pixelDiff > tolerance)
+    {
+      differing++;
+      out[0] = 255;
+      out[1] = out[2] = 0;
+    }
+    else
+      out[0] = out[1] = out[2] = (a[0] + a[1] + a[2]) / 12 + 32;
+  }
+
+  double mse = squares / (pixels * 3);
+  if (mse == 0)
+    printf("identical: %dx%d\n", golden.width, golden.height);
+  else
+    printf("%ld of %ld pixels differ by more than %d, max difference %d, "
+      "PSNR %.2f dB\n", differing, pixels, tolerance, maxDiff, 
+      10 * log10(255.0 * 255.0 / mse));
+
+  if (argc - arg == 3)
+  {
+    FILE *f = fopen(argv[arg + 2], "wb");
+    if (!f)
+    {
+      fprintf(stderr, "ppmdiff: can't write %s\n", argv[arg + 2]);
+      return 2;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", golden.width, golden.height);
+    fwrite(&diff[0], 1, diff.size(), f);
+    fclose(f);
+  }
+
+  return differing > maxPixels ? 1 : 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file renderreplay.cpp
+ * @brief Host tool that replays a captured frame through the render layer.
+ * @author TetriCycle contributors
+ *
+ * Usage: renderreplay [-t percent] capture.txt [baseline.txt]
+ *
+ * Reads a frame written by Render_DumpCapture (a debug build compiled with 
+ * RENDER_CAPTURE=1 saves one to sd:/tetricycle_frame.txt when a recording 
+ * is started with the capture button), replays every command through the 
+ * host build of ext/libwiigui/render.cpp and prints the counters that 
+ * come out. They must match the counters in the dump's header line, or 
+ * the accounting in render.h has drifted from what the game recorded.
+ *
+ * Given a baseline capture as well, it is replayed the same way and the 
+ * two frames are printed side by side; any counter that grew by more 
+ * than percent (default 0) counts as a regression. The exit status is 1 
+ * on a mismatch or a regression and 2 if a capture can't be read.
+ *
+ * Build: g++ -O2 -Itools/renderreplay -Iext/libwiigui 
+ *   tools/renderreplay.cpp ext/libwiigui/render.cpp -o renderreplay
+ */
+
+#include <cstdio>  // for FILE, fgets, printf, sscanf
+#include <cstdlib> // for strtod
+#include <cstring> // for strcmp, strcspn
+
+#include "render.h"
+
+static const char *commandNames[] = { "Begin", "LoadTexObj", 
+  "InvalidateTexAll", "SetTevOp", "SetVtxDesc", "LoadPosMtx", 
+  "LoadProjectionMtx", "SetViewport", "SetZMode", "CallDispList" };
+
+static const char *counterNames[] = { "draws", "vertices", "state", 
+  "textures", "invalidates", "matrices", "lists", "bytes" };
+
+static const int COUNTERS = 8;
+
+/// The counters of a RenderStats in the order they are dumped.
+static void GetCounters(const RenderStats &stats, unsigned *counters)
+{
+  counters[0] = stats.drawCalls;
+  counters[1] = stats.vertices;
+  counters[2] = stats.stateChanges;
+  counters[3] = stats.textureLoads;
+  counters[4] = stats.invalidates;
+  counters[5] = stats.matrixLoads;
+  counters[6] = stats.dispLists;
+  counters[7] = stats.bytes;
+}
+
+/// Replays a single dumped command.
+static bool Replay(int type, unsigned arg0, unsigned arg1, unsigned arg2)
+{
+  static GXTexObj texObj;
+  static Mtx mtx;
+  static Mtx44 projection;
+  static u8 list[32];
+
+  switch (type)
+  {
+    case RENDER_CMD_BEGIN:
+      Render_Begin(arg0, arg2, arg1);
+      Render_End();
+      break;
+    case RENDER_CMD_LOADTEXOBJ:
+      Render_LoadTexObj(&texObj, arg0);
+      break;
+    case RENDER_CMD_INVALIDATETEXALL:
+      Render_InvalidateTexAll();
+      break;
+    case RENDER_CMD_SETTEVOP:
+      Render_SetTevOp(arg0, arg1);
+      break;
+    case RENDER_CMD_SETVTXDESC:
+      Render_SetVtxDesc(arg0, arg1);
+      break;
+    case RENDER_CMD_LOADPOSMTX:
+      Render_LoadPosMtxImm(mtx, arg2);
+      break;
+    case RENDER_CMD_LOADPROJECTIONMTX:
+      Render_LoadProjectionMtx(projection, arg0);
+      break;
+    case RENDER_CMD_SETVIEWPORT:
+      Render_SetViewport((s32)arg2, 0, arg1, 0, 0, 1);
+      break;
+    case RENDER_CMD_SETZMODE:
+      Render_SetZMode(arg0, arg1, arg2);
+      break;
+    case RENDER_CMD_CALLDISPLIST:
+      Render_CallDispList(list, arg2);
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+/// Replays a dump as one frame. recorded gets the counters from its header 
+/// and replayed the ones the replay produced.
+static bool ReplayDump(const char *path, unsigned *recorded, unsigned *replayed)
+{
+  FILE *f = fopen(path, "r");
+  if (!f)
+  {
+    fprintf(stderr, "renderreplay: can't load %s\n", path);
+    return false;
+  }
+
+  memset(recorded, 0, COUNTERS * sizeof(unsigned));
+
+  // frames are drawn from a clean state, as after Render_EndFrame
+  renderTexCoords = false;
+  Render_CaptureFrame();
+  Render_EndFrame();
+
+  char line[256];
+  bool ok = true;
+  while (ok && fgets(line, sizeof(line), f))
+  {
+    line[strcspn(line, "\r\n")] = 0;
+    if (line[0] == 0)
+      continue;
+
+    if (line[0] == '#')
+    {
+      sscanf(line, "# draws %u, vertices %u, state %u, textures %u, "
+        "invalidates %u, matrices %u, lists %u, bytes %u", &recorded[0], 
+        &recorded[1], &recorded[2], &recorded[3], &recorded[4], 
+        &recorded[5], &recorded[6], &recorded[7]);
+      continue;
+    }
+
+    char name[32];
+    unsigned arg0, arg1, arg2;
+    int type = -1;
+    if (sscanf(line, "%31s %u %u %u", name, &arg0, &arg1, &arg2) == 4)
+    {
+      for (int i = 0; i < (int)(sizeof(commandNames) / sizeof(commandNames[0])); i++)
+        if (strcmp(name, commandNames[i]) == 0)
+          type = i;
+    }
+
+    if (type < 0 || !Replay(type, arg0, arg1, arg2))
+    {
+      fprintf(stderr, "renderreplay: bad line in %s: %s\n", path, line);
+      ok = false;
+    }
+  }
+  fclose(f);
+
+  Render_EndFrame();
+  GetCounters(*Render_GetStats(), replayed);
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  double percent = 0;
+  int arg = 1;
+  if (arg + 1 < argc && strcmp(argv[arg], "-t") == 0)
+  {
+    percent = strtod(argv[arg + 1], NULL);
+    arg += 2;
+  }
+
+  if (argc - arg < 1 || argc - arg > 2)
+  {
+    fprintf(stderr, "usage: renderreplay [-t percent] capture.txt [baseline.txt]\n");
+    return 2;
+  }
+
+  unsigned recorded[COUNTERS], replayed[COUNTERS];
+  if (!ReplayDump(argv[arg], recorded, replayed))
+    return 2;
+
+  unsigned baseline[COUNTERS], baselineRecorded[COUNTERS];
+  bool haveBaseline = argc - arg == 2;
+  if (haveBaseline && !ReplayDump(argv[arg + 1], baselineRecorded, baseline))
+    return 2;
+
+  int mismatches = 0, regressions = 0;
+
+  if (haveBaseline)
+    printf("%-12s %10s %10s %8s\n", "counter", "baseline", "capture", "change");
+  else
+    printf("%-12s %10s %10s\n", "counter", "recorded", "replayed");
+
+  for (int i = 0; i < COUNTERS; i++)
+  {
+    // an older dump or a release build leaves the header counters at 0
+    bool mismatch = recorded[i] != 0 && recorded[i] != replayed[i];
+    if (haveBaseline && baselineRecorded[i] != 0 && baselineRecorded[i] != baseline[i])
+      mismatch = true;
+    mismatches += mismatch;
+
+    if (haveBaseline)
+    {
+      double change = baseline[i] ? 100.0 * ((double)replayed[i] - baseline[i]) / baseline[i] : 0;
+      bool regression = replayed[i] > baseline[i] && (baseline[i] == 0 || change > percent);
+      regressions += regression;
+      printf("%-12s %10u %10u %+7.1f%%%s%s\n", counterNames[i], baseline[i], 
+        replayed[i], change, regression ? "  REGRESSION" : "", 
+        mismatch ? "  MISMATCH" : "");
+    }
+    else
+      printf("%-12s %10u %10u%s\n", counterNames[i], recorded[i], replayed[i], 
+        mismatch ? "  MISMATCH" : "");
+  }
+
+  if (mismatches)
+    printf("%d counter(s) don't match the header of their capture\n", mismatches);
+  if (regressions)
+    printf("%d counter(s) regressed\n", regressions);
+
+  return mismatches || regressions ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file gccore.h
+ * @brief Host stand-in for libogc's gccore.h, used by tools/renderreplay.
+ * @author TetriCycle contributors
+ *
+ * Just the types, constants and GX calls that render.h uses. The GX calls 
+ * do nothing, so on the host the Render_* functions only count and record.
+ */
+
+#pragma once
+#ifndef __RENDERREPLAY_GCCORE_H__
+#define __RENDERREPLAY_GCCORE_H__
+
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef float f32;
+
+typedef f32 Mtx[3][4];
+typedef f32 Mtx44[4][4];
+
+typedef struct _gx_texobj {
+	u32 val[8];
+} GXTexObj;
+
+#define GX_NONE          0
+#define GX_DIRECT        1
+#define GX_VA_POS        9
+#define GX_VA_CLR0       11
+#define GX_VA_TEX0       13
+#define GX_QUADS         0x80
+#define GX_TRIANGLESTRIP 0x98
+#define GX_VTXFMT0       0
+#define GX_VTXFMT1       1
+#define GX_PNMTX0        0
+#define GX_TEVSTAGE0     0
+#define GX_MODULATE      0
+#define GX_PASSCLR       4
+#define GX_TEXMAP0       0
+#define GX_PERSPECTIVE   0
+#define GX_ORTHOGRAPHIC  1
+#define GX_LEQUAL        3
+
+static inline void GX_Begin(u8, u8, u16) { }
+static inline void GX_End() { }
+static inline void GX_LoadTexObj(GXTexObj *, u8) { }
+static inline void GX_InvalidateTexAll() { }
+static inline void GX_SetTevOp(u8, u8) { }
+static inline void GX_SetVtxDesc(u8, u8) { }
+static inline void GX_LoadPosMtxImm(Mtx, u32) { }
+static inline void GX_LoadProjectionMtx(Mtx44, u8) { }
+static inline void GX_SetViewport(f32, f32, f32, f32, f32, f32) { }
+static inline void GX_SetZMode(u8, u8, u8) { }
+static inline void GX_CallDispList(void *, u32) { }
+
+#endif // __RENDERREPLAY_GCCORE_H__
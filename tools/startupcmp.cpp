@@ -0,0 +1,181 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file startupcmp.cpp
+ * @brief Host tool that compares two startup timelines.
+ * @author TetriCycle contributors
+ *
+ * Usage: startupcmp [-t percent] [-m ms] baseline.txt run.txt
+ *
+ * Reads two dumps written by Startup_Dump (a debug build saves one to 
+ * sd:/tetricycle_startup.txt on every boot), adds up the time of every 
+ * phase and every load by name, and prints them side by side along with 
+ * the first frame and the total startup time. Anything that got slower by 
+ * more than percent (default 10) and by more than ms (default 5) counts as 
+ * a regression; if there is one the exit status is 1, so a script can 
+ * fail a build on it. It is 2 if a dump can't be read.
+ *
+ * Build: g++ -O2 tools/startupcmp.cpp -o startupcmp
+ */
+
+#include <cstdio>  // for FILE, fgets, printf, sscanf
+#include <cstdlib> // for strtod
+#include <cstring> // for strcmp, strcspn
+#include <string>  // for string
+#include <vector>  // for vector
+
+using std::string;
+using std::vector;
+
+/// A phase or load added up over a dump, or the first frame or total time.
+struct StartupTime
+{
+  string kind; ///< phase, load, frame or total
+  string name;
+  double ms[2]; ///< baseline and run; negative if missing from that dump
+  int count[2]; ///< events added up
+};
+
+/// Adds the events in a dump to times, in column 0 (baseline) or 1 (run).
+static bool ReadDump(const char *path, int column, vector<StartupTime> &times)
+{
+  FILE *f = fopen(path, "r");
+  if (!f)
+  {
+    fprintf(stderr, "startupcmp: can't load %s\n", path);
+    return false;
+  }
+
+  char line[256];
+  while (fgets(line, sizeof(line), f))
+  {
+    line[strcspn(line, "\r\n")] = 0;
+    if (line[0] == '#' || line[0] == 0)
+      continue;
+
+    char *p;
+    double start = strtod(line, &p);
+    double end = strtod(p, &p);
+    char kind[16];
+    int nameOffset;
+    if (sscanf(p, " %15s %n", kind, &nameOffset) != 1)
+    {
+      fprintf(stderr, "startupcmp: bad line in %s: %s\n", path, line);
+      fclose(f);
+      return false;
+    }
+    string name = p + nameOffset;
+
+    size_t i = 0;
+    while (i < times.size() && (times[i].kind != kind || times[i].name != name))
+      ++i;
+    if (i == times.size())
+    {
+      StartupTime t;
+      t.kind = kind;
+      t.name = name;
+      t.ms[0] = t.ms[1] = -1;
+      t.count[0] = t.count[1] = 0;
+      times.push_back(t);
+    }
+
+    StartupTime &t = times[i];
+    if (t.ms[column] < 0)
+      t.ms[column] = 0;
+    t.ms[column] += end - start;
+    t.count[column]++;
+  }
+
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  double percent = 10;
+  double minMs = 5;
+  int arg = 1;
+
+  for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+  {
+    if (strcmp(argv[arg], "-t") == 0)
+      percent = strtod(argv[arg + 1], NULL);
+    else if (strcmp(argv[arg], "-m") == 0)
+      minMs = strtod(argv[arg + 1], NULL);
+    else
+      break;
+  }
+
+  if (argc - arg != 2)
+  {
+    fprintf(stderr, "usage: startupcmp [-t percent] [-m ms] baseline.txt run.txt\n");
+    return 2;
+  }
+
+  vector<StartupTime> times;
+  if (!ReadDump(argv[arg], 0, times) || !ReadDump(argv[arg + 1], 1, times))
+    return 2;
+
+  int regressions = 0;
+  printf("%-6s %-28s %10s %10s %10s\n", "kind", "name", "baseline", "run", "change");
+
+  for (size_t i = 0; i < times.size(); ++i)
+  {
+    StartupTime &t = times[i];
+    char base[16] = "-";
+    char run[16] = "-";
+    char change[16] = "";
+    const char *flag = "";
+
+    if (t.ms[0] >= 0)
+      sprintf(base, "%.1f", t.ms[0]);
+    if (t.ms[1] >= 0)
+      sprintf(run, "%.1f", t.ms[1]);
+
+    // Something new counts against the run too, as if it used to take 0.
+    if (t.ms[1] >= 0)
+    {
+      double before = t.ms[0] > 0 ? t.ms[0] : 0;
+      double delta = t.ms[1] - before;
+
+      if (before > 0)
+        sprintf(change, "%+.1f%%", delta * 100 / before);
+      else
+        sprintf(change, "new");
+
+      if (delta > minMs && delta > before * percent / 100)
+      {
+        flag = "  SLOWER";
+        ++regressions;
+      }
+    }
+
+    printf("%-6s %-28.28s %10s %10s %10s%s\n", t.kind.c_str(), t.name.c_str(), 
+      base, run, change, flag);
+  }
+
+  if (regressions)
+  {
+    printf("%d regression%s over %.0f%% and %.0f ms\n", regressions, 
+      regressions == 1 ? "" : "s", percent, minMs);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,772 @@
+/*
+ * TetriCycle
+ * Copyright (C) 2026 TetriCycle contributors
+ *
+ * This file is part of TetriCycle.
+ *
+ * TetriCycle is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TetriCycle is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with TetriCycle.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file texbake.cpp
+ * @brief Host tool that converts a PNG into a pre-tiled GX texture.
+ * @author TetriCycle contributors
+ *
+ * Usage: texbake [-p min_psnr] [-c cmpr_psnr] [-s cmpr_ssim] in.png out
+ *
+ * The texture format is picked from the content of the image:
+ * - CMPR (S3TC/DXT1) when cmpr_psnr is given, the image has no partial 
+ *   transparency, and the compressed image keeps a PSNR of at least 
+ *   cmpr_psnr and an SSIM of at least cmpr_ssim (default 
+ *   TEXBAKE_CMPR_SSIM);
+ * - I8 when every pixel has r == g == b == a (GX replicates I8 into all 
+ *   four channels);
+ * - IA8 when every pixel is gray;
+ * - RGB5A3 when it reproduces the image with a PSNR of at least min_psnr 
+ *   (default TEXBAKE_MIN_PSNR dB);
+ * - RGBA8 otherwise.
+ * CMPR takes 4 bits per pixel, I8 8, IA8 and RGB5A3 16, and RGBA8 32. 
+ * PSNR weights color errors by alpha; SSIM compares the luma of the 
+ * image composited over black. Both are printed for the chosen format.
+ *
+ * CMPR blocks are encoded on every host core. Each 4x4 block starts from 
+ * the principal axis of its colors, then alternates between picking the 
+ * best palette entry for every pixel and solving for the endpoints that 
+ * minimize the error of those picks, in both the 4 color mode and the 
+ * 3 color mode (needed for transparent pixels), and keeps the best.
+ *
+ * The texture data is written already tiled, padded to whole tiles by 
+ * repeating the edge pixels, so GuiImageData can hand it to GX_InitTexObj 
+ * straight from the embedded data. All values are big-endian.
+ *
+ * File layout:
+ * - header: "GXTX", u16 version, u16 texture format, u16 width, 
+ *   u16 height, u32 data size, zero padding up to TEXBAKE_HEADER bytes
+ * - the texture data
+ */
+
+#include <cstdio>    // for FILE, fprintf, printf
+#include <cstdlib>   // for atof
+#include <cstring>   // for strcmp, strrchr, memset
+#include <cmath>     // for log10
+#include <vector>    // for vector
+#include <thread>    // for thread
+#include <atomic>    // for atomic
+#include <png.h>
+
+using std::vector;
+
+// These must match gui.h.
+#define TEXBAKE_VERSION 1
+#define TEXBAKE_HEADER 32
+#define TEXBAKE_MIN_PSNR 40.0
+#define TEXBAKE_CMPR_SSIM 0.95
+#define TEXBAKE_CMPR_REFINE 8 // endpoint refinement passes per block mode
+
+// GX texture formats
+#define TF_I8 0x1
+#define TF_IA8 0x3
+#define TF_RGB5A3 0x5
+#define TF_RGBA8 0x6
+#define TF_CMPR 0xE
+
+/// A decoded image, 4 bytes per pixel in RGBA order.
+struct Image
+{
+  int width;
+  int height;
+  vector<unsigned char> rgba;
+
+  /// Get a pixel; coordinates past the edge repeat the edge pixel.
+  const unsigned char *Pixel(int x, int y) const
+  {
+    if (x >= width)
+      x = width - 1;
+    if (y >= height)
+      y = height - 1;
+    return &rgba[(y * width + x) * 4];
+  }
+
+  unsigned char *Pixel(int x, int y)
+  {
+    return &rgba[(y * width + x) * 4];
+  }
+};
+
+static void WriteU16(FILE *f, int value)
+{
+  fputc((value >> 8) & 0xFF, f);
+  fputc(value & 0xFF, f);
+}
+
+static void WriteU32(FILE *f, unsigned int value)
+{
+  WriteU16(f, value >> 16);
+  WriteU16(f, value & 0xFFFF);
+}
+
+static int Align(int value, int alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+static bool LoadPng(const char *path, Image &img)
+{
+  png_image png;
+  memset(&png, 0, sizeof(png));
+  png.version = PNG_IMAGE_VERSION;
+
+  if (!png_image_begin_read_from_file(&png, path))
+    return false;
+
+  png.format = PNG_FORMAT_RGBA;
+  img.width = png.width;
+  img.height = png.height;
+  img.rgba.resize(PNG_IMAGE_SIZE(png));
+
+  return png_image_finish_read(&png, NULL, &img.rgba[0], 0, NULL) != 0;
+}
+
+/// Quantize an 8-bit channel to the given number of bits, rounding.
+static int Quantize(int value, int bits)
+{
+  int max = (1 << bits) - 1;
+  return (value * max + 127) / 255;
+}
+
+/// Expand a quantized channel back to 8 bits, as GX does.
+static int Expand(int value, int bits)
+{
+  int result = 0;
+  for (int shift = 8 - bits; shift > -bits; shift -= bits)
+    result |= shift >= 0 ? value << shift : value >> -shift;
+  return result & 0xFF;
+}
+
+/// Weighted squared error of an encoded pixel; color counts by its alpha.
+static double PixelError(const unsigned char *p, int r, int g, int b, int a)
+{
+  double dr = p[0] - r, dg = p[1] - g, db = p[2] - b, da = p[3] - a;
+  return (dr * dr + dg * dg + db * db) * p[3] / 255.0 + da * da;
+}
+
+/// PSNR of an approximation of the image, with color errors weighted by alpha.
+static double Psnr(const Image &img, const Image &approx)
+{
+  double error = 0;
+
+  for (size_t i = 0; i < img.rgba.size(); i += 4)
+  {
+    const unsigned char *q = &approx.rgba[i];
+    error += PixelError(&img.rgba[i], q[0], q[1], q[2], q[3]);
+  }
+
+  double mse = error / img.rgba.size();
+  return mse > 0 ? 10 * log10(255.0 * 255.0 / mse) : INFINITY;
+}
+
+/// Luma of every pixel composited over black.
+static vector<double> Luma(const Image &img)
+{
+  vector<double> luma(img.width * img.height);
+
+  for (size_t i = 0; i < luma.size(); ++i)
+  {
+    const unsigned char *p = &img.rgba[i * 4];
+    luma[i] = (0.299 * p[0] + 0.587 * p[1] + 0.114 * p[2]) * p[3] / 255.0;
+  }
+  return luma;
+}
+
+/// Mean SSIM of the luma over 8x8 windows, 4 pixels apart.
+static double Ssim(const Image &img, const Image &approx)
+{
+  static const double c1 = (0.01 * 255) * (0.01 * 255);
+  static const double c2 = (0.03 * 255) * (0.03 * 255);
+  static const int window = 8;
+  static const int step = 4;
+
+  if (img.width < window || img.height < window)
+    return Psnr(img, approx) == INFINITY ? 1 : 0;
+
+  vector<double> a = Luma(img);
+  vector<double> b = Luma(approx);
+  double total = 0;
+  int windows = 0;
+
+  for (int wy = 0; wy + window <= img.height; wy += step)
+  {
+    for (int wx = 0; wx + window <= img.width; wx += step)
+    {
+      double sa = 0, sb = 0, saa = 0, sbb = 0, sab = 0;
+      for (int y = wy; y < wy + window; ++y)
+      {
+        for (int x = wx; x < wx + window; ++x)
+        {
+          double va = a[y * img.width + x], vb = b[y * img.width + x];
+          sa += va; sb += vb;
+          saa += va * va; sbb += vb * vb; sab += va * vb;
+        }
+      }
+
+      double n = window * window;
+      double ma = sa / n, mb = sb / n;
+      double va = saa / n - ma * ma, vb = sbb / n - mb * mb, cov = sab / n - ma * mb;
+      total += ((2 * ma * mb + c1) * (2 * cov + c2)) / 
+        ((ma * ma + mb * mb + c1) * (va + vb + c2));
+      ++windows;
+    }
+  }
+  return total / windows;
+}
+
+/// Encode a pixel as RGB5A3, picking whichever mode is closer.
+static unsigned short ToRGB5A3(const unsigned char *p, unsigned char *decoded)
+{
+  int r5 = Quantize(p[0], 5), g5 = Quantize(p[1], 5), b5 = Quantize(p[2], 5);
+  unsigned char opaque[4] = {(unsigned char)Expand(r5, 5), (unsigned char)Expand(g5, 5), 
+    (unsigned char)Expand(b5, 5), 255};
+
+  int r4 = Quantize(p[0], 4), g4 = Quantize(p[1], 4), b4 = Quantize(p[2], 4);
+  int a3 = Quantize(p[3], 3);
+  unsigned char alpha[4] = {(unsigned char)Expand(r4, 4), (unsigned char)Expand(g4, 4), 
+    (unsigned char)Expand(b4, 4), (unsigned char)Expand(a3, 3)};
+
+  if (PixelError(p, opaque[0], opaque[1], opaque[2], opaque[3]) <= 
+      PixelError(p, alpha[0], alpha[1], alpha[2], alpha[3]))
+  {
+    memcpy(decoded, opaque, 4);
+    return 0x8000 | (r5 << 10) | (g5 << 5) | b5;
+  }
+
+  memcpy(decoded, alpha, 4);
+  return (a3 << 12) | (r4 << 8) | (g4 << 4) | b4;
+}
+
+/// Tile the image; each texel is produced by encode(pixel).
+template <class Encoder>
+static void Tile(const Image &img, int tileW, int tileH, Encoder encode)
+{
+  int width = Align(img.width, tileW);
+  int height = Align(img.height, tileH);
+
+  for (int ty = 0; ty < height; ty += tileH)
+    for (int tx = 0; tx < width; tx += tileW)
+      for (int y = ty; y < ty + tileH; ++y)
+        for (int x = tx; x < tx + tileW; ++x)
+          encode(img.Pixel(x, y));
+}
+
+struct EncodeI8
+{
+  vector<unsigned char> &out;
+  void operator()(const unsigned char *p) { out.push_back(p[0]); }
+};
+
+struct EncodeIA8
+{
+  vector<unsigned char> &out;
+  void operator()(const unsigned char *p) { out.push_back(p[3]); out.push_back(p[0]); }
+};
+
+struct EncodeRGB5A3
+{
+  vector<unsigned char> &out;
+  void operator()(const unsigned char *p)
+  {
+    unsigned char decoded[4];
+    unsigned short texel = ToRGB5A3(p, decoded);
+    out.push_back(texel >> 8);
+    out.push_back(texel & 0xFF);
+  }
+};
+
+/// RGBA8 tiles hold the AR pairs of all 16 texels, then the GB pairs.
+static void TileRGBA8(const Image &img, vector<unsigned char> &out)
+{
+  int width = Align(img.width, 4);
+  int height = Align(img.height, 4);
+
+  for (int ty = 0; ty < height; ty += 4)
+  {
+    for (int tx = 0; tx < width; tx += 4)
+    {
+      for (int y = ty; y < ty + 4; ++y)
+      {
+        for (int x = tx; x < tx + 4; ++x)
+        {
+          const unsigned char *p = img.Pixel(x, y);
+          out.push_back(p[3]);
+          out.push_back(p[0]);
+        }
+      }
+      for (int y = ty; y < ty + 4; ++y)
+      {
+        for (int x = tx; x < tx + 4; ++x)
+        {
+          const unsigned char *p = img.Pixel(x, y);
+          out.push_back(p[1]);
+          out.push_back(p[2]);
+        }
+      }
+    }
+  }
+}
+
+/// A color with float channels, used while fitting CMPR endpoints.
+struct Color
+{
+  float r, g, b;
+};
+
+static Color Rgb(float r, float g, float b)
+{
+  Color color = {r, g, b};
+  return color;
+}
+
+static int To565(const Color &c)
+{
+  int r = Quantize(c.r < 0 ? 0 : c.r > 255 ? 255 : (int)(c.r + 0.5f), 5);
+  int g = Quantize(c.g < 0 ? 0 : c.g > 255 ? 255 : (int)(c.g + 0.5f), 6);
+  int b = Quantize(c.b < 0 ? 0 : c.b > 255 ? 255 : (int)(c.b + 0.5f), 5);
+  return (r << 11) | (g << 5) | b;
+}
+
+static Color From565(int c)
+{
+  Color color = {(float)Expand(c >> 11, 5), (float)Expand((c >> 5) & 0x3F, 6), 
+    (float)Expand(c & 0x1F, 5)};
+  return color;
+}
+
+/// The palette GX derives from two endpoints; entry 3 of a 3 color block is transparent.
+static void CmprPalette(int c0, int c1, Color palette[4])
+{
+  Color a = From565(c0), b = From565(c1);
+  palette[0] = a;
+  palette[1] = b;
+
+  if (c0 > c1)
+  {
+    palette[2] = Rgb((2 * a.r + b.r) / 3, (2 * a.g + b.g) / 3, (2 * a.b + b.b) / 3);
+    palette[3] = Rgb((a.r + 2 * b.r) / 3, (a.g + 2 * b.g) / 3, (a.b + 2 * b.b) / 3);
+  }
+  else
+  {
+    palette[2] = Rgb((a.r + b.r) / 2, (a.g + b.g) / 2, (a.b + b.b) / 2);
+    palette[3] = Rgb(0, 0, 0);
+  }
+}
+
+static float ColorError(const Color &a, const Color &b)
+{
+  float dr = a.r - b.r, dg = a.g - b.g, db = a.b - b.b;
+  return dr * dr + dg * dg + db * db;
+}
+
+/// A 4x4 block being encoded.
+struct CmprBlock
+{
+  Color pixels[16];
+  bool isTransparent[16];
+  int c0, c1;
+  int indices[16];
+  float error;
+};
+
+/// Pick the best palette entry for every pixel; returns the total error.
+static float CmprAssign(CmprBlock &block, int c0, int c1, int indices[16])
+{
+  Color palette[4];
+  CmprPalette(c0, c1, palette);
+  int entries = c0 > c1 ? 4 : 3;
+  float total = 0;
+
+  for (int i = 0; i < 16; ++i)
+  {
+    if (block.isTransparent[i])
+    {
+      indices[i] = 3;
+      continue;
+    }
+
+    int best = 0;
+    float bestError = ColorError(block.pixels[i], palette[0]);
+    for (int e = 1; e < entries; ++e)
+    {
+      float error = ColorError(block.pixels[i], palette[e]);
+      if (error < bestError)
+      {
+        best = e;
+        bestError = error;
+      }
+    }
+    indices[i] = best;
+    total += bestError;
+  }
+  return total;
+}
+
+/// Solve for the endpoints that minimize the error of the given picks.
+static bool CmprSolve(const CmprBlock &block, const int indices[16], bool isFourColor, 
+                      Color &a, Color &b)
+{
+  // every pick is a blend w * a + (1 - w) * b
+  static const float fourWeights[4] = {1, 0, 2.0f / 3, 1.0f / 3};
+  static const float threeWeights[3] = {1, 0, 0.5f};
+  const float *weights = isFourColor ? fourWeights : threeWeights;
+
+  float aa = 0, ab = 0, bb = 0;
+  Color ax = {0, 0, 0}, bx = {0, 0, 0};
+
+  for (int i = 0; i < 16; ++i)
+  {
+    if (block.isTransparent[i])
+      continue;
+
+    float w = weights[indices[i]], v = 1 - w;
+    const Color &p = block.pixels[i];
+    aa += w * w; ab += w * v; bb += v * v;
+    ax.r += w * p.r; ax.g += w * p.g; ax.b += w * p.b;
+    bx.r += v * p.r; bx.g += v * p.g; bx.b += v * p.b;
+  }
+
+  float det = aa * bb - ab * ab;
+  if (det < 1e-6f)
+    return false;
+
+  a = Rgb((ax.r * bb - bx.r * ab) / det, (ax.g * bb - bx.g * ab) / det, (ax.b * bb - bx.b * ab) / det);
+  b = Rgb((bx.r * aa - ax.r * ab) / det, (bx.g * aa - ax.g * ab) / det, (bx.b * aa - ax.b * ab) / det);
+  return true;
+}
+
+/// Fit the block in one mode, starting from the given endpoints.
+static void CmprFit(CmprBlock &block, Color a, Color b, bool isFourColor)
+{
+  for (int pass = 0; pass < TEXBAKE_CMPR_REFINE; ++pass)
+  {
+    int c0 = To565(a), c1 = To565(b);
+
+    // the mode is given by the order of the endpoints
+    if ((c0 > c1) != isFourColor)
+    {
+      int t = c0; c0 = c1; c1 = t;
+      Color tc = a; a = b; b = tc;
+    }
+    if (isFourColor && c0 == c1)
+      return; // needs two different endpoints
+
+    int indices[16];
+    float error = CmprAssign(block, c0, c1, indices);
+    if (error < block.error)
+    {
+      block.error = error;
+      block.c0 = c0;
+      block.c1 = c1;
+      memcpy(block.indices, indices, sizeof(indices));
+    }
+
+    if (!CmprSolve(block, indices, isFourColor, a, b))
+      return;
+  }
+}
+
+/// Encode a 4x4 block as the 8 bytes GX expects.
+static void CmprEncodeBlock(CmprBlock &block, unsigned char *out)
+{
+  Color mean = {0, 0, 0};
+  int count = 0;
+
+  for (int i = 0; i < 16; ++i)
+  {
+    if (block.isTransparent[i])
+      continue;
+    mean.r += block.pixels[i].r; mean.g += block.pixels[i].g; mean.b += block.pixels[i].b;
+    ++count;
+  }
+
+  block.c0 = block.c1 = 0;
+  block.error = INFINITY;
+  for (int i = 0; i < 16; ++i)
+    block.indices[i] = 3;
+
+  if (count)
+  {
+    mean.r /= count; mean.g /= count; mean.b /= count;
+
+    // principal axis of the colors, by power iteration on their covariance
+    float cov[6] = {0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 16; ++i)
+    {
+      if (block.isTransparent[i])
+        continue;
+      float r = block.pixels[i].r - mean.r, g = block.pixels[i].g - mean.g, b = block.pixels[i].b - mean.b;
+      cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+      cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+    }
+
+    Color axis = {1, 1, 1};
+    for (int iter = 0; iter < 8; ++iter)
+    {
+      Color next = {cov[0] * axis.r + cov[1] * axis.g + cov[2] * axis.b, 
+                    cov[1] * axis.r + cov[3] * axis.g + cov[4] * axis.b, 
+                    cov[2] * axis.r + cov[4] * axis.g + cov[5] * axis.b};
+      float len = sqrtf(next.r * next.r + next.g * next.g + next.b * next.b);
+      if (len < 1e-6f)
+        break;
+      axis = Rgb(next.r / len, next.g / len, next.b / len);
+    }
+
+    float lo = INFINITY, hi = -INFINITY;
+    for (int i = 0; i < 16; ++i)
+    {
+      if (block.isTransparent[i])
+        continue;
+      const Color &p = block.pixels[i];
+      float t = (p.r - mean.r) * axis.r + (p.g - mean.g) * axis.g + (p.b - mean.b) * axis.b;
+      if (t < lo) lo = t;
+      if (t > hi) hi = t;
+    }
+
+    Color a = {mean.r + axis.r * hi, mean.g + axis.g * hi, mean.b + axis.b * hi};
+    Color b = {mean.r + axis.r * lo, mean.g + axis.g * lo, mean.b + axis.b * lo};
+
+    if (count == 16)
+      CmprFit(block, a, b, true);
+    CmprFit(block, a, b, false);
+
+    // a solid block fits best with both endpoints on its color
+    CmprFit(block, mean, mean, false);
+  }
+
+  out[0] = block.c0 >> 8; out[1] = block.c0 & 0xFF;
+  out[2] = block.c1 >> 8; out[3] = block.c1 & 0xFF;
+  for (int row = 0; row < 4; ++row)
+  {
+    const int *idx = &block.indices[row * 4];
+    out[4 + row] = (idx[0] << 6) | (idx[1] << 4) | (idx[2] << 2) | idx[3];
+  }
+}
+
+/// Encode the image as CMPR tiles of 2x2 blocks, on every core.
+static void TileCMPR(const Image &img, vector<unsigned char> &out, Image &decoded)
+{
+  int width = Align(img.width, 8);
+  int height = Align(img.height, 8);
+  int tilesPerRow = width / 8;
+  int tileRows = height / 8;
+
+  out.assign(tilesPerRow * tileRows * 32, 0);
+  decoded = img;
+
+  std::atomic<int> nextRow(0);
+  auto worker = [&]()
+  {
+    for (int row = nextRow++; row < tileRows; row = nextRow++)
+    {
+      for (int tile = 0; tile < tilesPerRow; ++tile)
+      {
+        unsigned char *dst = &out[(row * tilesPerRow + tile) * 32];
+
+        for (int sub = 0; sub < 4; ++sub, dst += 8)
+        {
+          int bx = tile * 8 + (sub & 1) * 4;
+          int by = row * 8 + (sub >> 1) * 4;
+          CmprBlock block;
+
+          for (int i = 0; i < 16; ++i)
+          {
+            const unsigned char *p = img.Pixel(bx + (i & 3), by + (i >> 2));
+            block.pixels[i] = Rgb((float)p[0], (float)p[1], (float)p[2]);
+            block.isTransparent[i] = p[3] < 128;
+          }
+          CmprEncodeBlock(block, dst);
+
+          // decode what GX will show, for the quality report
+          Color palette[4];
+          CmprPalette(block.c0, block.c1, palette);
+          for (int i = 0; i < 16; ++i)
+          {
+            int x = bx + (i & 3), y = by + (i >> 2);
+            if (x >= img.width || y >= img.height)
+              continue;
+            unsigned char *q = decoded.Pixel(x, y);
+            int e = block.indices[i];
+            bool isClear = e == 3 && block.c0 <= block.c1;
+            q[0] = (unsigned char)(palette[e].r + 0.5f);
+            q[1] = (unsigned char)(palette[e].g + 0.5f);
+            q[2] = (unsigned char)(palette[e].b + 0.5f);
+            q[3] = isClear ? 0 : 255;
+          }
+        }
+      }
+    }
+  };
+
+  int threads = std::thread::hardware_concurrency();
+  if (threads < 1)
+    threads = 1;
+
+  vector<std::thread> pool;
+  for (int i = 1; i < threads; ++i)
+    pool.push_back(std::thread(worker));
+  worker();
+  for (size_t i = 0; i < pool.size(); ++i)
+    pool[i].join();
+}
+
+/// The quality thresholds a format has to meet.
+struct Thresholds
+{
+  double minPsnr;  ///< for RGB5A3
+  double cmprPsnr; ///< for CMPR; 0 never uses CMPR
+  double cmprSsim; ///< for CMPR
+};
+
+/// Pick the smallest format that is good enough, and encode the image.
+static int Encode(const Image &img, const Thresholds &limits, 
+                  vector<unsigned char> &out, double *psnr, double *ssim)
+{
+  bool isIntensity = true;
+  bool isGray = true;
+  bool isBinaryAlpha = true;
+
+  for (size_t i = 0; i < img.rgba.size(); i += 4)
+  {
+    const unsigned char *p = &img.rgba[i];
+    if (p[0] != p[1] || p[0] != p[2])
+      isGray = isIntensity = false;
+    else if (p[0] != p[3])
+      isIntensity = false;
+    if (p[3] != 0 && p[3] != 255)
+      isBinaryAlpha = false;
+  }
+
+  Image approx;
+
+  if (limits.cmprPsnr > 0 && isBinaryAlpha)
+  {
+    TileCMPR(img, out, approx);
+    *psnr = Psnr(img, approx);
+    *ssim = Ssim(img, approx);
+    if (*psnr >= limits.cmprPsnr && *ssim >= limits.cmprSsim)
+      return TF_CMPR;
+    out.clear();
+  }
+
+  *psnr = INFINITY;
+  *ssim = 1;
+
+  if (isIntensity)
+  {
+    EncodeI8 encode = {out};
+    Tile(img, 8, 4, encode);
+    return TF_I8;
+  }
+
+  if (isGray)
+  {
+    EncodeIA8 encode = {out};
+    Tile(img, 4, 4, encode);
+    return TF_IA8;
+  }
+
+  approx = img;
+  for (size_t i = 0; i < img.rgba.size(); i += 4)
+    ToRGB5A3(&img.rgba[i], &approx.rgba[i]);
+
+  *psnr = Psnr(img, approx);
+  *ssim = Ssim(img, approx);
+  if (*psnr >= limits.minPsnr)
+  {
+    EncodeRGB5A3 encode = {out};
+    Tile(img, 4, 4, encode);
+    return TF_RGB5A3;
+  }
+
+  *psnr = INFINITY;
+  *ssim = 1;
+  TileRGBA8(img, out);
+  return TF_RGBA8;
+}
+
+static const char *FormatName(int format)
+{
+  switch (format)
+  {
+    case TF_I8: return "I8";
+    case TF_IA8: return "IA8";
+    case TF_RGB5A3: return "RGB5A3";
+    case TF_CMPR: return "CMPR";
+  }
+  return "RGBA8";
+}
+
+int main(int argc, char *argv[])
+{
+  Thresholds limits = {TEXBAKE_MIN_PSNR, 0, TEXBAKE_CMPR_SSIM};
+  int arg = 1;
+
+  for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+  {
+    if (strcmp(argv[arg], "-p") == 0)
+      limits.minPsnr = atof(argv[arg + 1]);
+    else if (strcmp(argv[arg], "-c") == 0)
+      limits.cmprPsnr = atof(argv[arg + 1]);
+    else if (strcmp(argv[arg], "-s") == 0)
+      limits.cmprSsim = atof(argv[arg + 1]);
+    else
+      break;
+  }
+
+  if (argc - arg != 2)
+  {
+    fprintf(stderr, "usage: texbake [-p min_psnr] [-c cmpr_psnr] [-s cmpr_ssim] in.png out\n");
+    return 1;
+  }
+
+  Image img;
+  if (!LoadPng(argv[arg], img))
+  {
+    fprintf(stderr, "texbake: can't load %s\n", argv[arg]);
+    return 1;
+  }
+
+  vector<unsigned char> data;
+  double psnr, ssim;
+  int format = Encode(img, limits, data, &psnr, &ssim);
+
+  FILE *f = fopen(argv[arg + 1], "wb");
+  if (!f)
+  {
+    fprintf(stderr, "texbake: can't create %s\n", argv[arg + 1]);
+    return 1;
+  }
+
+  fwrite("GXTX", 1, 4, f);
+  WriteU16(f, TEXBAKE_VERSION);
+  WriteU16(f, format);
+  WriteU16(f, img.width);
+  WriteU16(f, img.height);
+  WriteU32(f, data.size());
+  for (int i = 16; i < TEXBAKE_HEADER; ++i)
+    fputc(0, f);
+  fwrite(&data[0], 1, data.size(), f);
+  fclose(f);
+
+  const char *name = strrchr(argv[arg], '/');
+  printf("  %s: %s, %u bytes, PSNR %.1f dB, SSIM %.4f\n", name ? name + 1 : argv[arg], 
+    FormatName(format), (unsigned)data.size(), psnr, ssim);
+  return 0;
+}